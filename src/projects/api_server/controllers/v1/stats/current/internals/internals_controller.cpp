@@ -8,6 +8,10 @@
 //==============================================================================
 #include "internals_controller.h"
 
+#include <mediarouter/mediarouter_worker_pool.h>
+#include <transcoder/transcoder_filter_ladder_stats.h>
+#include <transcoder/transcoder_scheduler.h>
+
 namespace api
 {
 	namespace v1
@@ -18,6 +22,13 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/memoryPools)", &InternalsController::OnGetMemoryPools);
+				RegisterGet(R"(\/tlsSessions)", &InternalsController::OnGetTlsSessions);
+				RegisterGet(R"(\/kernelTls)", &InternalsController::OnGetKernelTls);
+				RegisterGet(R"(\/datagramBatches)", &InternalsController::OnGetDatagramBatches);
+				RegisterGet(R"(\/mediaRouterWorkers)", &InternalsController::OnGetMediaRouterWorkers);
+				RegisterGet(R"(\/transcoderLadders)", &InternalsController::OnGetTranscoderLadders);
+				RegisterGet(R"(\/transcodeScheduler)", &InternalsController::OnGetTranscodeScheduler);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +36,13 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/memoryPools");
+				response.append("/v1/stats/current/internals/tlsSessions");
+				response.append("/v1/stats/current/internals/kernelTls");
+				response.append("/v1/stats/current/internals/datagramBatches");
+				response.append("/v1/stats/current/internals/mediaRouterWorkers");
+				response.append("/v1/stats/current/internals/transcoderLadders");
+				response.append("/v1/stats/current/internals/transcodeScheduler");
 
 				return response;
 			}
@@ -47,6 +65,77 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetMemoryPools(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				for (auto &stats : serverMetric->GetMemoryPoolStatsList())
+				{
+					response.append(serdes::JsonFromMemoryPoolStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetTlsSessions(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				return serdes::JsonFromTlsSessionStats(serverMetric->GetTlsSessionStats());
+			}
+
+			ApiResponse InternalsController::OnGetKernelTls(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				return serdes::JsonFromKernelTlsStats(serverMetric->GetKernelTlsStats());
+			}
+
+			ApiResponse InternalsController::OnGetDatagramBatches(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				return serdes::JsonFromDatagramBatchStats(serverMetric->GetDatagramBatchStats());
+			}
+
+			ApiResponse InternalsController::OnGetMediaRouterWorkers(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (auto &stats : MediaRouteWorkerPool::GetAllStats())
+				{
+					response.append(serdes::JsonFromMediaRouteWorkerPoolStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetTranscoderLadders(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (auto &stats : TranscodeFilterLadderStats::GetAll())
+				{
+					response.append(serdes::JsonFromTranscodeFilterLadderStats(stats));
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetTranscodeScheduler(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (auto &stats : TranscodeScheduler::GetInstance()->GetStats())
+				{
+					response.append(serdes::JsonFromTranscodeSchedulerStageStats(stats));
+				}
+
+				return response;
+			}
 		}  // namespace stats
 	}	   // namespace v1
 }  // namespace api
\ No newline at end of file
@@ -24,6 +24,13 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetMemoryPools(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetTlsSessions(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetKernelTls(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetDatagramBatches(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetMediaRouterWorkers(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetTranscoderLadders(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetTranscodeScheduler(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}	   // namespace v1
@@ -8,6 +8,8 @@
 //==============================================================================
 #include "streams_controller.h"
 
+#include <orchestrator/orchestrator.h>
+
 namespace api
 {
 	namespace v1
@@ -17,6 +19,7 @@ namespace api
 			void StreamsController::PrepareHandlers()
 			{
 				RegisterGet(R"(\/(?<stream_name>[^\/]*))", &StreamsController::OnGetStream);
+				RegisterGet(R"(\/(?<stream_name>[^\/]*)\/fanOut)", &StreamsController::OnGetFanOutStats);
 			};
 
 			ApiResponse StreamsController::OnGetStream(const std::shared_ptr<http::svr::HttpExchange> &client,
@@ -27,6 +30,55 @@ namespace api
 			{
 				return ::serdes::JsonFromMetrics(stream);
 			}
+
+			ApiResponse StreamsController::OnGetFanOutStats(const std::shared_ptr<http::svr::HttpExchange> &client,
+															const std::shared_ptr<mon::HostMetrics> &vhost,
+															const std::shared_ptr<mon::ApplicationMetrics> &app,
+															const std::shared_ptr<mon::StreamMetrics> &stream,
+															const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams)
+			{
+				auto orchestrator = ocst::Orchestrator::GetInstance();
+				Json::Value response(Json::ValueType::arrayValue);
+
+				for (
+					auto publisher_type = static_cast<PublisherType>(ov::ToUnderlyingType(PublisherType::Unknown) + 1);
+					publisher_type < PublisherType::NumberOfPublishers;
+					publisher_type = static_cast<PublisherType>(ov::ToUnderlyingType(publisher_type) + 1))
+				{
+					auto publisher = orchestrator->GetPublisherFromType(publisher_type);
+
+					if (publisher == nullptr)
+					{
+						continue;
+					}
+
+					for (auto &output_stream : output_streams)
+					{
+						auto publisher_stream = publisher->GetStream(app->GetId(), output_stream->GetId());
+
+						if (publisher_stream == nullptr)
+						{
+							continue;
+						}
+
+						Json::Value item = ::serdes::JsonFromFanOutStats(publisher_stream->GetFanOutStats());
+						item["publisher"] = StringFromPublisherType(publisher_type).CStr();
+						item["outputStream"] = output_stream->GetName().CStr();
+
+						Json::Value &workers = item["workers"];
+						workers = Json::Value(Json::ValueType::arrayValue);
+
+						for (const auto &worker_stats : publisher_stream->GetFanOutStatsPerWorker())
+						{
+							workers.append(::serdes::JsonFromFanOutStats(worker_stats));
+						}
+
+						response.append(item);
+					}
+				}
+
+				return response;
+			}
 		}  // namespace stats
 	}	   // namespace v1
 }  // namespace api
@@ -27,6 +27,13 @@ namespace api
 										const std::shared_ptr<mon::ApplicationMetrics> &app,
 										const std::shared_ptr<mon::StreamMetrics> &stream,
 										const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
+
+				// Fan-out measurements of the output streams, for each publisher
+				ApiResponse OnGetFanOutStats(const std::shared_ptr<http::svr::HttpExchange> &client,
+											 const std::shared_ptr<mon::HostMetrics> &vhost,
+											 const std::shared_ptr<mon::ApplicationMetrics> &app,
+											 const std::shared_ptr<mon::StreamMetrics> &stream,
+											 const std::vector<std::shared_ptr<mon::StreamMetrics>> &output_streams);
 			};
 		}  // namespace stats
 	}	   // namespace v1
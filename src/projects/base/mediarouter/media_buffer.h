@@ -93,7 +93,7 @@ public:
 		}
 		else
 		{
-			_data = std::make_shared<ov::Data>();
+			_data = ov::AllocateShared<ov::Data>();
 		}
 	}
 
@@ -247,7 +247,7 @@ public:
 
 	std::shared_ptr<MediaPacket> ClonePacket() const
 	{
-		auto packet = std::make_shared<MediaPacket>(
+		auto packet = ov::AllocateShared<MediaPacket>(
 			GetMsid(),
 			GetMediaType(),
 			GetTrackId(),
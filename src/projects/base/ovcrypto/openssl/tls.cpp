@@ -636,6 +636,11 @@ namespace ov
 		return ov::String(reinterpret_cast<const char *>(data), len);
 	}
 
+	ov::String Tls::GetCipherName() const
+	{
+		return (_ssl != nullptr) ? ::SSL_get_cipher_name(_ssl) : "";
+	}
+
 	long Tls::GetVersion() const
 	{
 		// Holds _peer_certificate to prevent referencing nullptr
@@ -63,6 +63,8 @@ namespace ov
 		static ov::String StringFromX509Name(const X509_NAME *name);
 
 		long GetVersion() const;
+		// Name of the negotiated cipher (e.g. TLS_AES_128_GCM_SHA256)
+		ov::String GetCipherName() const;
 		ov::String GetSubjectName() const;
 		ov::String GetIssuerName() const;
 
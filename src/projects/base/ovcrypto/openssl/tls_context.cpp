@@ -10,6 +10,8 @@
 
 #include "./openssl_private.h"
 #include "./tls.h"
+#include "./tls_session_cache.h"
+#include "../message_digest.h"
 
 #define DO_CALLBACK_IF_AVAILABLE(return_type, default_value, tls_context, callback_name, ...) \
 	DoCallback<return_type, default_value, decltype(&TlsContextCallback::callback_name), &TlsContextCallback::callback_name>(tls_context, ##__VA_ARGS__)
@@ -344,6 +346,54 @@ namespace ov
 		::SSL_CTX_set_verify(_ssl_ctx, mode, nullptr);
 	}
 
+	void TlsContext::SetKernelTlsEnabled(bool enabled)
+	{
+#ifdef SSL_OP_ENABLE_KTLS
+		if (enabled)
+		{
+			::SSL_CTX_set_options(_ssl_ctx, SSL_OP_ENABLE_KTLS);
+		}
+		else
+		{
+			::SSL_CTX_clear_options(_ssl_ctx, SSL_OP_ENABLE_KTLS);
+		}
+#else	// SSL_OP_ENABLE_KTLS
+		if (enabled)
+		{
+			logtw("kTLS is not supported by this version of OpenSSL");
+		}
+#endif	// SSL_OP_ENABLE_KTLS
+	}
+
+	bool TlsContext::EnableSessionCache(const ov::String &id_context)
+	{
+		uint8_t sid_ctx[SSL_MAX_SID_CTX_LENGTH];
+		size_t sid_ctx_length = id_context.GetLength();
+
+		if (sid_ctx_length > SSL_MAX_SID_CTX_LENGTH)
+		{
+			// SHA-256 digest is exactly SSL_MAX_SID_CTX_LENGTH (32) bytes
+			sid_ctx_length = SSL_MAX_SID_CTX_LENGTH;
+
+			if (MessageDigest::ComputeDigest(CryptoAlgorithm::Sha256, id_context.CStr(), id_context.GetLength(), sid_ctx, sid_ctx_length) == false)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			::memcpy(sid_ctx, id_context.CStr(), sid_ctx_length);
+		}
+
+		if (::SSL_CTX_set_session_id_context(_ssl_ctx, sid_ctx, static_cast<unsigned int>(sid_ctx_length)) != 1)
+		{
+			logte("Could not set the session id context: %s", OpensslError().What());
+			return false;
+		}
+
+		return TlsSessionCache::GetInstance()->Attach(_ssl_ctx);
+	}
+
 	int TlsContext::TlsVerify(X509_STORE_CTX *store, void *arg)
 	{
 		bool result = DO_CALLBACK_IF_AVAILABLE(bool, false, arg, verify_callback, store);
@@ -57,6 +57,16 @@ namespace ov
 
 		void SetVerify(int mode);
 
+		// Let OpenSSL hand over the crypto state to the kernel after the handshake (SSL_OP_ENABLE_KTLS)
+		//
+		// The offload is actually enabled only if the BIO accepts it (See TlsServerData::SetKernelTlsCallbacks())
+		void SetKernelTlsEnabled(bool enabled);
+
+		// Use the process-wide session cache and the rotating ticket keys (See TlsSessionCache)
+		//
+		// A session can be resumed only by the contexts that have the same id_context
+		bool EnableSessionCache(const ov::String &id_context);
+
 	protected:
 		MAY_THROWS(ov::OpensslError)
 		void Prepare(
@@ -10,8 +10,17 @@
 
 #include "./openssl_private.h"
 
+// BIO controls used by OpenSSL to hand over the crypto state to the kernel.
+// They are not exported by <openssl/bio.h> (See "internal BIO" in bio.h of OpenSSL 3.x).
+#define OV_BIO_CTRL_SET_KTLS 72
+#define OV_BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG 74
+#define OV_BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG 75
+
 namespace ov
 {
+	static std::atomic<uint64_t> ktls_offloaded_count{0};
+	static std::atomic<uint64_t> ktls_fallback_count{0};
+
 	TlsServerData::TlsServerData(const std::shared_ptr<TlsContext> &tls_context, bool is_nonblocking)
 	{
 		TlsBioCallback callback = {
@@ -88,6 +97,20 @@ namespace ov
 						case SSL_ERROR_NONE: {
 							logtd("Accepted");
 							_state = State::Accepted;
+
+							if (_enable_ktls_callback != nullptr)
+							{
+								if (_ktls_enabled)
+								{
+									ktls_offloaded_count++;
+								}
+								else
+								{
+									ktls_fallback_count++;
+									logtd("kTLS is not available for this connection (cipher: %s)", _tls.GetCipherName().CStr());
+								}
+							}
+
 							break;
 						}
 
@@ -227,8 +250,24 @@ namespace ov
 		return bytes_to_copy;
 	}
 
+	TlsServerData::KernelTlsStats TlsServerData::GetKernelTlsStats()
+	{
+		KernelTlsStats stats;
+
+		stats.offloaded_count = ktls_offloaded_count.load();
+		stats.fallback_count = ktls_fallback_count.load();
+
+		return stats;
+	}
+
 	ssize_t TlsServerData::OnTlsWrite(Tls *tls, const void *data, size_t length)
 	{
+		if (_ktls_record_type != 0)
+		{
+			// A control record (e.g. NewSessionTicket) must be sent with the record type, and the kernel encrypts it
+			return (_send_ktls_record_callback != nullptr) ? _send_ktls_record_callback(_ktls_record_type, data, length) : -1LL;
+		}
+
 		if (_state == State::WaitingForAccept)
 		{
 			if (_write_callback != nullptr)
@@ -269,6 +308,33 @@ namespace ov
 			case BIO_CTRL_FLUSH:
 				return 1;
 
+			case OV_BIO_CTRL_SET_KTLS:
+				// Only TX is offloaded, because the received data is decrypted from the buffer passed to Decrypt().
+				// num is non-zero for TX (OpenSSL 3.0 passes `which & SSL3_CC_WRITE`, which is 2, while 1.1.1 passes 1)
+				if ((num != 0) && (arg != nullptr) && (_enable_ktls_callback != nullptr) && _enable_ktls_callback(arg))
+				{
+					logtd("TX encryption is offloaded to the kernel");
+					_ktls_enabled = true;
+					return 1;
+				}
+
+				return 0;
+
+			case BIO_CTRL_GET_KTLS_SEND:
+				// OpenSSL writes plain records to the BIO once this returns 1
+				return _ktls_enabled ? 1 : 0;
+
+			case BIO_CTRL_GET_KTLS_RECV:
+				return 0;
+
+			case OV_BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG:
+				_ktls_record_type = static_cast<uint8_t>(num);
+				return 1;
+
+			case OV_BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG:
+				_ktls_record_type = 0;
+				return 1;
+
 			default:
 				return 0;
 		}
@@ -18,6 +18,20 @@ namespace ov
 	public:
 		using WriteCallback = std::function<ssize_t(const void *data, int64_t length)>;
 
+		// Called when OpenSSL hands over the TX crypto state (struct tls_crypto_info of <linux/tls.h>) to the kernel
+		using EnableKernelTlsCallback = std::function<bool(const void *crypto_info)>;
+		// Called to send a record that is not application data (e.g. NewSessionTicket, alert) after kTLS is enabled
+		using SendKernelTlsRecordCallback = std::function<ssize_t(uint8_t record_type, const void *data, size_t length)>;
+
+		struct KernelTlsStats
+		{
+			// Number of connections whose TX encryption is offloaded to the kernel
+			uint64_t offloaded_count = 0;
+			// Number of connections that requested kTLS but are encrypted by OpenSSL
+			// (unsupported cipher/kernel, or the handshake data was not flushed yet)
+			uint64_t fallback_count = 0;
+		};
+
 		enum class State
 		{
 			Invalid,
@@ -54,6 +68,21 @@ namespace ov
 			_write_callback = write_callback;
 		}
 
+		// Offload the TX encryption to the kernel after the handshake (TlsContext::SetKernelTlsEnabled(true) is also required)
+		void SetKernelTlsCallbacks(EnableKernelTlsCallback enable_callback, SendKernelTlsRecordCallback send_record_callback)
+		{
+			_enable_ktls_callback = std::move(enable_callback);
+			_send_ktls_record_callback = std::move(send_record_callback);
+		}
+
+		// If true, the application data can be written to the socket (including sendfile()) without Encrypt()
+		bool IsKernelTlsEnabled() const
+		{
+			return _ktls_enabled;
+		}
+
+		static KernelTlsStats GetKernelTlsStats();
+
 		ov::String GetServerName() const
 		{
 			return _tls.GetServerName();
@@ -102,5 +131,11 @@ namespace ov
 		std::shared_ptr<Data> _plain_data;
 
 		AlpnProtocol _selected_alpn_protocol = AlpnProtocol::Http11;
+
+		EnableKernelTlsCallback _enable_ktls_callback;
+		SendKernelTlsRecordCallback _send_ktls_record_callback;
+		std::atomic<bool> _ktls_enabled{false};
+		// Record type of the next write (0 means application data), set by OpenSSL through BIO_ctrl()
+		uint8_t _ktls_record_type = 0;
 	};
 }  // namespace ov
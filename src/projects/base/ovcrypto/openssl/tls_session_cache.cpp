@@ -0,0 +1,397 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "tls_session_cache.h"
+
+#include <openssl/core_names.h>
+#include <openssl/rand.h>
+
+#include "./openssl_error.h"
+#include "./openssl_private.h"
+
+namespace ov
+{
+	TlsSessionCache *TlsSessionCache::GetInstance()
+	{
+		static TlsSessionCache *instance = new TlsSessionCache();
+		return instance;
+	}
+
+	bool TlsSessionCache::Attach(SSL_CTX *ssl_ctx)
+	{
+		if (ssl_ctx == nullptr)
+		{
+			OV_ASSERT2(false);
+			return false;
+		}
+
+		// Do not use the internal cache of each SSL_CTX, so all SSL_CTXs look up the same sessions
+		::SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+		::SSL_CTX_set_timeout(ssl_ctx, SessionTimeoutSec);
+
+		::SSL_CTX_sess_set_new_cb(ssl_ctx, OnNewSession);
+		::SSL_CTX_sess_set_get_cb(ssl_ctx, OnGetSession);
+		::SSL_CTX_sess_set_remove_cb(ssl_ctx, OnRemoveSession);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		if (::SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_ctx, OnTicketKey) != 1)
+		{
+			logtw("Could not set the ticket key callback: %s", OpensslError().What());
+			return false;
+		}
+#endif	// OPENSSL_VERSION_NUMBER >= 0x30000000L
+
+		return true;
+	}
+
+	void TlsSessionCache::Clear()
+	{
+		{
+			std::lock_guard lock_guard(_session_mutex);
+
+			_session_map.clear();
+			_lru_list.clear();
+		}
+
+		{
+			std::lock_guard lock_guard(_ticket_key_mutex);
+
+			// Issued tickets cannot be decrypted anymore
+			_ticket_key_list.clear();
+		}
+	}
+
+	TlsSessionCache::Stats TlsSessionCache::GetStats() const
+	{
+		Stats stats;
+
+		stats.hit_count = _hit_count;
+		stats.miss_count = _miss_count;
+		stats.stored_count = _stored_count;
+		stats.evicted_count = _evicted_count;
+
+		{
+			std::lock_guard lock_guard(_session_mutex);
+			stats.cached_session_count = _session_map.size();
+		}
+
+		stats.ticket_issued_count = _ticket_issued_count;
+		stats.ticket_resumed_count = _ticket_resumed_count;
+		stats.ticket_renewed_count = _ticket_renewed_count;
+		stats.ticket_rejected_count = _ticket_rejected_count;
+		stats.ticket_key_rotation_count = _ticket_key_rotation_count;
+
+		return stats;
+	}
+
+	bool TlsSessionCache::StoreSession(SSL_SESSION *session)
+	{
+		unsigned int id_length = 0;
+		auto id = ::SSL_SESSION_get_id(session, &id_length);
+
+		if (id_length == 0)
+		{
+			return false;
+		}
+
+		int der_length = ::i2d_SSL_SESSION(session, nullptr);
+
+		if (der_length <= 0)
+		{
+			return false;
+		}
+
+		Entry entry;
+		entry.der.resize(der_length);
+		auto der_buffer = entry.der.data();
+
+		if (::i2d_SSL_SESSION(session, &der_buffer) != der_length)
+		{
+			return false;
+		}
+
+		entry.expire_time = ::SSL_SESSION_get_time(session) + ::SSL_SESSION_get_timeout(session);
+
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+
+		std::lock_guard lock_guard(_session_mutex);
+
+		auto item = _session_map.find(key);
+
+		if (item != _session_map.end())
+		{
+			_lru_list.erase(item->second.lru_iterator);
+			_session_map.erase(item);
+		}
+
+		while (_session_map.size() >= MaxSessionCount)
+		{
+			_session_map.erase(_lru_list.back());
+			_lru_list.pop_back();
+			_evicted_count++;
+		}
+
+		_lru_list.push_front(key);
+		entry.lru_iterator = _lru_list.begin();
+		_session_map.emplace(std::move(key), std::move(entry));
+
+		_stored_count++;
+
+		return true;
+	}
+
+	SSL_SESSION *TlsSessionCache::LoadSession(const unsigned char *id, int id_length)
+	{
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+		std::vector<uint8_t> der;
+
+		{
+			std::lock_guard lock_guard(_session_mutex);
+
+			auto item = _session_map.find(key);
+
+			if (item == _session_map.end())
+			{
+				_miss_count++;
+				return nullptr;
+			}
+
+			auto &entry = item->second;
+
+			if (entry.expire_time <= ::time(nullptr))
+			{
+				_lru_list.erase(entry.lru_iterator);
+				_session_map.erase(item);
+
+				_miss_count++;
+				return nullptr;
+			}
+
+			_lru_list.splice(_lru_list.begin(), _lru_list, entry.lru_iterator);
+			der = entry.der;
+		}
+
+		// Decode the session without the lock
+		const unsigned char *der_buffer = der.data();
+		auto session = ::d2i_SSL_SESSION(nullptr, &der_buffer, static_cast<long>(der.size()));
+
+		if (session == nullptr)
+		{
+			_miss_count++;
+			return nullptr;
+		}
+
+		_hit_count++;
+
+		return session;
+	}
+
+	void TlsSessionCache::RemoveSession(SSL_SESSION *session)
+	{
+		unsigned int id_length = 0;
+		auto id = ::SSL_SESSION_get_id(session, &id_length);
+
+		if (id_length == 0)
+		{
+			return;
+		}
+
+		std::string key(reinterpret_cast<const char *>(id), id_length);
+
+		std::lock_guard lock_guard(_session_mutex);
+
+		auto item = _session_map.find(key);
+
+		if (item != _session_map.end())
+		{
+			_lru_list.erase(item->second.lru_iterator);
+			_session_map.erase(item);
+		}
+	}
+
+	bool TlsSessionCache::GenerateTicketKey(TicketKey *key)
+	{
+		if ((::RAND_bytes(key->name, sizeof(key->name)) != 1) ||
+			(::RAND_bytes(key->aes_key, sizeof(key->aes_key)) != 1) ||
+			(::RAND_bytes(key->hmac_key, sizeof(key->hmac_key)) != 1))
+		{
+			logte("Could not generate a ticket key: %s", OpensslError().What());
+			return false;
+		}
+
+		key->created_time = std::chrono::steady_clock::now();
+
+		return true;
+	}
+
+	bool TlsSessionCache::GetCurrentTicketKey(TicketKey *key)
+	{
+		std::lock_guard lock_guard(_ticket_key_mutex);
+
+		auto now = std::chrono::steady_clock::now();
+
+		if (_ticket_key_list.empty() ||
+			((now - _ticket_key_list.front().created_time) >= std::chrono::seconds(TicketKeyRotationIntervalSec)))
+		{
+			TicketKey new_key;
+
+			if (GenerateTicketKey(&new_key) == false)
+			{
+				if (_ticket_key_list.empty())
+				{
+					return false;
+				}
+
+				// Keep using the current key
+				*key = _ticket_key_list.front();
+				return true;
+			}
+
+			if (_ticket_key_list.empty() == false)
+			{
+				_ticket_key_rotation_count++;
+			}
+
+			_ticket_key_list.push_front(new_key);
+
+			while (_ticket_key_list.size() > MaxTicketKeyCount)
+			{
+				_ticket_key_list.pop_back();
+			}
+		}
+
+		*key = _ticket_key_list.front();
+
+		return true;
+	}
+
+	int TlsSessionCache::FindTicketKey(const unsigned char *name, TicketKey *key)
+	{
+		std::lock_guard lock_guard(_ticket_key_mutex);
+
+		bool is_current = true;
+
+		for (auto &ticket_key : _ticket_key_list)
+		{
+			if (::memcmp(ticket_key.name, name, sizeof(ticket_key.name)) == 0)
+			{
+				*key = ticket_key;
+
+				// The ticket should be renewed if it is encrypted with a previous key or the current key is expired
+				if (is_current &&
+					((std::chrono::steady_clock::now() - ticket_key.created_time) < std::chrono::seconds(TicketKeyRotationIntervalSec)))
+				{
+					return 1;
+				}
+
+				return 2;
+			}
+
+			is_current = false;
+		}
+
+		return 0;
+	}
+
+	int TlsSessionCache::OnNewSession(SSL *ssl, SSL_SESSION *session)
+	{
+		GetInstance()->StoreSession(session);
+
+		// Returns 0 because the cache doesn't keep the reference of the session (It is stored as DER)
+		return 0;
+	}
+
+	SSL_SESSION *TlsSessionCache::OnGetSession(SSL *ssl, const unsigned char *id, int id_length, int *copy)
+	{
+		// The returned session is owned by OpenSSL
+		*copy = 0;
+
+		return GetInstance()->LoadSession(id, id_length);
+	}
+
+	void TlsSessionCache::OnRemoveSession(SSL_CTX *ssl_ctx, SSL_SESSION *session)
+	{
+		GetInstance()->RemoveSession(session);
+	}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	// https://www.openssl.org/docs/man3.0/man3/SSL_CTX_set_tlsext_ticket_key_evp_cb.html
+	int TlsSessionCache::OnTicketKey(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc)
+	{
+		auto instance = GetInstance();
+		TicketKey key;
+		int result = 1;
+
+		if (enc == 1)
+		{
+			// Encrypt a new ticket
+			if (instance->GetCurrentTicketKey(&key) == false)
+			{
+				return -1;
+			}
+
+			if (::RAND_bytes(iv, EVP_CIPHER_get_iv_length(::EVP_aes_256_cbc())) != 1)
+			{
+				return -1;
+			}
+
+			::memcpy(key_name, key.name, sizeof(key.name));
+		}
+		else
+		{
+			// Decrypt the ticket
+			result = instance->FindTicketKey(key_name, &key);
+
+			if (result == 0)
+			{
+				// Perform a full handshake
+				instance->_ticket_rejected_count++;
+				return 0;
+			}
+		}
+
+		char digest_name[] = "SHA256";
+		OSSL_PARAM params[] = {
+			::OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, key.hmac_key, sizeof(key.hmac_key)),
+			::OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest_name, 0),
+			::OSSL_PARAM_construct_end()};
+
+		if (::EVP_MAC_CTX_set_params(mac_ctx, params) != 1)
+		{
+			return -1;
+		}
+
+		if (enc == 1)
+		{
+			if (::EVP_EncryptInit_ex(cipher_ctx, ::EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1)
+			{
+				return -1;
+			}
+
+			instance->_ticket_issued_count++;
+		}
+		else
+		{
+			if (::EVP_DecryptInit_ex(cipher_ctx, ::EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1)
+			{
+				return -1;
+			}
+
+			instance->_ticket_resumed_count++;
+
+			if (result == 2)
+			{
+				// OpenSSL issues a new ticket encrypted with the current key
+				instance->_ticket_renewed_count++;
+			}
+		}
+
+		return result;
+	}
+#endif	// OPENSSL_VERSION_NUMBER >= 0x30000000L
+}  // namespace ov
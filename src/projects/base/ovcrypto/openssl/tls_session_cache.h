@@ -0,0 +1,124 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <openssl/ssl.h>
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace ov
+{
+	// A process-wide TLS session cache shared by all server SSL_CTXs
+	//
+	// - Session IDs (TLS 1.2): The sessions are kept in an external cache (DER-encoded), so a client can resume
+	//   the session even if it reconnects to another HttpsServer instance or another socket pool worker
+	// - Session tickets (TLS 1.2/1.3): All SSL_CTXs share the same ticket keys, which are rotated every
+	//   TicketKeyRotationIntervalSec. Tickets encrypted with a previous key are still accepted (and renewed)
+	//   until the key is discarded.
+	class TlsSessionCache
+	{
+	public:
+		static constexpr size_t MaxSessionCount = 20480;
+		static constexpr long SessionTimeoutSec = 3600;
+
+		static constexpr int TicketKeyRotationIntervalSec = 3600;
+		// The current key + previous keys
+		static constexpr size_t MaxTicketKeyCount = 3;
+
+		struct Stats
+		{
+			// Session ID lookups
+			uint64_t hit_count = 0;
+			uint64_t miss_count = 0;
+			uint64_t stored_count = 0;
+			uint64_t evicted_count = 0;
+			size_t cached_session_count = 0;
+
+			// Session tickets
+			uint64_t ticket_issued_count = 0;
+			// The number of tickets decrypted (including renewed tickets)
+			uint64_t ticket_resumed_count = 0;
+			// The number of tickets decrypted with a previous key
+			uint64_t ticket_renewed_count = 0;
+			// The number of tickets encrypted with an unknown (discarded) key
+			uint64_t ticket_rejected_count = 0;
+			uint64_t ticket_key_rotation_count = 0;
+		};
+
+		// This instance is never destroyed, because SSL_CTXs may be released during static destruction
+		static TlsSessionCache *GetInstance();
+
+		// Install the session cache and ticket key callbacks to the SSL_CTX
+		bool Attach(SSL_CTX *ssl_ctx);
+
+		void Clear();
+
+		Stats GetStats() const;
+
+	protected:
+		struct Entry
+		{
+			std::vector<uint8_t> der;
+			time_t expire_time = 0;
+			// Position in _lru_list
+			std::list<std::string>::iterator lru_iterator;
+		};
+
+		struct TicketKey
+		{
+			uint8_t name[16];
+			uint8_t aes_key[32];
+			uint8_t hmac_key[32];
+			std::chrono::steady_clock::time_point created_time;
+		};
+
+		TlsSessionCache() = default;
+
+		bool StoreSession(SSL_SESSION *session);
+		SSL_SESSION *LoadSession(const unsigned char *id, int id_length);
+		void RemoveSession(SSL_SESSION *session);
+
+		// Returns the current key (rotates the key if needed)
+		bool GetCurrentTicketKey(TicketKey *key);
+		// Returns 0 if the key is not found, 1 if the key is the current key, 2 if the key is a previous key
+		int FindTicketKey(const unsigned char *name, TicketKey *key);
+		static bool GenerateTicketKey(TicketKey *key);
+
+		static int OnNewSession(SSL *ssl, SSL_SESSION *session);
+		static SSL_SESSION *OnGetSession(SSL *ssl, const unsigned char *id, int id_length, int *copy);
+		static void OnRemoveSession(SSL_CTX *ssl_ctx, SSL_SESSION *session);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+		static int OnTicketKey(SSL *ssl, unsigned char key_name[16], unsigned char *iv, EVP_CIPHER_CTX *cipher_ctx, EVP_MAC_CTX *mac_ctx, int enc);
+#endif	// OPENSSL_VERSION_NUMBER >= 0x30000000L
+
+		mutable std::mutex _session_mutex;
+		std::unordered_map<std::string, Entry> _session_map;
+		// The most recently used session ID is at the front
+		std::list<std::string> _lru_list;
+
+		std::mutex _ticket_key_mutex;
+		// The current key is at the front
+		std::list<TicketKey> _ticket_key_list;
+
+		std::atomic<uint64_t> _hit_count{0};
+		std::atomic<uint64_t> _miss_count{0};
+		std::atomic<uint64_t> _stored_count{0};
+		std::atomic<uint64_t> _evicted_count{0};
+
+		std::atomic<uint64_t> _ticket_issued_count{0};
+		std::atomic<uint64_t> _ticket_resumed_count{0};
+		std::atomic<uint64_t> _ticket_renewed_count{0};
+		std::atomic<uint64_t> _ticket_rejected_count{0};
+		std::atomic<uint64_t> _ticket_key_rotation_count{0};
+	};
+}  // namespace ov
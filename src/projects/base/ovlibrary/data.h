@@ -11,6 +11,7 @@
 #include "./string.h"
 #include "./assert.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./data.h"
 
 #include <memory>
@@ -213,10 +214,19 @@ namespace ov
 		/// @return true on success, false on failure
 		bool Detach();
 
+		// The buffer is allocated from MemoryPool to avoid malloc() for every packet
+		using Buffer = std::vector<uint8_t, PoolAllocator<uint8_t>>;
+
+		template <typename... Args>
+		static std::shared_ptr<Buffer> CreateBuffer(Args &&...args)
+		{
+			return AllocateShared<Buffer>(std::forward<Args>(args)...);
+		}
+
 		const void *_reference_data = nullptr;
 
 		// Allocated data. If this data is subdata, _current_data and _data can be different.
-		std::shared_ptr<std::vector<uint8_t>> _allocated_data = nullptr;
+		std::shared_ptr<Buffer> _allocated_data = nullptr;
 		// Offset from _allocated_data
 		off_t _offset = 0;
 
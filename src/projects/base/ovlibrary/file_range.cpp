@@ -0,0 +1,212 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "file_range.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+namespace ov
+{
+	FileHandle::FileHandle(int fd, const String &path, size_t size, time_t modified_time, ino_t inode)
+		: _fd(fd),
+		  _path(path),
+		  _size(size),
+		  _modified_time(modified_time),
+		  _inode(inode)
+	{
+	}
+
+	FileHandle::~FileHandle()
+	{
+		if (_fd >= 0)
+		{
+			::close(_fd);
+		}
+	}
+
+	std::shared_ptr<Data> FileRange::Read() const
+	{
+		if (file == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto data = std::make_shared<Data>(length);
+		data->SetLength(length);
+
+		auto buffer = data->GetWritableDataAs<uint8_t>();
+		size_t total_read_bytes = 0;
+
+		while (total_read_bytes < length)
+		{
+			auto read_bytes = ::pread(file->GetNativeHandle(), buffer + total_read_bytes, length - total_read_bytes, offset + total_read_bytes);
+
+			if (read_bytes < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return nullptr;
+			}
+
+			if (read_bytes == 0)
+			{
+				// The file is truncated
+				return nullptr;
+			}
+
+			total_read_bytes += read_bytes;
+		}
+
+		return data;
+	}
+
+	String FileRange::ToString() const
+	{
+		return String::FormatString("<FileRange: %s, offset: %jd, length: %zu>",
+									(file != nullptr) ? file->GetPath().CStr() : "(null)",
+									static_cast<intmax_t>(offset), length);
+	}
+
+	FileHandleCache *FileHandleCache::GetInstance()
+	{
+		static FileHandleCache *instance = new FileHandleCache();
+		return instance;
+	}
+
+	std::shared_ptr<const FileHandle> FileHandleCache::OpenFile(const String &path)
+	{
+		int fd = ::open(path.CStr(), O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat file_stat;
+
+		if ((::fstat(fd, &file_stat) != 0) || (S_ISREG(file_stat.st_mode) == false))
+		{
+			::close(fd);
+			return nullptr;
+		}
+
+		return std::make_shared<FileHandle>(fd, path, file_stat.st_size, file_stat.st_mtime, file_stat.st_ino);
+	}
+
+	std::shared_ptr<const FileHandle> FileHandleCache::Open(const String &path)
+	{
+		auto now = std::chrono::steady_clock::now();
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			auto item = _entries.find(path);
+
+			if (item != _entries.end())
+			{
+				auto &entry = item->second;
+
+				_lru_list.splice(_lru_list.begin(), _lru_list, entry.lru_iterator);
+
+				if ((now - entry.validated_time) < std::chrono::milliseconds(RevalidateIntervalMs))
+				{
+					return entry.file;
+				}
+
+				struct stat file_stat;
+
+				if ((::stat(path.CStr(), &file_stat) == 0) &&
+					(file_stat.st_ino == entry.file->GetInode()) &&
+					(static_cast<size_t>(file_stat.st_size) == entry.file->GetSize()) &&
+					(file_stat.st_mtime == entry.file->GetModifiedTime()))
+				{
+					entry.validated_time = now;
+					return entry.file;
+				}
+
+				// The file has been changed or deleted
+				_lru_list.erase(entry.lru_iterator);
+				_entries.erase(item);
+			}
+		}
+
+		// Open the file without the lock
+		auto file = OpenFile(path);
+
+		if (file == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _entries.find(path);
+
+		if (item != _entries.end())
+		{
+			// Another thread opened the same file
+			item->second.file = file;
+			item->second.validated_time = now;
+			_lru_list.splice(_lru_list.begin(), _lru_list, item->second.lru_iterator);
+
+			return file;
+		}
+
+		while (_entries.size() >= MaxCachedFileCount)
+		{
+			// The descriptor is closed when the last range using it is released
+			_entries.erase(_lru_list.back());
+			_lru_list.pop_back();
+		}
+
+		_lru_list.push_front(path);
+		_entries.emplace(path, Entry{file, now, _lru_list.begin()});
+
+		return file;
+	}
+
+	FileRange FileHandleCache::OpenRange(const String &path)
+	{
+		auto file = Open(path);
+
+		if (file == nullptr)
+		{
+			return {};
+		}
+
+		return FileRange(file, 0, file->GetSize());
+	}
+
+	void FileHandleCache::Remove(const String &path)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto item = _entries.find(path);
+
+		if (item != _entries.end())
+		{
+			_lru_list.erase(item->second.lru_iterator);
+			_entries.erase(item);
+		}
+	}
+
+	void FileHandleCache::Clear()
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		_entries.clear();
+		_lru_list.clear();
+	}
+}  // namespace ov
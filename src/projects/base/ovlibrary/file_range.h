@@ -0,0 +1,137 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <sys/types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "./data.h"
+#include "./string.h"
+
+namespace ov
+{
+	// Read-only file descriptor (closed when the last reference is released)
+	class FileHandle
+	{
+	public:
+		FileHandle(int fd, const String &path, size_t size, time_t modified_time, ino_t inode);
+		~FileHandle();
+
+		int GetNativeHandle() const
+		{
+			return _fd;
+		}
+
+		const String &GetPath() const
+		{
+			return _path;
+		}
+
+		size_t GetSize() const
+		{
+			return _size;
+		}
+
+		time_t GetModifiedTime() const
+		{
+			return _modified_time;
+		}
+
+		ino_t GetInode() const
+		{
+			return _inode;
+		}
+
+	protected:
+		int _fd = -1;
+		String _path;
+		size_t _size = 0;
+		time_t _modified_time = 0;
+		ino_t _inode = 0;
+	};
+
+	// A byte range of a file that can be sent without copying it to the user space (sendfile)
+	struct FileRange
+	{
+		FileRange() = default;
+		FileRange(const std::shared_ptr<const FileHandle> &file, off_t offset, size_t length)
+			: file(file),
+			  offset(offset),
+			  length(length)
+		{
+		}
+
+		bool IsValid() const
+		{
+			return file != nullptr;
+		}
+
+		// Skip the bytes that have been sent
+		FileRange Subrange(size_t skip_bytes) const
+		{
+			skip_bytes = std::min(skip_bytes, length);
+			return FileRange(file, offset + skip_bytes, length - skip_bytes);
+		}
+
+		// Read the range into the memory (used when the range cannot be sent with sendfile, such as TLS)
+		std::shared_ptr<Data> Read() const;
+
+		String ToString() const;
+
+		std::shared_ptr<const FileHandle> file;
+		off_t offset = 0;
+		size_t length = 0;
+	};
+
+	// Keeps the recently used files open to avoid open()/fstat()/close() for every request
+	//
+	// A cached file is revalidated with stat() after RevalidateIntervalMs, so a file that is replaced
+	// (another inode, size or mtime) is opened again.
+	class FileHandleCache
+	{
+	public:
+		static constexpr size_t MaxCachedFileCount = 256;
+		static constexpr int RevalidateIntervalMs = 1000;
+
+		// This instance is never destroyed, to allow the handles to be released during static destruction
+		static FileHandleCache *GetInstance();
+
+		std::shared_ptr<const FileHandle> Open(const String &path);
+
+		// Returns the whole file as a range
+		FileRange OpenRange(const String &path);
+
+		void Remove(const String &path);
+		void Clear();
+
+	protected:
+		struct Entry
+		{
+			std::shared_ptr<const FileHandle> file;
+			std::chrono::steady_clock::time_point validated_time;
+			// Position in _lru_list
+			std::list<String>::iterator lru_iterator;
+		};
+
+		FileHandleCache() = default;
+
+		static std::shared_ptr<const FileHandle> OpenFile(const String &path);
+
+		std::mutex _mutex;
+		std::unordered_map<String, Entry> _entries;
+		// The most recently used path is at the front
+		std::list<String> _lru_list;
+	};
+}  // namespace ov
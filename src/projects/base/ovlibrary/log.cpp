@@ -63,6 +63,21 @@ void ov_log_set_path(const char *log_path)
     g_log_internal.SetLogPath(log_path);
 }
 
+void ov_log_flush()
+{
+	ov::LogAsyncWriter::GetInstance()->Flush();
+}
+
+void ov_log_flush_from_signal_handler()
+{
+	ov::LogAsyncWriter::GetInstance()->FlushFromSignalHandler();
+}
+
+unsigned long long ov_log_get_drop_count()
+{
+	return ov::LogAsyncWriter::GetInstance()->GetDropCount();
+}
+
 void ov_stat_log_internal(StatLogType type, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...)
 {
 	// Getroot : Now, disable the temporarily created stat_log. (21-07-16)
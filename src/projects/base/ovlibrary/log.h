@@ -126,6 +126,14 @@ bool ov_log_get_enabled(const char *tag, OVLogLevel level);
 void ov_log_internal(OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 void ov_log_set_path(const char *log_path);
 
+/// Logs are written by a background thread. This function writes all queued logs synchronously.
+/// (e.g. before the process is terminated by a signal)
+void ov_log_flush();
+/// Same as ov_log_flush(), but it only uses async-signal-safe functions (the queued logs are written to stderr)
+void ov_log_flush_from_signal_handler();
+/// @returns Number of logs dropped because the log buffer of the thread was full
+unsigned long long ov_log_get_drop_count();
+
 void ov_stat_log_internal(StatLogType type, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, ...);
 void ov_stat_log_set_path(StatLogType type, const char *log_path);
 
@@ -0,0 +1,466 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "log_async_writer.h"
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "log_internal.h"
+#include "memory_utilities.h"
+#include "platform.h"
+
+// Maximum time to wait for the writer thread before writing the records by itself
+#define OV_LOG_WRITER_WAIT_INTERVAL_MS 50
+// Maximum time to wait for the writer thread in Flush()
+#define OV_LOG_FLUSH_TIMEOUT_MS 1000
+
+#define OV_LOG_ALIGN(x) (((x) + 7) & ~static_cast<size_t>(7))
+
+namespace ov
+{
+	namespace
+	{
+		// Used to detect that the signal handler is running on the writer thread
+		thread_local bool is_writer_thread = false;
+	}  // namespace
+
+	LogAsyncWriter::ThreadBuffer::ThreadBuffer()
+		: data(new uint8_t[OV_LOG_THREAD_BUFFER_SIZE])
+	{
+		thread_id = Platform::GetThreadId();
+		scratch.resize(1024);
+	}
+
+	LogAsyncWriter *LogAsyncWriter::GetInstance()
+	{
+		static LogAsyncWriter *instance = new LogAsyncWriter();
+		return instance;
+	}
+
+	LogAsyncWriter::LogAsyncWriter()
+	{
+	}
+
+	LogAsyncWriter::ThreadBuffer *LogAsyncWriter::GetThreadBuffer()
+	{
+		// Logs can be written by other thread_local destructors after the holder is destroyed.
+		// This flag has a trivial destructor, so it is still valid after the holder is destroyed.
+		static thread_local bool holder_destroyed = false;
+
+		// Mark the buffer as closed when the thread exits, so the writer thread can release it after writing the remaining records
+		struct ThreadBufferHolder
+		{
+			~ThreadBufferHolder()
+			{
+				holder_destroyed = true;
+
+				if (buffer != nullptr)
+				{
+					buffer->is_closed.store(true, std::memory_order_release);
+				}
+			}
+
+			std::shared_ptr<ThreadBuffer> buffer;
+		};
+
+		if (holder_destroyed)
+		{
+			// Never touch the holder after it is destroyed
+			return nullptr;
+		}
+
+		thread_local ThreadBufferHolder holder;
+
+		if (holder.buffer == nullptr)
+		{
+			holder.buffer = std::make_shared<ThreadBuffer>();
+
+			for (int index = 0; index < OV_LOG_MAX_SIGNAL_SAFE_BUFFERS; index++)
+			{
+				ThreadBuffer *expected = nullptr;
+
+				if (_signal_safe_buffers[index].compare_exchange_strong(expected, holder.buffer.get()))
+				{
+					holder.buffer->signal_safe_index = index;
+					break;
+				}
+			}
+
+			std::lock_guard lock_guard(_buffers_mutex);
+			_buffers.push_back(holder.buffer);
+		}
+
+		return holder.buffer.get();
+	}
+
+	void LogAsyncWriter::StartThreadIfNeeded()
+	{
+		std::call_once(_thread_once, [this]() {
+			_thread = std::thread(&LogAsyncWriter::ThreadProc, this);
+			::pthread_setname_np(_thread.native_handle(), "LogWriter");
+
+			// This instance is never destroyed, so the thread is terminated with the process
+			_thread.detach();
+		});
+	}
+
+	void LogAsyncWriter::WakeUp()
+	{
+		if (_wakeup.exchange(true, std::memory_order_acq_rel) == false)
+		{
+			_condition.notify_one();
+		}
+	}
+
+	bool LogAsyncWriter::Push(LogInternal *owner, bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list)
+	{
+		auto buffer = GetThreadBuffer();
+
+		if (buffer == nullptr)
+		{
+			return false;
+		}
+
+		StartThreadIfNeeded();
+
+		// Format the message into the scratch buffer first to know the length of the record
+		auto &scratch = buffer->scratch;
+
+		va_list copied_arg_list;
+		va_copy(copied_arg_list, arg_list);
+		int result = ::vsnprintf(scratch.data(), scratch.size(), format, copied_arg_list);
+		va_end(copied_arg_list);
+
+		size_t message_length = (result < 0) ? 0 : static_cast<size_t>(result);
+
+		if (message_length >= scratch.size())
+		{
+			scratch.resize(std::min<size_t>(message_length, OV_LOG_MAX_MESSAGE_LENGTH) + 1);
+			// arg_list must not be consumed here, because the caller uses it again if the record is not queued
+			va_copy(copied_arg_list, arg_list);
+			::vsnprintf(scratch.data(), scratch.size(), format, copied_arg_list);
+			va_end(copied_arg_list);
+
+			message_length = std::min(message_length, scratch.size() - 1);
+		}
+
+		const char *thread_name = Platform::GetThreadName();
+
+		size_t tag_length = ::strlen(tag);
+		size_t thread_name_length = ::strlen(thread_name);
+
+		size_t record_size = OV_LOG_ALIGN(sizeof(LogRecord) + tag_length + 1 + thread_name_length + 1 + message_length + 1);
+
+		// Reserve a contiguous space in the ring buffer
+		auto head = buffer->head.load(std::memory_order_relaxed);
+		auto tail = buffer->tail.load(std::memory_order_acquire);
+
+		size_t offset = head % buffer->capacity;
+		size_t padding_size = ((offset + record_size) > buffer->capacity) ? (buffer->capacity - offset) : 0;
+
+		if ((record_size + padding_size) > (buffer->capacity - (head - tail)))
+		{
+			// The ring buffer is full
+			if (level >= OVLogLevelError)
+			{
+				// Errors must not be lost - let the caller write it synchronously
+				WakeUp();
+				return false;
+			}
+
+			buffer->drop_count.fetch_add(1, std::memory_order_relaxed);
+			_total_drop_count.fetch_add(1, std::memory_order_relaxed);
+
+			WakeUp();
+			return true;
+		}
+
+		if (padding_size > 0)
+		{
+			auto padding = reinterpret_cast<LogRecord *>(buffer->data.get() + offset);
+
+			padding->size = padding_size;
+			padding->is_padding = true;
+
+			head += padding_size;
+			offset = 0;
+		}
+
+		auto record = reinterpret_cast<LogRecord *>(buffer->data.get() + offset);
+
+		record->size = record_size;
+		record->is_padding = false;
+		record->show_format = show_format;
+		record->level = level;
+		record->line = line;
+		record->sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+		record->owner = owner;
+		record->time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		record->thread_id = buffer->thread_id;
+		record->file = file;
+		record->method = method;
+		record->tag_length = tag_length;
+		record->thread_name_length = thread_name_length;
+		record->message_length = message_length;
+
+		auto strings = reinterpret_cast<char *>(record + 1);
+
+		::memcpy(strings, tag, tag_length + 1);
+		strings += tag_length + 1;
+		::memcpy(strings, thread_name, thread_name_length + 1);
+		strings += thread_name_length + 1;
+		::memcpy(strings, scratch.data(), message_length);
+		strings[message_length] = '\0';
+
+		buffer->head.store(head + record_size, std::memory_order_release);
+
+		// Debug/info logs are written periodically, but warnings and the buffer filling up wake the writer immediately
+		if ((level >= OVLogLevelWarning) || ((head + record_size - tail) > (buffer->capacity / 2)))
+		{
+			WakeUp();
+		}
+
+		return true;
+	}
+
+	void LogAsyncWriter::ThreadProc()
+	{
+		is_writer_thread = true;
+
+		while (true)
+		{
+			{
+				std::unique_lock lock(_wait_mutex);
+
+				_condition.wait_for(lock, std::chrono::milliseconds(OV_LOG_WRITER_WAIT_INTERVAL_MS), [this]() {
+					return _wakeup.load(std::memory_order_acquire);
+				});
+
+				_wakeup.store(false, std::memory_order_release);
+			}
+
+			std::lock_guard lock_guard(_drain_mutex);
+			DrainInternal();
+		}
+	}
+
+	void LogAsyncWriter::Flush()
+	{
+		std::unique_lock lock(_drain_mutex, std::defer_lock);
+
+		auto start = std::chrono::steady_clock::now();
+
+		while (lock.try_lock() == false)
+		{
+			if ((std::chrono::steady_clock::now() - start) > std::chrono::milliseconds(OV_LOG_FLUSH_TIMEOUT_MS))
+			{
+				// The writer thread may be stuck while writing records - write the buffers it does not own
+				DrainUnlocked();
+				return;
+			}
+
+			::usleep(1000);
+		}
+
+		DrainInternal();
+	}
+
+	void LogAsyncWriter::FlushFromSignalHandler()
+	{
+		constexpr const char *level_prefix[] = {"[D] ", "[I] ", "[W] ", "[E] ", "[C] "};
+
+		for (int index = 0; index < OV_LOG_MAX_SIGNAL_SAFE_BUFFERS; index++)
+		{
+			auto buffer = _signal_safe_buffers[index].load(std::memory_order_acquire);
+
+			if (buffer == nullptr)
+			{
+				continue;
+			}
+
+			// If the signal is raised on the writer thread while it is draining, the buffer is never released by it
+			if ((buffer->is_draining.exchange(true, std::memory_order_acq_rel)) && (is_writer_thread == false))
+			{
+				continue;
+			}
+
+			auto head = buffer->head.load(std::memory_order_acquire);
+			auto position = buffer->tail.load(std::memory_order_relaxed);
+
+			while (position < head)
+			{
+				auto record = reinterpret_cast<const LogRecord *>(buffer->data.get() + (position % buffer->capacity));
+
+				if (record->is_padding == false)
+				{
+					auto level = std::clamp(static_cast<int>(record->level), 0, static_cast<int>(OV_COUNTOF(level_prefix)) - 1);
+
+					iovec iov[] = {
+						{const_cast<char *>(level_prefix[level]), 4},
+						{const_cast<char *>(record->GetThreadName()), record->thread_name_length},
+						{const_cast<char *>(" | "), 3},
+						{const_cast<char *>(record->GetTag()), record->tag_length},
+						{const_cast<char *>(" | "), 3},
+						{const_cast<char *>(record->GetMessage()), record->message_length},
+						{const_cast<char *>("\n"), 1}};
+
+					[[maybe_unused]] auto result = ::writev(STDERR_FILENO, iov, OV_COUNTOF(iov));
+				}
+
+				position += record->size;
+			}
+
+			buffer->tail.store(head, std::memory_order_release);
+			buffer->is_draining.store(false, std::memory_order_release);
+		}
+	}
+
+	uint64_t LogAsyncWriter::GetDropCount() const
+	{
+		return _total_drop_count.load(std::memory_order_relaxed);
+	}
+
+	void LogAsyncWriter::DrainInternal()
+	{
+		{
+			std::lock_guard lock_guard(_buffers_mutex);
+			_drain_buffers = _buffers;
+		}
+
+		DrainBuffers(_drain_buffers, _drain_heads, _pending_records, _written_owners);
+
+		// Release the buffers of the terminated threads
+		{
+			std::lock_guard lock_guard(_buffers_mutex);
+
+			_buffers.erase(
+				std::remove_if(_buffers.begin(), _buffers.end(), [this](const std::shared_ptr<ThreadBuffer> &buffer) {
+					bool is_released = buffer->is_closed.load(std::memory_order_acquire) &&
+									   (buffer->is_draining.load(std::memory_order_acquire) == false) &&
+									   (buffer->tail.load(std::memory_order_relaxed) == buffer->head.load(std::memory_order_acquire));
+
+					if (is_released && (buffer->signal_safe_index >= 0))
+					{
+						_signal_safe_buffers[buffer->signal_safe_index].store(nullptr, std::memory_order_release);
+					}
+
+					return is_released;
+				}),
+				_buffers.end());
+		}
+
+		_drain_buffers.clear();
+	}
+
+	void LogAsyncWriter::DrainUnlocked()
+	{
+		// The writer thread may own _drain_buffers and the other reused vectors, so use local ones
+		std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+		std::vector<uint64_t> heads;
+		std::vector<PendingRecord> pending_records;
+		std::vector<LogInternal *> written_owners;
+
+		{
+			std::unique_lock lock(_buffers_mutex, std::try_to_lock);
+
+			if (lock.owns_lock() == false)
+			{
+				return;
+			}
+
+			buffers = _buffers;
+		}
+
+		DrainBuffers(buffers, heads, pending_records, written_owners);
+	}
+
+	void LogAsyncWriter::DrainBuffers(std::vector<std::shared_ptr<ThreadBuffer>> &buffers, std::vector<uint64_t> &heads,
+									  std::vector<PendingRecord> &pending_records, std::vector<LogInternal *> &written_owners)
+	{
+		// Skip the buffers that another thread is draining
+		buffers.erase(
+			std::remove_if(buffers.begin(), buffers.end(), [](const std::shared_ptr<ThreadBuffer> &buffer) {
+				return buffer->is_draining.exchange(true, std::memory_order_acq_rel);
+			}),
+			buffers.end());
+
+		heads.resize(buffers.size());
+		pending_records.clear();
+
+		// Collect the records of all threads
+		for (size_t index = 0; index < buffers.size(); index++)
+		{
+			auto &buffer = buffers[index];
+
+			auto head = buffer->head.load(std::memory_order_acquire);
+			auto position = buffer->tail.load(std::memory_order_relaxed);
+
+			heads[index] = head;
+
+			while (position < head)
+			{
+				auto record = reinterpret_cast<const LogRecord *>(buffer->data.get() + (position % buffer->capacity));
+
+				if (record->is_padding == false)
+				{
+					pending_records.push_back({record, buffer.get()});
+				}
+
+				position += record->size;
+			}
+		}
+
+		// Keep the order in which the logs were written
+		std::sort(pending_records.begin(), pending_records.end(), [](const PendingRecord &lhs, const PendingRecord &rhs) {
+			return lhs.record->sequence < rhs.record->sequence;
+		});
+
+		written_owners.clear();
+
+		for (auto &pending_record : pending_records)
+		{
+			auto record = pending_record.record;
+			auto buffer = pending_record.buffer;
+			auto owner = record->owner;
+
+			auto drop_count = buffer->drop_count.load(std::memory_order_relaxed);
+
+			if (drop_count != buffer->reported_drop_count)
+			{
+				owner->WriteDropWarning(*record, drop_count - buffer->reported_drop_count);
+				buffer->reported_drop_count = drop_count;
+			}
+
+			owner->WriteRecord(*record);
+
+			if (std::find(written_owners.begin(), written_owners.end(), owner) == written_owners.end())
+			{
+				written_owners.push_back(owner);
+			}
+		}
+
+		for (auto owner : written_owners)
+		{
+			owner->FlushFile();
+		}
+
+		pending_records.clear();
+
+		// Release the space of the records
+		for (size_t index = 0; index < buffers.size(); index++)
+		{
+			buffers[index]->tail.store(heads[index], std::memory_order_release);
+			buffers[index]->is_draining.store(false, std::memory_order_release);
+		}
+	}
+}  // namespace ov
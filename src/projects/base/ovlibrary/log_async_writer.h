@@ -0,0 +1,187 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "./log.h"
+
+// Size of the ring buffer allocated for each thread that writes logs
+#define OV_LOG_THREAD_BUFFER_SIZE (512 * 1024)
+// Messages longer than this are truncated
+#define OV_LOG_MAX_MESSAGE_LENGTH (128 * 1024)
+// Maximum number of thread buffers that can be written by FlushFromSignalHandler()
+#define OV_LOG_MAX_SIGNAL_SAFE_BUFFERS 4096
+
+namespace ov
+{
+	class LogInternal;
+
+	// A binary log record stored in the per-thread ring buffer
+	//
+	// Only the message is formatted by the calling thread (since the arguments may not be valid later),
+	// and the prefix (date/time, level, thread, tag, file) is formatted by the writer thread.
+	struct alignas(8) LogRecord
+	{
+		// Size of the record including the strings (aligned to 8 bytes)
+		uint32_t size;
+		// true if this record is used to skip the remaining space at the end of the ring buffer
+		bool is_padding;
+
+		bool show_format;
+		OVLogLevel level;
+		int line;
+
+		// Used to keep the order of the records written by multiple threads
+		uint64_t sequence;
+
+		LogInternal *owner;
+
+		// Milliseconds since epoch (system_clock)
+		int64_t time_ms;
+		uint64_t thread_id;
+
+		// __FILE__ and __PRETTY_FUNCTION__ are string literals, so only the pointers are stored
+		const char *file;
+		const char *method;
+
+		uint32_t tag_length;
+		uint32_t thread_name_length;
+		uint32_t message_length;
+
+		// <tag>\0<thread name>\0<message>\0 follow this header
+		const char *GetTag() const
+		{
+			return reinterpret_cast<const char *>(this + 1);
+		}
+
+		const char *GetThreadName() const
+		{
+			return GetTag() + tag_length + 1;
+		}
+
+		const char *GetMessage() const
+		{
+			return GetThreadName() + thread_name_length + 1;
+		}
+	};
+
+	// Collects log records from per-thread ring buffers and writes them on a background thread,
+	// so the threads that write logs are not blocked by the file/console I/O.
+	//
+	// If the ring buffer of a thread is full, the record is dropped and counted.
+	class LogAsyncWriter
+	{
+	public:
+		// This instance is never destroyed, to allow logs to be written during static destruction
+		static LogAsyncWriter *GetInstance();
+
+		// Returns false if the record cannot be queued (e.g. the thread is exiting, or the ring buffer is full for an error level record).
+		// In this case, the caller should write the log synchronously. Other records are dropped (counted) if the ring buffer is full.
+		bool Push(LogInternal *owner, bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list);
+
+		// Write all queued records synchronously
+		//
+		// It does not wait for the writer thread indefinitely. On timeout, only the buffers that the writer thread
+		// is not draining are written.
+		void Flush();
+
+		// Write the queued records to stderr using write(2) only (no lock, no allocation, no formatting),
+		// so it can be called from a signal handler. The records are written in the order of each thread.
+		void FlushFromSignalHandler();
+
+		// Total number of the records dropped because the ring buffer was full
+		uint64_t GetDropCount() const;
+
+	protected:
+		struct ThreadBuffer
+		{
+			ThreadBuffer();
+
+			std::unique_ptr<uint8_t[]> data;
+			size_t capacity = OV_LOG_THREAD_BUFFER_SIZE;
+
+			// Written by the owner thread
+			std::atomic<uint64_t> head{0};
+			// Written by the writer thread
+			std::atomic<uint64_t> tail{0};
+
+			std::atomic<uint64_t> drop_count{0};
+			// Used by the writer thread to report the drops once
+			uint64_t reported_drop_count = 0;
+
+			// The owner thread is terminated (The buffer is released after all records are written)
+			std::atomic<bool> is_closed{false};
+
+			// Set while a thread reads the records and moves the tail, so that the records are not written twice
+			std::atomic<bool> is_draining{false};
+
+			// Index of _signal_safe_buffers (-1 if there is no free slot)
+			int signal_safe_index = -1;
+
+			uint64_t thread_id = 0;
+
+			// Used by the owner thread to format the message
+			std::vector<char> scratch;
+		};
+
+		struct PendingRecord
+		{
+			const LogRecord *record;
+			ThreadBuffer *buffer;
+		};
+
+		LogAsyncWriter();
+
+		ThreadBuffer *GetThreadBuffer();
+
+		void StartThreadIfNeeded();
+		void WakeUp();
+		void ThreadProc();
+
+		// _drain_mutex must be locked
+		void DrainInternal();
+		// Called by Flush() on timeout, without _drain_mutex
+		void DrainUnlocked();
+		// Write the records of the buffers, and release the space of them.
+		// The buffers being drained by another thread are skipped.
+		void DrainBuffers(std::vector<std::shared_ptr<ThreadBuffer>> &buffers, std::vector<uint64_t> &heads,
+						  std::vector<PendingRecord> &pending_records, std::vector<LogInternal *> &written_owners);
+
+		std::mutex _buffers_mutex;
+		std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+
+		std::atomic<uint64_t> _sequence{0};
+		std::atomic<uint64_t> _total_drop_count{0};
+
+		std::once_flag _thread_once;
+		std::thread _thread;
+
+		std::mutex _wait_mutex;
+		std::condition_variable _condition;
+		std::atomic<bool> _wakeup{false};
+
+		std::mutex _drain_mutex;
+
+		// The buffers that can be accessed without a lock by FlushFromSignalHandler()
+		std::atomic<ThreadBuffer *> _signal_safe_buffers[OV_LOG_MAX_SIGNAL_SAFE_BUFFERS]{};
+
+		// Reused by DrainInternal() to avoid allocations
+		std::vector<std::shared_ptr<ThreadBuffer>> _drain_buffers;
+		std::vector<uint64_t> _drain_heads;
+		std::vector<PendingRecord> _pending_records;
+		std::vector<LogInternal *> _written_owners;
+	};
+}  // namespace ov
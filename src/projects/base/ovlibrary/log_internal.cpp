@@ -8,6 +8,7 @@
 //==============================================================================
 #include "log_internal.h"
 
+#include <cinttypes>
 #include <thread>
 
 #include "platform.h"
@@ -60,6 +61,9 @@ namespace ov
 
 	LogInternal::~LogInternal()
 	{
+		// Write the records queued before this instance is released
+		LogAsyncWriter::GetInstance()->Flush();
+
 		_released = true;
 	}
 
@@ -75,7 +79,7 @@ namespace ov
 			return;
 		}
 
-		std::lock_guard<std::mutex> lock(_mutex);
+		std::lock_guard<std::shared_mutex> lock(_mutex);
 
 		_enable_map.clear();
 		_enable_list.clear();
@@ -88,7 +92,29 @@ namespace ov
 			return false;
 		}
 
-		std::lock_guard<std::mutex> lock(_mutex);
+		auto is_enabled = [level](const EnableItem &item) -> bool {
+			if (level >= item.level)
+			{
+				// Returns whether the log level for the tag is activated
+				return item.is_enabled;
+			}
+
+			// Levels below level behave as opposed to being activated
+			return (item.is_enabled == false);
+		};
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_mutex);
+
+			auto item = _enable_map.find(tag);
+
+			if (item != _enable_map.cend())
+			{
+				return is_enabled(item->second);
+			}
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_mutex);
 
 		auto item = _enable_map.find(tag);
 
@@ -126,14 +152,7 @@ namespace ov
 			}
 		}
 
-		if (level >= item->second.level)
-		{
-			// Returns whether the log level for the tag is activated
-			return item->second.is_enabled;
-		}
-
-		// Levels below level behave as opposed to being activated
-		return (item->second.is_enabled == false);
+		return is_enabled(item->second);
 	}
 
 	bool LogInternal::SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled)
@@ -143,7 +162,7 @@ namespace ov
 			return false;
 		}
 
-		std::lock_guard<std::mutex> lock(_mutex);
+		std::lock_guard<std::shared_mutex> lock(_mutex);
 
 		_enable_map.clear();
 
@@ -202,6 +221,57 @@ namespace ov
 			return;
 		}
 
+		if (LogAsyncWriter::GetInstance()->Push(this, show_format, level, tag, file, line, method, format, arg_list))
+		{
+			return;
+		}
+
+		// The record cannot be queued (e.g. the thread is exiting, or an error while the buffer is full) - write the log synchronously
+		ov::String message;
+		message.AppendVFormat(format, arg_list);
+
+		Write(show_format, level, tag, file, line, method,
+			  std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count(),
+			  ov::Platform::GetThreadName(), ov::Platform::GetThreadId(), message.CStr());
+		FlushFile();
+	}
+
+	void LogInternal::WriteRecord(const LogRecord &record)
+	{
+		Write(record.show_format, record.level, record.GetTag(), record.file, record.line, record.method,
+			  record.time_ms, record.GetThreadName(), record.thread_id, record.GetMessage());
+	}
+
+	void LogInternal::WriteDropWarning(const LogRecord &record, uint64_t drop_count)
+	{
+		ov::String message;
+		message.Format("%" PRIu64 " log(s) of this thread were dropped because the log buffer was full", drop_count);
+
+		Write(record.show_format, OVLogLevelWarning, record.GetTag(), record.file, record.line, record.method,
+			  record.time_ms, record.GetThreadName(), record.thread_id, message.CStr());
+	}
+
+	void LogInternal::FlushFile()
+	{
+		if (_released)
+		{
+			return;
+		}
+
+		fflush(stdout);
+		fflush(stderr);
+
+		_log_file.Flush();
+	}
+
+	void LogInternal::Write(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method,
+							int64_t time_ms, const char *thread_name, uint64_t thread_id, const char *message)
+	{
+		if (_released)
+		{
+			return;
+		}
+
 		constexpr const char *log_level[] = {
 			"D",
 			"I",
@@ -223,12 +293,11 @@ namespace ov
 			OV_LOG_COLOR_RESET,
 			OV_LOG_COLOR_RESET};
 
-		// Obtain current time in milliseconds
-		auto current = std::chrono::system_clock::now();
-		auto mseconds = std::chrono::duration_cast<std::chrono::milliseconds>(current.time_since_epoch()).count() % 1000;
+		// Obtain the time when the log was written
+		auto mseconds = static_cast<int>(time_ms % 1000);
 
-		// Obtain current hours/minutes/seconds
-		std::time_t time = std::time(nullptr);
+		// Obtain hours/minutes/seconds
+		std::time_t time = static_cast<std::time_t>(time_ms / 1000);
 		std::tm local_time{};
 		::localtime_r(&time, &local_time);
 
@@ -269,9 +338,6 @@ namespace ov
 
 		if (show_format)
 		{
-			auto tid = ov::Platform::GetThreadId();
-			auto name = ov::Platform::GetThreadName();
-
 			// log format
 			//  [<date> <time>] <tag> <log level> <thread id> | <message>
 			log.Format(
@@ -315,8 +381,8 @@ namespace ov
 #endif	// DEBUG
 				local_time.tm_hour, local_time.tm_min, local_time.tm_sec, mseconds,
 				log_level[level],
-				name,
-				tid,
+				thread_name,
+				thread_id,
 				(tag[0] == '\0') ? "" : " ", tag
 
 #if OV_LOG_SHOW_FILE_NAME
@@ -331,22 +397,21 @@ namespace ov
 		}
 
 		// Append messages
-		log.AppendVFormat(format, arg_list);
+		log.Append(message);
 		if (show_format)
 		{
+			// Console and file are flushed by FlushFile()
 			if (level < OVLogLevelWarning)
 			{
 				fprintf(stdout, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stdout);
 			}
 			else
 			{
 				fprintf(stderr, "%s%s%s\n", color_prefix[level], log.CStr(), color_suffix[level]);
-				fflush(stderr);
 			}
 		}
 
-		_log_file.Write(log.CStr());
+		_log_file.Write(log.CStr(), time, false);
 	}
 
 	void LogInternal::SetLogPath(const char *log_path)
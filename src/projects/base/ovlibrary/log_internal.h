@@ -17,10 +17,12 @@
 #include <ctime>
 #include <mutex>
 #include <regex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "./assert.h"
 #include "./log.h"
+#include "./log_async_writer.h"
 #include "./log_write.h"
 #include "./string.h"
 
@@ -63,18 +65,29 @@ namespace ov
 		/// Example 4) If the level is info and is_enabled is true, ov::Log doesn't display the debug logs, and it displays the logs from information to critical level.
 		bool SetEnable(const char *tag_regex, OVLogLevel level, bool is_enabled);
 
+		// Only the message is formatted on the calling thread, and the record is written by LogAsyncWriter
 		void Log(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method, const char *format, va_list &arg_list);
 
 		void SetLogPath(const char *log_path);
 
+		// Called by LogAsyncWriter
+		void WriteRecord(const LogRecord &record);
+		// Called by LogAsyncWriter when some records of a thread are dropped before the record
+		void WriteDropWarning(const LogRecord &record, uint64_t drop_count);
+		void FlushFile();
+
 	protected:
+		void Write(bool show_format, OVLogLevel level, const char *tag, const char *file, int line, const char *method,
+				   int64_t time_ms, const char *thread_name, uint64_t thread_id, const char *message);
+
 		// This variable is used to avoid the problem of referencing incorrect heap if the log is written after LogInternal instance is released.
 		// This situation occurs when the LogInternal instance declared static is disabled just before the OME is terminated and then logs are written by another module.
 		bool _released = false;
 
 		OVLogLevel _level;
 
-		std::mutex _mutex;
+		// IsEnabled() is called for every log, so the cache is looked up with a shared lock
+		std::shared_mutex _mutex;
 
 		LogWrite _log_file;
 
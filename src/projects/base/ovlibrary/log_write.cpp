@@ -80,7 +80,7 @@ namespace ov
         _start_service = start_service;
     }
 
-    void LogWrite::Write(const char *log, std::time_t time)
+    void LogWrite::Write(const char *log, std::time_t time, bool flush)
     {
     	if(time == 0)
 		{
@@ -115,7 +115,17 @@ namespace ov
         }
 
         std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
-        _log_stream << log << std::endl;
+        _log_stream << log << '\n';
+
+        if (flush)
+        {
+            _log_stream.flush();
+        }
+    }
+
+    void LogWrite::Flush()
+    {
+        std::lock_guard<std::mutex> lock_guard(_log_stream_mutex);
         _log_stream.flush();
     }
 }
\ No newline at end of file
@@ -21,7 +21,9 @@ namespace ov
     public:
         LogWrite(std::string log_file_name, bool include_date_in_filename = false);
         virtual ~LogWrite() = default;
-        void Write(const char* log, std::time_t time = 0);
+        // If flush is false, the log is flushed when Flush() is called (used by the asynchronous writer to write logs in batches)
+        void Write(const char* log, std::time_t time = 0, bool flush = true);
+        void Flush();
         void SetLogPath(const char* log_path);
 
         static void SetAsService(bool start_service);
@@ -0,0 +1,321 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "memory_pool.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+
+// Maximum bytes kept in the global free list for each size class
+#define OV_MEMORY_POOL_MAX_CACHED_BYTES (32 * 1024 * 1024)
+// Maximum bytes kept in the per-thread cache for each size class
+#define OV_MEMORY_POOL_MAX_THREAD_CACHED_BYTES (256 * 1024)
+#define OV_MEMORY_POOL_MAX_THREAD_CACHED_COUNT 64
+
+namespace ov
+{
+	// Blocks can be freed by other thread_local destructors after ThreadCache is destroyed
+	static thread_local bool thread_cache_destroyed = false;
+
+	struct MemoryPool::ThreadCache
+	{
+		~ThreadCache()
+		{
+			thread_cache_destroyed = true;
+
+			// Return the cached blocks to the global free list when the thread exits
+			auto pool = MemoryPool::GetInstance();
+
+			for (size_t index = 0; index < SizeClassCount; index++)
+			{
+				pool->FreeToGlobal(pool->_size_classes[index], free_lists[index], 0);
+			}
+		}
+
+		std::vector<void *> free_lists[SizeClassCount];
+	};
+
+	MemoryPool *MemoryPool::GetInstance()
+	{
+		static MemoryPool *instance = new MemoryPool();
+		return instance;
+	}
+
+	MemoryPool::MemoryPool()
+	{
+		for (size_t index = 0; index < SizeClassCount; index++)
+		{
+			auto &size_class = _size_classes[index];
+
+			// Even index: power of two, odd index: 1.5 times of the previous power of two
+			size_t block_size = ((index % 2) == 0) ? (MinBlockSize << (index / 2)) : ((MinBlockSize * 3 / 2) << (index / 2));
+
+			size_class.block_size = block_size;
+			size_class.max_cached_count = std::max<size_t>(OV_MEMORY_POOL_MAX_CACHED_BYTES / block_size, 4);
+			size_class.max_thread_cached_count = std::min<size_t>(OV_MEMORY_POOL_MAX_THREAD_CACHED_BYTES / block_size, OV_MEMORY_POOL_MAX_THREAD_CACHED_COUNT);
+		}
+	}
+
+	int MemoryPool::GetSizeClassIndex(size_t size)
+	{
+		if (size > MaxBlockSize)
+		{
+			return -1;
+		}
+
+		if (size <= MinBlockSize)
+		{
+			return 0;
+		}
+
+		// The smallest power of two that is greater than or equal to size is (1 << shift)
+		int shift = 64 - __builtin_clzll(static_cast<unsigned long long>(size - 1));
+		int index = (shift - 6) * 2;
+
+		// Use 1.5 times of the previous power of two if it fits (65 => 96, 97 => 128, ...)
+		return (size <= (static_cast<size_t>(3) << (shift - 2))) ? (index - 1) : index;
+	}
+
+	MemoryPool::ThreadCache *MemoryPool::GetThreadCache()
+	{
+		if (thread_cache_destroyed)
+		{
+			return nullptr;
+		}
+
+		thread_local ThreadCache thread_cache;
+		return &thread_cache;
+	}
+
+	void *MemoryPool::Allocate(size_t size)
+	{
+		auto index = GetSizeClassIndex(size);
+
+		if (index < 0)
+		{
+			_large_class.allocation_count.fetch_add(1, std::memory_order_relaxed);
+			_large_class.system_allocation_count.fetch_add(1, std::memory_order_relaxed);
+			_large_class.in_use_count.fetch_add(1, std::memory_order_relaxed);
+
+			auto block = ::malloc(size);
+
+			if (block == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			return block;
+		}
+
+		auto &size_class = _size_classes[index];
+		auto thread_cache = GetThreadCache();
+		auto thread_free_list = (thread_cache != nullptr) ? &(thread_cache->free_lists[index]) : nullptr;
+
+		size_class.allocation_count.fetch_add(1, std::memory_order_relaxed);
+		size_class.in_use_count.fetch_add(1, std::memory_order_relaxed);
+
+		if ((thread_free_list != nullptr) && (thread_free_list->empty() == false))
+		{
+			auto block = thread_free_list->back();
+			thread_free_list->pop_back();
+
+			size_class.reuse_count.fetch_add(1, std::memory_order_relaxed);
+
+			return block;
+		}
+
+		return AllocateFromGlobal(size_class, thread_free_list);
+	}
+
+	void *MemoryPool::AllocateFromGlobal(SizeClass &size_class, std::vector<void *> *thread_free_list)
+	{
+		void *block = nullptr;
+
+		{
+			std::lock_guard lock_guard(size_class.free_list_mutex);
+
+			if (size_class.free_list.empty() == false)
+			{
+				block = size_class.free_list.back();
+				size_class.free_list.pop_back();
+
+				// Move some blocks to the per-thread cache to reduce lock contention
+				size_t move_count = 0;
+
+				if (thread_free_list != nullptr)
+				{
+					move_count = std::min(size_class.free_list.size(), size_class.max_thread_cached_count / 2);
+
+					thread_free_list->insert(thread_free_list->end(), size_class.free_list.end() - move_count, size_class.free_list.end());
+					size_class.free_list.resize(size_class.free_list.size() - move_count);
+				}
+
+				size_class.cached_count.fetch_sub(1 + move_count, std::memory_order_relaxed);
+				_cached_bytes.fetch_sub((1 + move_count) * size_class.block_size, std::memory_order_relaxed);
+			}
+		}
+
+		if (block != nullptr)
+		{
+			size_class.reuse_count.fetch_add(1, std::memory_order_relaxed);
+			return block;
+		}
+
+		size_class.system_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+		block = ::malloc(size_class.block_size);
+
+		if (block == nullptr)
+		{
+			size_class.in_use_count.fetch_sub(1, std::memory_order_relaxed);
+			throw std::bad_alloc();
+		}
+
+		return block;
+	}
+
+	void MemoryPool::Free(void *block, size_t size)
+	{
+		if (block == nullptr)
+		{
+			return;
+		}
+
+		auto index = GetSizeClassIndex(size);
+
+		if (index < 0)
+		{
+			_large_class.in_use_count.fetch_sub(1, std::memory_order_relaxed);
+			::free(block);
+			return;
+		}
+
+		auto &size_class = _size_classes[index];
+		auto thread_cache = GetThreadCache();
+
+		size_class.in_use_count.fetch_sub(1, std::memory_order_relaxed);
+
+		if (thread_cache == nullptr)
+		{
+			std::lock_guard lock_guard(size_class.free_list_mutex);
+
+			PushToGlobal(size_class, block);
+
+			return;
+		}
+
+		auto &thread_free_list = thread_cache->free_lists[index];
+
+		thread_free_list.push_back(block);
+
+		if (thread_free_list.size() > size_class.max_thread_cached_count)
+		{
+			// Keep the half of the per-thread cache, and return the others to the global free list
+			FreeToGlobal(size_class, thread_free_list, size_class.max_thread_cached_count / 2);
+		}
+	}
+
+	void MemoryPool::FreeToGlobal(SizeClass &size_class, std::vector<void *> &thread_free_list, size_t keep_count)
+	{
+		if (thread_free_list.size() <= keep_count)
+		{
+			return;
+		}
+
+		std::lock_guard lock_guard(size_class.free_list_mutex);
+
+		while (thread_free_list.size() > keep_count)
+		{
+			auto block = thread_free_list.back();
+			thread_free_list.pop_back();
+
+			PushToGlobal(size_class, block);
+		}
+	}
+
+	void MemoryPool::PushToGlobal(SizeClass &size_class, void *block)
+	{
+		if (size_class.free_list.size() < size_class.max_cached_count)
+		{
+			// Reserve the bytes first, so the concurrent frees of the other size classes can't exceed the limit together
+			auto cached_bytes = _cached_bytes.fetch_add(size_class.block_size, std::memory_order_relaxed) + size_class.block_size;
+
+			if (cached_bytes <= _max_cached_bytes.load(std::memory_order_relaxed))
+			{
+				size_class.free_list.push_back(block);
+				size_class.cached_count.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			_cached_bytes.fetch_sub(size_class.block_size, std::memory_order_relaxed);
+		}
+
+		// Too many blocks are cached - release it to the system
+		::free(block);
+	}
+
+	void MemoryPool::SetMaxCachedBytes(size_t max_cached_bytes)
+	{
+		_max_cached_bytes.store(max_cached_bytes, std::memory_order_relaxed);
+
+		// Release the blocks of the largest size classes first until the cached bytes fall below the limit
+		for (int index = SizeClassCount - 1; index >= 0; index--)
+		{
+			auto &size_class = _size_classes[index];
+			std::lock_guard lock_guard(size_class.free_list_mutex);
+
+			while ((size_class.free_list.empty() == false) && (_cached_bytes.load(std::memory_order_relaxed) > max_cached_bytes))
+			{
+				::free(size_class.free_list.back());
+				size_class.free_list.pop_back();
+
+				size_class.cached_count.fetch_sub(1, std::memory_order_relaxed);
+				_cached_bytes.fetch_sub(size_class.block_size, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	size_t MemoryPool::GetMaxCachedBytes() const
+	{
+		return _max_cached_bytes.load(std::memory_order_relaxed);
+	}
+
+	size_t MemoryPool::GetCachedBytes() const
+	{
+		return _cached_bytes.load(std::memory_order_relaxed);
+	}
+
+	std::vector<MemoryPool::Stats> MemoryPool::GetStats() const
+	{
+		std::vector<Stats> stats_list;
+
+		auto append_stats = [&](const SizeClass &size_class) {
+			Stats stats;
+
+			stats.block_size = size_class.block_size;
+			stats.allocation_count = size_class.allocation_count.load(std::memory_order_relaxed);
+			stats.reuse_count = size_class.reuse_count.load(std::memory_order_relaxed);
+			stats.system_allocation_count = size_class.system_allocation_count.load(std::memory_order_relaxed);
+			stats.in_use_count = size_class.in_use_count.load(std::memory_order_relaxed);
+			stats.cached_count = size_class.cached_count.load(std::memory_order_relaxed);
+
+			stats_list.push_back(stats);
+		};
+
+		for (const auto &size_class : _size_classes)
+		{
+			append_stats(size_class);
+		}
+
+		append_stats(_large_class);
+
+		return stats_list;
+	}
+}  // namespace ov
@@ -0,0 +1,153 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov
+{
+	// Size-class based memory pool
+	//
+	// A request is rounded up to the size class (MinBlockSize ~ MaxBlockSize, a power of two and 1.5 times of it, so at most 1/3 is wasted)
+	// and the freed block is recycled through a per-thread cache and a global free list of the size class,
+	// so steady-state streaming does not hit malloc(). Requests larger than MaxBlockSize are passed to malloc()/free() directly.
+	//
+	// The blocks in the global free lists are limited to SetMaxCachedBytes() in total, the others are released to the system.
+	//
+	// Because Free() requires the size that was passed to Allocate(), this pool is usually used through PoolAllocator.
+	class MemoryPool
+	{
+	public:
+		static constexpr size_t MinBlockSize = 64;
+		static constexpr size_t MaxBlockSize = 1024 * 1024;
+		// 64, 96, 128, 192, ..., 768K, 1M
+		static constexpr size_t SizeClassCount = 29;
+		static constexpr size_t DefaultMaxCachedBytes = 256 * 1024 * 1024;
+
+		struct Stats
+		{
+			// 0 means the blocks larger than MaxBlockSize
+			size_t block_size = 0;
+
+			// Number of Allocate() calls
+			uint64_t allocation_count = 0;
+			// Number of Allocate() calls served by the per-thread cache or the global free list
+			uint64_t reuse_count = 0;
+			// Number of blocks allocated from the system (malloc)
+			uint64_t system_allocation_count = 0;
+
+			// Number of blocks currently used
+			int64_t in_use_count = 0;
+			// Number of blocks kept in the global free list
+			int64_t cached_count = 0;
+		};
+
+		// This instance is never destroyed, to allow ov::Data to be released during static destruction
+		static MemoryPool *GetInstance();
+
+		void *Allocate(size_t size);
+		void Free(void *block, size_t size);
+
+		// Maximum bytes kept in the global free lists of all size classes (0: do not cache)
+		// If it is lower than the cached bytes, the exceeded blocks are released immediately.
+		void SetMaxCachedBytes(size_t max_cached_bytes);
+		size_t GetMaxCachedBytes() const;
+		size_t GetCachedBytes() const;
+
+		// The last item contains the stats of the blocks larger than MaxBlockSize
+		std::vector<Stats> GetStats() const;
+
+	protected:
+		struct alignas(64) SizeClass
+		{
+			size_t block_size = 0;
+			// Maximum number of blocks kept in the global free list
+			size_t max_cached_count = 0;
+			// Maximum number of blocks kept in the per-thread cache
+			size_t max_thread_cached_count = 0;
+
+			std::mutex free_list_mutex;
+			std::vector<void *> free_list;
+
+			std::atomic<uint64_t> allocation_count{0};
+			std::atomic<uint64_t> reuse_count{0};
+			std::atomic<uint64_t> system_allocation_count{0};
+			std::atomic<int64_t> in_use_count{0};
+			std::atomic<int64_t> cached_count{0};
+		};
+
+		struct ThreadCache;
+
+		MemoryPool();
+
+		static int GetSizeClassIndex(size_t size);
+
+		// Returns nullptr if the per-thread cache is already destroyed (while the thread is exiting)
+		static ThreadCache *GetThreadCache();
+
+		void *AllocateFromGlobal(SizeClass &size_class, std::vector<void *> *thread_free_list);
+		void FreeToGlobal(SizeClass &size_class, std::vector<void *> &thread_free_list, size_t keep_count);
+		// size_class.free_list_mutex must be locked
+		void PushToGlobal(SizeClass &size_class, void *block);
+
+		std::atomic<size_t> _max_cached_bytes{DefaultMaxCachedBytes};
+		std::atomic<size_t> _cached_bytes{0};
+
+		SizeClass _size_classes[SizeClassCount];
+		// For the blocks larger than MaxBlockSize
+		SizeClass _large_class;
+	};
+
+	// STL-compatible allocator that uses MemoryPool
+	template <typename T>
+	class PoolAllocator
+	{
+	public:
+		using value_type = T;
+
+		PoolAllocator() noexcept = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U> &) noexcept
+		{
+		}
+
+		T *allocate(size_t count)
+		{
+			return static_cast<T *>(MemoryPool::GetInstance()->Allocate(count * sizeof(T)));
+		}
+
+		void deallocate(T *block, size_t count) noexcept
+		{
+			MemoryPool::GetInstance()->Free(block, count * sizeof(T));
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U> &) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const PoolAllocator<U> &) const noexcept
+		{
+			return false;
+		}
+	};
+
+	// Same as std::make_shared(), but the object and the control block are allocated together from MemoryPool
+	template <typename T, typename... Args>
+	inline std::shared_ptr<T> AllocateShared(Args &&...args)
+	{
+		return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+	}
+}  // namespace ov
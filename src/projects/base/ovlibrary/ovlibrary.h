@@ -24,6 +24,7 @@
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
+#include "./memory_pool.h"
 #include "./map_utilities.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
@@ -31,9 +32,11 @@
 #include "./platform.h"
 #include "./queue.h"
 #include "./raii_ptr.h"
+#include "./reader_counter.h"
 #include "./random.h"
 #include "./regex.h"
 #include "./semaphore.h"
+#include "./sharded_hash_map.h"
 #include "./future.h"
 #include "./singleton.h"
 #include "./stack_trace.h"
@@ -45,3 +48,4 @@
 #include "./url.h"
 #include "./precise_timer.h"
 #include "./files.h"
+#include "./file_range.h"
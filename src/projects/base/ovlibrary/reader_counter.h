@@ -0,0 +1,69 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+namespace ov
+{
+	// Tracks the readers of a structure that is replaced by a writer and read without a lock
+	//
+	// A reader enters a ReadSection before it loads the pointer of the structure and leaves it when done.
+	// After replacing the pointer, the writer calls Synchronize() to wait until the readers that may still
+	// use the old structure have left, and then deletes it.
+	//
+	// Synchronize() must not be called in a ReadSection of the same counter (it would wait for itself).
+	class ReaderCounter
+	{
+	public:
+		class ReadSection
+		{
+		public:
+			explicit ReadSection(const ReaderCounter &counter)
+				: _readers(counter._readers[counter._phase.load() & 1])
+			{
+				_readers.fetch_add(1);
+			}
+
+			~ReadSection()
+			{
+				_readers.fetch_sub(1);
+			}
+
+			ReadSection(const ReadSection &) = delete;
+			ReadSection &operator=(const ReadSection &) = delete;
+
+		private:
+			std::atomic<int32_t> &_readers;
+		};
+
+		// Waits until the readers that entered before this call have left
+		//
+		// A reader registers in _readers[phase & 1] before it loads the pointer. Flipping the phase twice and
+		// waiting for the counter of the previous phase each time covers a reader that loaded the phase
+		// just before a flip but is counted after it.
+		void Synchronize()
+		{
+			for (int i = 0; i < 2; i++)
+			{
+				auto previous_phase = _phase.fetch_xor(1);
+
+				while (_readers[previous_phase & 1].load() != 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+	private:
+		std::atomic<uint32_t> _phase{0};
+		mutable std::atomic<int32_t> _readers[2]{{0}, {0}};
+	};
+}  // namespace ov
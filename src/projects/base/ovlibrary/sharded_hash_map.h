@@ -0,0 +1,368 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "./reader_counter.h"
+
+namespace ov
+{
+	// A hash map for lookup-heavy tables (e.g. per-packet session lookup)
+	//
+	// Entries are spread over Tshard_count shards. Each shard is an immutable open-addressing table (linear probing)
+	// that is replaced by a writer under the mutex of the shard, so readers never take a lock:
+	// they register in the reader counter of the shard, load the raw pointer of the current table and probe it.
+	//
+	// A replaced table is deleted by the writer after the readers that may still use it have left
+	// (see ov::ReaderCounter).
+	//
+	// Writes copy the table of one shard, so they cost O(size / Tshard_count).
+	// Use this only if lookups are much more frequent than insertions and removals.
+	template <typename Tkey, typename Tvalue, typename Thash = std::hash<Tkey>, size_t Tshard_count = 64>
+	class ShardedHashMap
+	{
+		static_assert((Tshard_count & (Tshard_count - 1)) == 0, "Tshard_count must be a power of 2");
+
+	public:
+		ShardedHashMap()
+		{
+			for (auto &shard : _shards)
+			{
+				shard.table = new Table();
+			}
+		}
+
+		~ShardedHashMap()
+		{
+			for (auto &shard : _shards)
+			{
+				delete shard.table.load();
+			}
+		}
+
+		ShardedHashMap(const ShardedHashMap &) = delete;
+		ShardedHashMap &operator=(const ShardedHashMap &) = delete;
+
+		std::optional<Tvalue> Find(const Tkey &key) const
+		{
+			auto hash = GetHash(key);
+			auto &shard = GetShard(hash);
+
+			ReadGuard read_guard(shard);
+			auto slot = read_guard.GetTable()->Find(key, hash);
+
+			if (slot != nullptr)
+			{
+				return slot->value;
+			}
+
+			return std::nullopt;
+		}
+
+		bool Contains(const Tkey &key) const
+		{
+			return Find(key).has_value();
+		}
+
+		// Returns false if the key already exists
+		bool Insert(const Tkey &key, const Tvalue &value)
+		{
+			auto hash = GetHash(key);
+			auto &shard = GetShard(hash);
+
+			std::lock_guard<std::mutex> lock_guard(shard.mutex);
+			auto table = shard.table.load(std::memory_order_relaxed);
+
+			if (table->Find(key, hash) != nullptr)
+			{
+				return false;
+			}
+
+			auto new_table = new Table(*table, table->count + 1);
+			new_table->Insert(key, value, hash);
+
+			shard.Replace(new_table);
+			_size++;
+
+			return true;
+		}
+
+		// Returns false if the key does not exist
+		bool Erase(const Tkey &key)
+		{
+			auto hash = GetHash(key);
+			auto &shard = GetShard(hash);
+
+			std::lock_guard<std::mutex> lock_guard(shard.mutex);
+
+			if (shard.table.load(std::memory_order_relaxed)->Find(key, hash) == nullptr)
+			{
+				return false;
+			}
+
+			EraseIf(shard, [&](const Slot &slot) -> bool {
+				return (slot.hash == hash) && (slot.key == key);
+			});
+
+			return true;
+		}
+
+		// Removes all entries for which filter() returns true
+		void EraseIf(const std::function<bool(const Tkey &key, const Tvalue &value)> &filter)
+		{
+			for (auto &shard : _shards)
+			{
+				std::lock_guard<std::mutex> lock_guard(shard.mutex);
+
+				EraseIf(shard, [&](const Slot &slot) -> bool {
+					return filter(slot.key, slot.value);
+				});
+			}
+		}
+
+		// Iterates the tables as they were when each shard was visited
+		//
+		// The entries of each shard are copied before calling callback(), so callback() may modify the map
+		void ForEach(const std::function<void(const Tkey &key, const Tvalue &value)> &callback) const
+		{
+			std::vector<std::pair<Tkey, Tvalue>> entries;
+
+			for (auto &shard : _shards)
+			{
+				entries.clear();
+
+				{
+					ReadGuard read_guard(shard);
+
+					for (const auto &slot : read_guard.GetTable()->slots)
+					{
+						if (slot.occupied)
+						{
+							entries.emplace_back(slot.key, slot.value);
+						}
+					}
+				}
+
+				for (const auto &[key, value] : entries)
+				{
+					callback(key, value);
+				}
+			}
+		}
+
+		size_t Size() const
+		{
+			return _size;
+		}
+
+		void Clear()
+		{
+			for (auto &shard : _shards)
+			{
+				std::lock_guard<std::mutex> lock_guard(shard.mutex);
+
+				_size -= shard.table.load(std::memory_order_relaxed)->count;
+				shard.Replace(new Table());
+			}
+		}
+
+	private:
+		struct Slot
+		{
+			bool occupied = false;
+			size_t hash = 0;
+			Tkey key{};
+			Tvalue value{};
+		};
+
+		struct Table
+		{
+			Table()
+			{
+			}
+
+			// Creates a table that holds the entries of other and has room for count entries
+			Table(const Table &other, size_t count)
+			{
+				// Keep the load factor at or below 0.5
+				size_t capacity = 8;
+				while (capacity < count * 2)
+				{
+					capacity <<= 1;
+				}
+
+				slots.resize(capacity);
+
+				for (const auto &slot : other.slots)
+				{
+					if (slot.occupied)
+					{
+						Insert(slot.key, slot.value, slot.hash);
+					}
+				}
+			}
+
+			const Slot *Find(const Tkey &key, size_t hash) const
+			{
+				if (slots.empty())
+				{
+					return nullptr;
+				}
+
+				auto mask = slots.size() - 1;
+
+				for (auto index = hash & mask;; index = (index + 1) & mask)
+				{
+					auto &slot = slots[index];
+
+					if (slot.occupied == false)
+					{
+						return nullptr;
+					}
+
+					if ((slot.hash == hash) && (slot.key == key))
+					{
+						return &slot;
+					}
+				}
+			}
+
+			void Insert(const Tkey &key, const Tvalue &value, size_t hash)
+			{
+				auto mask = slots.size() - 1;
+				auto index = hash & mask;
+
+				while (slots[index].occupied)
+				{
+					index = (index + 1) & mask;
+				}
+
+				auto &slot = slots[index];
+				slot.occupied = true;
+				slot.hash = hash;
+				slot.key = key;
+				slot.value = value;
+
+				count++;
+			}
+
+			std::vector<Slot> slots;
+			size_t count = 0;
+		};
+
+		struct alignas(64) Shard
+		{
+			// Must be called with the mutex held
+			void Replace(const Table *new_table)
+			{
+				auto old_table = table.exchange(new_table);
+
+				readers.Synchronize();
+
+				delete old_table;
+			}
+
+			// Serializes the writers
+			std::mutex mutex;
+			std::atomic<const Table *> table{nullptr};
+
+			ReaderCounter readers;
+		};
+
+		// Keeps the table of the shard alive while it is read
+		class ReadGuard
+		{
+		public:
+			explicit ReadGuard(const Shard &shard)
+				: _read_section(shard.readers)
+			{
+				_table = shard.table.load();
+			}
+
+			ReadGuard(const ReadGuard &) = delete;
+			ReadGuard &operator=(const ReadGuard &) = delete;
+
+			const Table *GetTable() const
+			{
+				return _table;
+			}
+
+		private:
+			ReaderCounter::ReadSection _read_section;
+			const Table *_table = nullptr;
+		};
+
+		static size_t GetHash(const Tkey &key)
+		{
+			// Mix the bits (splitmix64 finalizer), since std::hash of an integer is the identity,
+			// and both the shard index and the slot index are taken from the hash
+			uint64_t hash = Thash()(key);
+
+			hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+			hash = hash ^ (hash >> 31);
+
+			return static_cast<size_t>(hash);
+		}
+
+		// The shard index is taken from the upper bits, and the slot index from the lower bits
+		Shard &GetShard(size_t hash)
+		{
+			return _shards[(hash >> 48) & (Tshard_count - 1)];
+		}
+
+		const Shard &GetShard(size_t hash) const
+		{
+			return _shards[(hash >> 48) & (Tshard_count - 1)];
+		}
+
+		// Must be called with the mutex of the shard held
+		void EraseIf(Shard &shard, const std::function<bool(const Slot &slot)> &filter)
+		{
+			auto table = shard.table.load(std::memory_order_relaxed);
+			std::vector<const Slot *> remaining_slots;
+
+			for (const auto &slot : table->slots)
+			{
+				if (slot.occupied && (filter(slot) == false))
+				{
+					remaining_slots.push_back(&slot);
+				}
+			}
+
+			auto removed_count = table->count - remaining_slots.size();
+			if (removed_count == 0)
+			{
+				return;
+			}
+
+			// Rebuild the table instead of leaving tombstones, so the probe sequences stay short
+			auto new_table = remaining_slots.empty() ? new Table() : new Table(Table(), remaining_slots.size());
+
+			for (auto slot : remaining_slots)
+			{
+				new_table->Insert(slot->key, slot->value, slot->hash);
+			}
+
+			// remaining_slots point into the old table, which is deleted here
+			shard.Replace(new_table);
+			_size -= removed_count;
+		}
+
+		Shard _shards[Tshard_count];
+		std::atomic<size_t> _size{0};
+	};
+}  // namespace ov
@@ -16,21 +16,35 @@ namespace ov
 	class Zip
 	{
 	public:
-		static std::shared_ptr<ov::Data> CompressGzip(const std::shared_ptr<ov::Data> &input)
+		// A part of a gzip member compressed independently (raw deflate ending with a sync flush)
+		//
+		// Pieces can be compressed once and joined with other pieces (e.g. a query string that differs for each request)
+		// by JoinGzip() without compressing the whole data again.
+		struct DeflatePiece
 		{
-			auto output = std::make_shared<ov::Data>(input->GetLength());
-			output->SetLength(input->GetLength());
+			std::shared_ptr<const ov::Data> data;
+			// CRC-32 and length of the uncompressed data
+			uLong crc = 0;
+			size_t length = 0;
+		};
 
+		static std::shared_ptr<ov::Data> CompressGzip(const std::shared_ptr<const ov::Data> &input)
+		{
 			z_stream zs;
 			zs.zalloc = Z_NULL;
 			zs.zfree = Z_NULL;
 			zs.opaque = Z_NULL;
+
+			deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
+
+			auto output = std::make_shared<ov::Data>(deflateBound(&zs, input->GetLength()));
+			output->SetLength(output->GetCapacity());
+
 			zs.avail_in = (uInt)input->GetLength();
 			zs.next_in = (Bytef *)input->GetDataAs<Bytef>();
 			zs.avail_out = (uInt)output->GetLength();
-			zs.next_out = (Bytef *)output->GetWritableDataAs<Bytef>();;
+			zs.next_out = (Bytef *)output->GetWritableDataAs<Bytef>();
 
-			deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
 			deflate(&zs, Z_FINISH);
 			deflateEnd(&zs);
 
@@ -38,6 +52,84 @@ namespace ov
 			return output;
 		}
 
+		static DeflatePiece CompressDeflatePiece(const void *input, size_t length)
+		{
+			DeflatePiece piece;
+
+			z_stream zs;
+			zs.zalloc = Z_NULL;
+			zs.zfree = Z_NULL;
+			zs.opaque = Z_NULL;
+
+			// Raw deflate (no header/trailer), since the pieces are joined into one gzip member
+			deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+
+			// deflateBound() assumes Z_FINISH - a sync flush adds an empty stored block (up to 5 bytes) and alignment
+			auto output = std::make_shared<ov::Data>(deflateBound(&zs, length) + 16);
+			output->SetLength(output->GetCapacity());
+
+			zs.avail_in = (uInt)length;
+			zs.next_in = (Bytef *)input;
+			zs.avail_out = (uInt)output->GetLength();
+			zs.next_out = (Bytef *)output->GetWritableDataAs<Bytef>();
+
+			// Z_SYNC_FLUSH ends the piece on a byte boundary without the last block flag, so another piece can follow it
+			deflate(&zs, Z_SYNC_FLUSH);
+			deflateEnd(&zs);
+
+			output->SetLength(zs.total_out);
+
+			piece.data = output;
+			piece.crc = crc32(crc32(0L, Z_NULL, 0), (const Bytef *)input, (uInt)length);
+			piece.length = length;
+
+			return piece;
+		}
+
+		// Make a gzip member from the pieces in order
+		static std::shared_ptr<ov::Data> JoinGzip(const std::vector<const DeflatePiece *> &pieces)
+		{
+			// ID1, ID2, CM(deflate), FLG, MTIME(4), XFL, OS(unix)
+			static constexpr uint8_t header[] = {0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03};
+			// An empty fixed Huffman block with the last block flag
+			static constexpr uint8_t last_block[] = {0x03, 0x00};
+
+			size_t compressed_length = sizeof(header) + sizeof(last_block) + 8;
+
+			for (auto piece : pieces)
+			{
+				compressed_length += piece->data->GetLength();
+			}
+
+			auto output = std::make_shared<ov::Data>(compressed_length);
+
+			output->Append(header, sizeof(header));
+
+			uLong crc = crc32(0L, Z_NULL, 0);
+			uint32_t length = 0;
+
+			for (auto piece : pieces)
+			{
+				output->Append(piece->data);
+
+				crc = crc32_combine(crc, piece->crc, piece->length);
+				length += static_cast<uint32_t>(piece->length);
+			}
+
+			output->Append(last_block, sizeof(last_block));
+
+			// CRC32 and ISIZE (little endian)
+			uint8_t trailer[8];
+			for (int index = 0; index < 4; index++)
+			{
+				trailer[index] = static_cast<uint8_t>((crc >> (index * 8)) & 0xFF);
+				trailer[4 + index] = static_cast<uint8_t>((length >> (index * 8)) & 0xFF);
+			}
+			output->Append(trailer, sizeof(trailer));
+
+			return output;
+		}
+
 		static std::shared_ptr<ov::Data> DecompressGzip(const std::shared_ptr<ov::Data> &input)
 		{
 			return nullptr;
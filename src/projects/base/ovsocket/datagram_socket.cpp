@@ -9,6 +9,8 @@
 
 #include "datagram_socket.h"
 
+#include <netinet/udp.h>
+
 #include "client_socket.h"
 #include "socket_private.h"
 
@@ -23,8 +25,520 @@
 #define logae(format, ...) logte("[%p] " format, this, ##__VA_ARGS__)
 #define logac(format, ...) logtc("[%p] " format, this, ##__VA_ARGS__)
 
+#ifndef SOL_UDP
+#	define SOL_UDP 17
+#endif	// SOL_UDP
+
+#ifndef UDP_SEGMENT
+#	define UDP_SEGMENT 103
+#endif	// UDP_SEGMENT
+
+// Flush the batch early if too many datagrams are accumulated
+#define OV_DATAGRAM_BATCH_MAX_COUNT 1024
+#define OV_DATAGRAM_BATCH_MAX_BYTES (4 * 1024 * 1024)
+
+// Limits of UDP_SEGMENT (UDP_MAX_SEGMENTS of the kernel, and the maximum size of an UDP payload)
+#define OV_DATAGRAM_GSO_MAX_SEGMENTS 64
+#define OV_DATAGRAM_GSO_MAX_BYTES 65000
+
 namespace ov
 {
+	namespace
+	{
+		struct BatchEntry
+		{
+			// Index of BatchContext::sockets
+			size_t socket_index;
+
+			bool has_local_address;
+			sockaddr_storage local_address;
+			sockaddr_storage remote_address;
+			socklen_t remote_address_length;
+
+			// The datagram is sent from the buffer of the caller without copying it
+			std::shared_ptr<const Data> data;
+			size_t length;
+		};
+
+		struct BatchMessage
+		{
+			// Range of BatchContext::entries contained in this message (more than 1 if GSO is used)
+			size_t first_entry;
+			size_t entry_count;
+
+			bool use_gso;
+		};
+
+		struct alignas(cmsghdr) BatchControl
+		{
+			uint8_t data[CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t))];
+		};
+
+		struct BatchContext
+		{
+			int depth = 0;
+
+			std::vector<std::shared_ptr<Socket>> sockets;
+			std::vector<BatchEntry> entries;
+			// Total bytes of the entries
+			size_t total_bytes = 0;
+
+			// Temporary buffers used in FlushBatch() - they are reused to avoid allocations
+			std::vector<size_t> socket_entries;
+			std::vector<BatchMessage> messages;
+			std::vector<mmsghdr> headers;
+			std::vector<iovec> iovecs;
+			std::vector<BatchControl> controls;
+		};
+
+		thread_local BatchContext batch_context;
+
+		// Disabled when the kernel/NIC does not support UDP_SEGMENT
+		std::atomic<bool> gso_available{true};
+
+		std::atomic<uint64_t> batch_datagram_count{0};
+		std::atomic<uint64_t> batch_syscall_count{0};
+		std::atomic<uint64_t> batch_gso_message_count{0};
+		std::atomic<uint64_t> batch_gso_segment_count{0};
+
+		bool IsSameDestination(const BatchEntry &entry1, const BatchEntry &entry2)
+		{
+			return (entry1.socket_index == entry2.socket_index) &&
+				   (entry1.has_local_address == entry2.has_local_address) &&
+				   (entry1.remote_address_length == entry2.remote_address_length) &&
+				   (::memcmp(&entry1.remote_address, &entry2.remote_address, entry1.remote_address_length) == 0) &&
+				   ((entry1.has_local_address == false) || (::memcmp(&entry1.local_address, &entry2.local_address, sizeof(entry1.local_address)) == 0));
+		}
+
+		size_t FillPktInfo(cmsghdr *cmsg, SocketFamily family, const sockaddr_storage &local_address)
+		{
+			switch (family)
+			{
+				case SocketFamily::Inet: {
+					in_pktinfo pktinfo{};
+					pktinfo.ipi_spec_dst = reinterpret_cast<const sockaddr_in *>(&local_address)->sin_addr;
+
+					cmsg->cmsg_level = IPPROTO_IP;
+					cmsg->cmsg_type = IP_PKTINFO;
+					cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+					::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+					return CMSG_SPACE(sizeof(pktinfo));
+				}
+
+				case SocketFamily::Inet6: {
+					in6_pktinfo pktinfo{};
+					pktinfo.ipi6_addr = reinterpret_cast<const sockaddr_in6 *>(&local_address)->sin6_addr;
+
+					cmsg->cmsg_level = IPPROTO_IPV6;
+					cmsg->cmsg_type = IPV6_PKTINFO;
+					cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+					::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+					return CMSG_SPACE(sizeof(pktinfo));
+				}
+
+				case SocketFamily::Unknown:
+					break;
+			}
+
+			return 0;
+		}
+	}  // namespace
+
+	DatagramSocket::Batch::Batch()
+	{
+		batch_context.depth++;
+	}
+
+	DatagramSocket::Batch::~Batch()
+	{
+		batch_context.depth--;
+
+		if (batch_context.depth == 0)
+		{
+			Flush();
+		}
+	}
+
+	void DatagramSocket::Batch::Flush()
+	{
+		DatagramSocket::FlushBatch();
+	}
+
+	bool DatagramSocket::AppendToBatch(Socket *socket, const SocketAddress *local_address, const SocketAddress &remote_address, const std::shared_ptr<const Data> &data)
+	{
+		auto &context = batch_context;
+
+		if (context.depth == 0)
+		{
+			return false;
+		}
+
+		auto length = data->GetLength();
+
+		if (length == 0L)
+		{
+			// Nothing to send
+			return true;
+		}
+
+		if ((context.entries.size() >= OV_DATAGRAM_BATCH_MAX_COUNT) ||
+			((context.total_bytes + length) > OV_DATAGRAM_BATCH_MAX_BYTES))
+		{
+			FlushBatch();
+		}
+
+		// Find the socket from the last entry first, since datagrams are usually sent through the same socket
+		size_t socket_index = context.sockets.size();
+
+		if ((context.entries.empty() == false) && (context.sockets[context.entries.back().socket_index].get() == socket))
+		{
+			socket_index = context.entries.back().socket_index;
+		}
+		else
+		{
+			for (size_t index = 0; index < context.sockets.size(); index++)
+			{
+				if (context.sockets[index].get() == socket)
+				{
+					socket_index = index;
+					break;
+				}
+			}
+
+			if (socket_index == context.sockets.size())
+			{
+				context.sockets.push_back(socket->GetSharedPtr());
+			}
+		}
+
+		auto &entry = context.entries.emplace_back();
+
+		entry.socket_index = socket_index;
+		entry.has_local_address = (local_address != nullptr);
+		if (entry.has_local_address)
+		{
+			::memcpy(&entry.local_address, local_address->ToSockAddr(), sizeof(entry.local_address));
+		}
+		::memcpy(&entry.remote_address, remote_address.ToSockAddr(), sizeof(entry.remote_address));
+		entry.remote_address_length = remote_address.GetSockAddrInLength();
+
+		entry.data = data;
+		entry.length = length;
+
+		context.total_bytes += length;
+
+		return true;
+	}
+
+	bool DatagramSocket::AppendToBatch(Socket *socket, const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data)
+	{
+		return AppendToBatch(socket, &(address_pair.GetLocalAddress()), address_pair.GetRemoteAddress(), data);
+	}
+
+	bool DatagramSocket::AppendToBatch(Socket *socket, const SocketAddress &address, const std::shared_ptr<const Data> &data)
+	{
+		return AppendToBatch(socket, nullptr, address, data);
+	}
+
+	void DatagramSocket::FlushBatch()
+	{
+		auto &context = batch_context;
+
+		if (context.entries.empty())
+		{
+			return;
+		}
+
+		BatchStats stats;
+
+		for (size_t socket_index = 0; socket_index < context.sockets.size(); socket_index++)
+		{
+			// Keep the order of datagrams for each socket
+			context.socket_entries.clear();
+
+			for (size_t entry_index = 0; entry_index < context.entries.size(); entry_index++)
+			{
+				if (context.entries[entry_index].socket_index == socket_index)
+				{
+					context.socket_entries.push_back(entry_index);
+				}
+			}
+
+			FlushBatch(context.sockets[socket_index].get(), &stats);
+		}
+
+		context.sockets.clear();
+		context.entries.clear();
+		context.total_bytes = 0;
+
+		if (stats.syscall_count > 0)
+		{
+			batch_datagram_count.fetch_add(stats.datagram_count, std::memory_order_relaxed);
+			batch_syscall_count.fetch_add(stats.syscall_count, std::memory_order_relaxed);
+			batch_gso_message_count.fetch_add(stats.gso_message_count, std::memory_order_relaxed);
+			batch_gso_segment_count.fetch_add(stats.gso_segment_count, std::memory_order_relaxed);
+		}
+	}
+
+	DatagramSocket::BatchStats DatagramSocket::GetBatchStats()
+	{
+		BatchStats stats;
+
+		stats.datagram_count = batch_datagram_count.load(std::memory_order_relaxed);
+		stats.syscall_count = batch_syscall_count.load(std::memory_order_relaxed);
+		stats.gso_message_count = batch_gso_message_count.load(std::memory_order_relaxed);
+		stats.gso_segment_count = batch_gso_segment_count.load(std::memory_order_relaxed);
+		stats.gso_available = gso_available.load(std::memory_order_relaxed);
+
+		return stats;
+	}
+
+	void DatagramSocket::BuildBatchMessages(Socket *socket, size_t first_socket_entry, bool use_gso)
+	{
+		auto &context = batch_context;
+		auto &entries = context.entries;
+		auto &socket_entries = context.socket_entries;
+
+		context.messages.clear();
+
+		// Group consecutive datagrams that have the same destination and size into a GSO message
+		for (size_t index = first_socket_entry; index < socket_entries.size();)
+		{
+			auto &first = entries[socket_entries[index]];
+			size_t count = 1;
+			size_t total_bytes = first.length;
+
+			if (use_gso)
+			{
+				while ((index + count) < socket_entries.size())
+				{
+					auto &prev = entries[socket_entries[index + count - 1]];
+					auto &next = entries[socket_entries[index + count]];
+
+					// Every segment must have the same size except the last one, which can be smaller
+					if ((count >= OV_DATAGRAM_GSO_MAX_SEGMENTS) ||
+						(prev.length != first.length) ||
+						(next.length > first.length) ||
+						((total_bytes + next.length) > OV_DATAGRAM_GSO_MAX_BYTES) ||
+						(IsSameDestination(first, next) == false))
+					{
+						break;
+					}
+
+					total_bytes += next.length;
+					count++;
+				}
+			}
+
+			context.messages.push_back({index, count, (count > 1)});
+
+			index += count;
+		}
+
+		// Fill the headers after all messages are determined, since the vectors can be reallocated while growing
+		auto message_count = context.messages.size();
+		auto iovec_count = socket_entries.size() - first_socket_entry;
+
+		context.headers.resize(message_count);
+		context.iovecs.resize(iovec_count);
+		context.controls.resize(message_count);
+
+		size_t iovec_index = 0;
+
+		for (size_t message_index = 0; message_index < message_count; message_index++)
+		{
+			auto &message = context.messages[message_index];
+			auto &header = context.headers[message_index];
+			auto &control = context.controls[message_index];
+			auto &first = entries[socket_entries[message.first_entry]];
+
+			auto iov = &(context.iovecs[iovec_index]);
+
+			for (size_t count = 0; count < message.entry_count; count++)
+			{
+				auto &entry = entries[socket_entries[message.first_entry + count]];
+
+				iov[count].iov_base = const_cast<void *>(entry.data->GetData());
+				iov[count].iov_len = entry.length;
+			}
+
+			iovec_index += message.entry_count;
+
+			::memset(&header, 0, sizeof(header));
+			header.msg_hdr.msg_name = &(first.remote_address);
+			header.msg_hdr.msg_namelen = first.remote_address_length;
+			header.msg_hdr.msg_iov = iov;
+			header.msg_hdr.msg_iovlen = message.entry_count;
+
+			size_t control_length = 0;
+			auto cmsg = reinterpret_cast<cmsghdr *>(control.data);
+
+			if (first.has_local_address)
+			{
+				control_length += FillPktInfo(cmsg, socket->_family, first.local_address);
+			}
+
+			if (message.use_gso)
+			{
+				auto gso_cmsg = reinterpret_cast<cmsghdr *>(control.data + control_length);
+				uint16_t segment_size = static_cast<uint16_t>(first.length);
+
+				gso_cmsg->cmsg_level = SOL_UDP;
+				gso_cmsg->cmsg_type = UDP_SEGMENT;
+				gso_cmsg->cmsg_len = CMSG_LEN(sizeof(segment_size));
+				::memcpy(CMSG_DATA(gso_cmsg), &segment_size, sizeof(segment_size));
+
+				control_length += CMSG_SPACE(sizeof(segment_size));
+			}
+
+			header.msg_hdr.msg_control = (control_length > 0) ? control.data : nullptr;
+			header.msg_hdr.msg_controllen = control_length;
+		}
+	}
+
+	void DatagramSocket::AppendBatchToDispatchQueue(Socket *socket, size_t first_socket_entry)
+	{
+		auto &context = batch_context;
+		auto &socket_entries = context.socket_entries;
+
+		for (size_t index = first_socket_entry; index < socket_entries.size(); index++)
+		{
+			auto &entry = context.entries[socket_entries[index]];
+			auto &data = entry.data;
+
+			SocketAddress remote_address("", entry.remote_address);
+
+			// Dispatch the commands only once at the end
+			bool dispatch_immediately = (index == (socket_entries.size() - 1));
+
+			if (entry.has_local_address)
+			{
+				socket->AppendCommand(
+					DispatchCommand(SocketAddressPair(SocketAddress("", entry.local_address), remote_address), data),
+					dispatch_immediately);
+			}
+			else
+			{
+				socket->AppendCommand(DispatchCommand(remote_address, data), dispatch_immediately);
+			}
+		}
+	}
+
+	void DatagramSocket::FlushBatch(Socket *socket, BatchStats *stats)
+	{
+		auto &context = batch_context;
+		auto &socket_entries = context.socket_entries;
+
+		if (socket_entries.empty())
+		{
+			return;
+		}
+
+		std::lock_guard lock_guard(socket->_dispatch_queue_lock);
+
+		if (socket->IsSendable() == false)
+		{
+			// Same as Socket::SendTo() returns false
+			return;
+		}
+
+		if (socket->HasCommand())
+		{
+			// Some data is waiting to be sent, so the batch must be sent after them to keep the order
+			AppendBatchToDispatchQueue(socket, 0);
+			return;
+		}
+
+		bool use_gso = gso_available.load(std::memory_order_relaxed);
+
+		BuildBatchMessages(socket, 0, use_gso);
+
+		const int socket_handle = socket->GetNativeHandle();
+		size_t message_index = 0;
+		bool sent = false;
+
+		while ((message_index < context.messages.size()) && (socket->_force_stop == false))
+		{
+			auto remaining = context.messages.size() - message_index;
+			auto result = ::sendmmsg(socket_handle, &(context.headers[message_index]), static_cast<unsigned int>(remaining), MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			stats->syscall_count++;
+
+			if (result > 0)
+			{
+				for (int index = 0; index < result; index++)
+				{
+					auto &sent_message = context.messages[message_index + index];
+
+					stats->datagram_count += sent_message.entry_count;
+
+					if (sent_message.use_gso)
+					{
+						stats->gso_message_count++;
+						stats->gso_segment_count += sent_message.entry_count;
+					}
+				}
+
+				message_index += result;
+				sent = true;
+
+				continue;
+			}
+
+			const auto error = Error::CreateErrorFromErrno();
+			auto &message = context.messages[message_index];
+
+			if ((error->GetCode() == EAGAIN) || (error->GetCode() == EWOULDBLOCK))
+			{
+				// Socket buffer is full - the rest will be sent later by SocketPoolWorker
+				AppendBatchToDispatchQueue(socket, message.first_entry);
+				break;
+			}
+
+			if (message.use_gso && ((error->GetCode() == EIO) || (error->GetCode() == EINVAL) || (error->GetCode() == ENOPROTOOPT) || (error->GetCode() == EOPNOTSUPP)))
+			{
+				// The kernel or the NIC does not support UDP_SEGMENT
+				if (gso_available.exchange(false))
+				{
+					logtw("UDP GSO is not available, datagrams will be sent without GSO: %s", error->What());
+				}
+
+				auto first_entry = message.first_entry;
+				BuildBatchMessages(socket, first_entry, false);
+				message_index = 0;
+				continue;
+			}
+
+			// Other errors are related to the destination (e.g. EHOSTUNREACH), so skip it and send the rest
+			switch (error->GetCode())
+			{
+				case EBADF:
+					// Socket is closed somewhere in OME
+					return;
+
+				case EPIPE:
+					[[fallthrough]];
+				case ECONNREFUSED:
+					[[fallthrough]];
+				case ECONNRESET:
+					break;
+
+				default:
+					logtw("[%p] Could not send %zu datagram(s) using sendmmsg(): %s", socket, message.entry_count, error->What());
+					break;
+			}
+
+			message_index++;
+		}
+
+		if (sent)
+		{
+			socket->UpdateLastSentTime();
+		}
+	}
+
 	bool DatagramSocket::Prepare(int port, DatagramCallback datagram_callback)
 	{
 		return Prepare(SocketAddress::CreateAndGetFirst(nullptr, port), std::move(datagram_callback));
@@ -50,6 +564,27 @@ namespace ov
 		return false;
 	}
 
+	bool DatagramSocket::Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback)
+	{
+		CHECK_STATE(== SocketState::Created, false);
+
+		if (
+			(
+				MakeNonBlocking(GetSharedPtrAs<ov::SocketAsyncInterface>()) &&
+				SetSockOpt<int>(SO_REUSEADDR, 1) &&
+				Bind(address)))
+		{
+			_datagram_batch_callback = std::move(datagram_batch_callback);
+			_received_datagrams.resize(UdpBatchCount);
+
+			return true;
+		}
+
+		Close();
+
+		return false;
+	}
+
 	bool DatagramSocket::CloseInternal(SocketState close_reason)
 	{
 		_callback = nullptr;
@@ -64,6 +599,18 @@ namespace ov
 	}
 
 	void DatagramSocket::OnReadable()
+	{
+		if (_datagram_batch_callback != nullptr)
+		{
+			ReadDatagramBatches();
+		}
+		else
+		{
+			ReadDatagrams();
+		}
+	}
+
+	void DatagramSocket::ReadDatagrams()
 	{
 		logtp("Trying to read UDP packets...");
 
@@ -99,6 +646,45 @@ namespace ov
 		}
 	}
 
+	void DatagramSocket::ReadDatagramBatches()
+	{
+		logtp("Trying to read UDP packets using recvmmsg()...");
+
+		auto self = GetSharedPtrAs<DatagramSocket>();
+
+		while (true)
+		{
+			for (auto &datagram : _received_datagrams)
+			{
+				// If the observers still hold the previous data, allocate a new one instead of overwriting it
+				if ((datagram.data == nullptr) || (datagram.data.use_count() > 1))
+				{
+					datagram.data = std::make_shared<ov::Data>(UdpBufferSize);
+				}
+			}
+
+			size_t received_count = 0;
+			auto error = RecvFrom(_received_datagrams, &received_count);
+
+			if ((error != nullptr) || (received_count == 0))
+			{
+				// An error occurred or try later
+				break;
+			}
+
+			if (_datagram_batch_callback != nullptr)
+			{
+				_datagram_batch_callback(self, _received_datagrams, received_count);
+			}
+
+			if (received_count < _received_datagrams.size())
+			{
+				// The socket buffer is drained
+				break;
+			}
+		}
+	}
+
 	String DatagramSocket::ToString() const
 	{
 		return Socket::ToString("DatagramSocket");
@@ -16,6 +16,60 @@ namespace ov
 	class DatagramSocket : public Socket, public SocketAsyncInterface
 	{
 	public:
+		// While a Batch is alive, datagrams sent by non-blocking UDP sockets on the current thread are
+		// accumulated instead of being sent one by one, and are flushed using sendmmsg()
+		// (and UDP_SEGMENT GSO if the kernel supports it) when the outermost Batch is destroyed.
+		//
+		// Nested Batch objects are merged into the outermost one.
+		//
+		// {
+		//     DatagramSocket::Batch batch;
+		//
+		//     for (auto &session : sessions)
+		//     {
+		//         // SendTo()/SendFromTo() will be accumulated
+		//         session->SendOutgoingData(packet);
+		//     }
+		//
+		//     // All datagrams are flushed here
+		// }
+		class Batch
+		{
+		public:
+			Batch();
+			~Batch();
+
+			Batch(const Batch &) = delete;
+			Batch &operator=(const Batch &) = delete;
+
+			// Flush the datagrams accumulated so far
+			void Flush();
+		};
+
+		// Returns false if there is no active Batch on the current thread.
+		// In this case, the caller must send the data by itself.
+		//
+		// The data is not copied - the batch keeps a reference to it and sends it directly from its buffer,
+		// so the caller must not modify the data after this call (the same as the dispatch queue of the socket).
+		static bool AppendToBatch(Socket *socket, const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
+		static bool AppendToBatch(Socket *socket, const SocketAddress &address, const std::shared_ptr<const Data> &data);
+
+		struct BatchStats
+		{
+			// Number of datagrams sent by the batches
+			uint64_t datagram_count = 0;
+			// Number of sendmmsg() calls
+			uint64_t syscall_count = 0;
+			// Number of UDP_SEGMENT (GSO) messages, and the datagrams contained in them
+			uint64_t gso_message_count = 0;
+			uint64_t gso_segment_count = 0;
+			// false if UDP_SEGMENT was rejected by the kernel/NIC
+			bool gso_available = true;
+		};
+
+		// Stats of all batches since startup
+		static BatchStats GetBatchStats();
+
 		DatagramSocket(PrivateToken token, const std::shared_ptr<SocketPoolWorker> &worker)
 			: Socket(token, worker)
 		{
@@ -27,6 +81,8 @@ namespace ov
 		bool Prepare(int port, DatagramCallback datagram_callback);
 		// Bind to the address specified by address
 		bool Prepare(const SocketAddress &address, DatagramCallback datagram_callback);
+		// Same as above, but datagrams are received using recvmmsg() and delivered in batches
+		bool Prepare(const SocketAddress &address, DatagramBatchCallback datagram_batch_callback);
 
 		using Socket::Close;
 		using Socket::Connect;
@@ -39,6 +95,15 @@ namespace ov
 		String ToString() const override;
 
 	protected:
+		static bool AppendToBatch(Socket *socket, const SocketAddress *local_address, const SocketAddress &remote_address, const std::shared_ptr<const Data> &data);
+
+		static void FlushBatch();
+		static void FlushBatch(Socket *socket, BatchStats *stats);
+		// Build mmsghdr list from the (first_socket_entry)th datagram of the socket
+		static void BuildBatchMessages(Socket *socket, size_t first_socket_entry, bool use_gso);
+		// Fall back to the dispatch queue of the socket (e.g. EAGAIN)
+		static void AppendBatchToDispatchQueue(Socket *socket, size_t first_socket_entry);
+
 		//--------------------------------------------------------------------
 		// Overriding of Socket
 		//--------------------------------------------------------------------
@@ -53,6 +118,8 @@ namespace ov
 			OV_ASSERT2(false);
 		}
 		void OnReadable() override;
+		void ReadDatagrams();
+		void ReadDatagramBatches();
 		void OnClosed() override
 		{
 			// datagram socket should not be called this event
@@ -60,5 +127,9 @@ namespace ov
 		}
 
 		DatagramCallback _datagram_callback = nullptr;
+		DatagramBatchCallback _datagram_batch_callback = nullptr;
+
+		// Receive buffers used by recvmmsg(), each buffer is reused if the observers do not hold it anymore
+		std::vector<Datagram> _received_datagrams;
 	};
 }  // namespace ov
@@ -12,12 +12,16 @@
 #include <errno.h>
 #include <sys/fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/poll.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 
+#include "datagram_socket.h"
 #include "epoll_wrapper.h"
 #include "socket_pool/socket_pool.h"
 #include "socket_private.h"
@@ -36,6 +40,13 @@
 #include "socket_profiler.h"
 #include "stats_counter.h"
 
+#if !IS_MACOS
+#	include <linux/tls.h>
+#endif	// !IS_MACOS
+
+// Maximum time to wait for the socket buffer to send a TLS control record
+#define OV_SOCKET_KTLS_RECORD_TIMEOUT_MS 1000
+
 namespace ov
 {
 	// Used to wait for connection
@@ -857,6 +868,10 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendFile:
+				sent_bytes = SendFileInternal(command.file_range);
+				break;
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -882,7 +897,7 @@ namespace ov
 			}
 		}
 
-		if (sent_bytes == static_cast<ssize_t>(command.data->GetLength()))
+		if (sent_bytes == static_cast<ssize_t>(command.GetLength()))
 		{
 			return DispatchResult::Dispatched;
 		}
@@ -896,9 +911,17 @@ namespace ov
 		{
 			// Since some data has been sent, the time needs to be updated.
 			command.UpdateTime();
-			data = data->Subdata(sent_bytes);
 
-			logad("Part of the data has been sent: %ld bytes, left: %ld bytes (%s)", sent_bytes, data->GetLength(), command.ToString().CStr());
+			if (command.type == DispatchCommand::Type::SendFile)
+			{
+				command.file_range = command.file_range.Subrange(sent_bytes);
+			}
+			else
+			{
+				data = data->Subdata(sent_bytes);
+			}
+
+			logad("Part of the data has been sent: %ld bytes, left: %zu bytes (%s)", sent_bytes, command.GetLength(), command.ToString().CStr());
 		}
 		else
 		{
@@ -1129,6 +1152,137 @@ namespace ov
 		return total_sent_bytes;
 	}
 
+	ssize_t Socket::SendDataList(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		struct iovec iov[IOV_MAX];
+
+		size_t index = 0;
+		// Offset of the data at [index] that has already been sent
+		size_t offset = 0;
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send %zu data...", data_list.size());
+
+		while ((index < data_list.size()) && (_force_stop == false))
+		{
+			size_t iov_count = 0;
+			size_t bytes_to_send = 0;
+
+			for (size_t data_index = index; (data_index < data_list.size()) && (iov_count < IOV_MAX); data_index++)
+			{
+				auto &data = data_list[data_index];
+				auto data_offset = (data_index == index) ? offset : 0;
+
+				if (data->GetLength() <= data_offset)
+				{
+					continue;
+				}
+
+				iov[iov_count].iov_base = const_cast<uint8_t *>(data->GetDataAs<uint8_t>() + data_offset);
+				iov[iov_count].iov_len = data->GetLength() - data_offset;
+				bytes_to_send += iov[iov_count].iov_len;
+				iov_count++;
+			}
+
+			if (iov_count == 0)
+			{
+				break;
+			}
+
+			struct msghdr message = {};
+			message.msg_iov = iov;
+			message.msg_iovlen = iov_count;
+
+			const auto sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(bytes_to_send) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			total_sent_bytes += sent;
+			UpdateLastSentTime();
+
+			// Skip the data that have been sent
+			size_t remaining = sent;
+
+			while ((index < data_list.size()) && (remaining > 0))
+			{
+				auto left = data_list[index]->GetLength() - offset;
+
+				if (remaining < left)
+				{
+					offset += remaining;
+					break;
+				}
+
+				remaining -= left;
+				index++;
+				offset = 0;
+			}
+
+			// Skip empty data
+			while ((index < data_list.size()) && (data_list[index]->GetLength() <= offset))
+			{
+				index++;
+				offset = 0;
+			}
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	ssize_t Socket::SendFileInternal(const FileRange &file_range)
+	{
+		if (file_range.IsValid() == false)
+		{
+			OV_ASSERT2(file_range.IsValid());
+			return -1L;
+		}
+
+		off_t offset = file_range.offset;
+		size_t remaining_bytes = file_range.length;
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send file %s...", file_range.ToString().CStr());
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+			// sendfile() advances the offset
+			const auto sent = ::sendfile(GetNativeHandle(), file_range.file->GetNativeHandle(), &offset, remaining_bytes);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			if (sent == 0L)
+			{
+				// The file has been truncated
+				logaw("Could not send file - unexpected end of file: %s", file_range.ToString().CStr());
+				STATS_COUNTER_INCREASE_ERROR();
+				return -1L;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
 	ssize_t Socket::SendSrtData(
 		const std::shared_ptr<const Data> &data)
 	{
@@ -1220,6 +1374,286 @@ namespace ov
 		return false;
 	}
 
+	bool Socket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if (GetType() != SocketType::Tcp)
+		{
+			for (const auto &data : data_list)
+			{
+				if (Send(data) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		size_t total_length = 0;
+
+		for (const auto &data : data_list)
+		{
+			if (data == nullptr)
+			{
+				OV_ASSERT2(data != nullptr);
+				return false;
+			}
+
+			total_length += data->GetLength();
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendDataList(data_list) == static_cast<ssize_t>(total_length));
+
+			case BlockingMode::NonBlocking: {
+				if (IsSendable() == false)
+				{
+					break;
+				}
+
+				std::lock_guard lock_guard(_dispatch_queue_lock);
+
+				size_t sent_bytes = 0;
+
+				// If there are data waiting to be sent, the data must be sent after them
+				if (_dispatch_queue.empty())
+				{
+					auto result = SendDataList(data_list);
+
+					if (result < 0L)
+					{
+						return false;
+					}
+
+					sent_bytes = result;
+				}
+
+				if (sent_bytes == total_length)
+				{
+					return true;
+				}
+
+				// Enqueue the data that have not been sent
+				for (const auto &data : data_list)
+				{
+					auto length = data->GetLength();
+
+					if (sent_bytes >= length)
+					{
+						sent_bytes -= length;
+						continue;
+					}
+
+					AppendCommand({(sent_bytes > 0) ? data->Subdata(sent_bytes) : data->Clone()}, false);
+					sent_bytes = 0;
+				}
+
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Socket::SendFile(const FileRange &file_range)
+	{
+		if (file_range.IsValid() == false)
+		{
+			OV_ASSERT2(file_range.IsValid());
+			return false;
+		}
+
+		if (GetType() != SocketType::Tcp)
+		{
+			// sendfile() is not available, so the range is sent as data
+			auto data = file_range.Read();
+
+			return (data != nullptr) && Send(data);
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendFileInternal(file_range) == static_cast<ssize_t>(file_range.length));
+
+			case BlockingMode::NonBlocking: {
+				if (IsSendable() == false)
+				{
+					break;
+				}
+
+				std::lock_guard lock_guard(_dispatch_queue_lock);
+
+				size_t sent_bytes = 0;
+
+				// If there are data waiting to be sent, the file must be sent after them
+				if (_dispatch_queue.empty())
+				{
+					auto result = SendFileInternal(file_range);
+
+					if (result < 0L)
+					{
+						return false;
+					}
+
+					sent_bytes = result;
+				}
+
+				if (sent_bytes == file_range.length)
+				{
+					return true;
+				}
+
+				AppendCommand({file_range.Subrange(sent_bytes)}, false);
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Socket::EnableKernelTlsTx(const void *crypto_info)
+	{
+#if IS_MACOS
+		return false;
+#else	// IS_MACOS
+		if ((GetType() != SocketType::Tcp) || (crypto_info == nullptr))
+		{
+			return false;
+		}
+
+		auto info = static_cast<const struct tls_crypto_info *>(crypto_info);
+		socklen_t info_length = 0;
+
+		switch (info->cipher_type)
+		{
+			case TLS_CIPHER_AES_GCM_128:
+				info_length = sizeof(struct tls12_crypto_info_aes_gcm_128);
+				break;
+
+			case TLS_CIPHER_AES_GCM_256:
+				info_length = sizeof(struct tls12_crypto_info_aes_gcm_256);
+				break;
+
+			case TLS_CIPHER_AES_CCM_128:
+				info_length = sizeof(struct tls12_crypto_info_aes_ccm_128);
+				break;
+
+#	ifdef TLS_CIPHER_CHACHA20_POLY1305
+			case TLS_CIPHER_CHACHA20_POLY1305:
+				info_length = sizeof(struct tls12_crypto_info_chacha20_poly1305);
+				break;
+#	endif	// TLS_CIPHER_CHACHA20_POLY1305
+
+			default:
+				logad("kTLS: Unsupported cipher type: %d", info->cipher_type);
+				return false;
+		}
+
+		std::lock_guard lock_guard(_dispatch_queue_lock);
+
+		if (_dispatch_queue.empty() == false)
+		{
+			// The queued data are already encrypted by OpenSSL
+			logad("kTLS: Could not enable kTLS - there are %zu commands waiting to be sent", _dispatch_queue.size());
+			return false;
+		}
+
+		if (::setsockopt(GetNativeHandle(), SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0)
+		{
+			// The tls module is not loaded (modprobe tls)
+			logad("kTLS: Could not set TCP_ULP: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		if (::setsockopt(GetNativeHandle(), SOL_TLS, TLS_TX, crypto_info, info_length) != 0)
+		{
+			logad("kTLS: Could not set TLS_TX: %s", Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		_is_ktls_tx_enabled = true;
+
+		return true;
+#endif	// IS_MACOS
+	}
+
+	ssize_t Socket::SendKernelTlsRecord(uint8_t record_type, const void *data, size_t length)
+	{
+#if IS_MACOS
+		return -1L;
+#else	// IS_MACOS
+		if (_is_ktls_tx_enabled == false)
+		{
+			OV_ASSERT2(_is_ktls_tx_enabled);
+			return -1L;
+		}
+
+		std::lock_guard lock_guard(_dispatch_queue_lock);
+
+		if (_dispatch_queue.empty() == false)
+		{
+			// The record cannot be queued with the record type, and must not be sent before the queued data
+			logad("kTLS: Could not send a record (type: %d) - there are %zu commands waiting to be sent", record_type, _dispatch_queue.size());
+			return -1L;
+		}
+
+		char control[CMSG_SPACE(sizeof(record_type))] = {};
+
+		struct iovec iov = {
+			.iov_base = const_cast<void *>(data),
+			.iov_len = length};
+
+		struct msghdr message = {};
+		message.msg_iov = &iov;
+		message.msg_iovlen = 1;
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+
+		auto cmsg = CMSG_FIRSTHDR(&message);
+		cmsg->cmsg_level = SOL_TLS;
+		cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(record_type));
+		::memcpy(CMSG_DATA(cmsg), &record_type, sizeof(record_type));
+
+		// The record must be sent at once, so wait for the socket buffer to be available
+		while (_force_stop == false)
+		{
+			const auto sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent >= 0L)
+			{
+				UpdateLastSentTime();
+				return sent;
+			}
+
+			if (errno != EAGAIN)
+			{
+				return HandleSendError(sent, 0);
+			}
+
+			struct pollfd poll_fd = {
+				.fd = GetNativeHandle(),
+				.events = POLLOUT,
+				.revents = 0};
+
+			if (::poll(&poll_fd, 1, OV_SOCKET_KTLS_RECORD_TIMEOUT_MS) <= 0)
+			{
+				logaw("kTLS: Could not send a record (type: %d) - timed out", record_type);
+				return -1L;
+			}
+		}
+
+		return -1L;
+#endif	// IS_MACOS
+	}
+
 	bool Socket::Send(const void *data, size_t length)
 	{
 		return Send((data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
@@ -1281,6 +1715,12 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
+					if ((GetType() == SocketType::Udp) && DatagramSocket::AppendToBatch(this, address, data))
+					{
+						// Will be sent when the batch is flushed
+						return true;
+					}
+
 					return AppendCommand(
 						(GetType() == SocketType::Udp)
 							? DispatchCommand(address, data->Clone())
@@ -1454,6 +1894,12 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
+					if ((GetType() == SocketType::Udp) && DatagramSocket::AppendToBatch(this, address_pair, data))
+					{
+						// Will be sent when the batch is flushed
+						return true;
+					}
+
 					return AppendCommand(
 						(GetType() == SocketType::Udp)
 							? DispatchCommand(address_pair, data->Clone())
@@ -1807,6 +2253,111 @@ namespace ov
 		return socket_error;
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvFrom(std::vector<Datagram> &datagrams, size_t *received_count, const bool non_block)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(received_count != nullptr);
+
+		*received_count = 0;
+
+		std::shared_ptr<SocketError> socket_error;
+
+		if (GetType() == SocketType::Udp)
+		{
+			const size_t count = std::min(datagrams.size(), UdpBatchCount);
+
+			constexpr size_t control_buf_size = CMSG_SPACE(std::max(sizeof(in_pktinfo), sizeof(in6_pktinfo)));
+
+			// To avoid allocations for every wakeup, use the stack
+			mmsghdr messages[UdpBatchCount];
+			iovec iovs[UdpBatchCount];
+			sockaddr_storage remotes[UdpBatchCount];
+			alignas(cmsghdr) char control_bufs[UdpBatchCount][control_buf_size];
+
+			for (size_t index = 0; index < count; index++)
+			{
+				auto &data = datagrams[index].data;
+
+				OV_ASSERT2(data != nullptr);
+				OV_ASSERT2(data->GetCapacity() > 0);
+
+				data->SetLength(data->GetCapacity());
+
+				iovs[index].iov_base = data->GetWritableData();
+				iovs[index].iov_len = data->GetLength();
+
+				auto &msg = messages[index].msg_hdr;
+				::memset(&messages[index], 0, sizeof(messages[index]));
+				::memset(control_bufs[index], 0, control_buf_size);
+
+				msg.msg_name = &remotes[index];
+				msg.msg_namelen = sizeof(remotes[index]);
+				msg.msg_control = control_bufs[index];
+				msg.msg_controllen = control_buf_size;
+				msg.msg_iov = &iovs[index];
+				msg.msg_iovlen = 1;
+			}
+
+			logad("Trying to read up to %zu datagrams from the socket...", count);
+
+			const int read_count = ::recvmmsg(
+				GetNativeHandle(),
+				messages, static_cast<unsigned int>(count),
+				((_blocking_mode == BlockingMode::NonBlocking) || non_block) ? MSG_DONTWAIT : 0,
+				nullptr);
+
+			if (read_count < 0)
+			{
+				auto error = Error::CreateErrorFromErrno();
+
+				if (error->GetCode() != EAGAIN)
+				{
+					socket_error = SocketError::CreateError(error);
+				}
+			}
+			else
+			{
+				logad("%d datagrams read", read_count);
+
+				const auto port = GetLocalAddress()->Port();
+
+				for (int index = 0; index < read_count; index++)
+				{
+					auto &datagram = datagrams[index];
+
+					datagram.data->SetLength(messages[index].msg_len);
+
+					datagram.address_pair.SetLocalAddress(QueryLocalAddress(_family, port, remotes[index], &(messages[index].msg_hdr)));
+					datagram.address_pair.SetRemoteAddress(SocketAddress("", remotes[index]));
+				}
+
+				*received_count = read_count;
+
+				if (read_count > 0)
+				{
+					UpdateLastRecvTime();
+				}
+			}
+		}
+		else
+		{
+			// Does not support RecvFrom() for TCP/SRT
+			OV_ASSERT2(false);
+			socket_error = SocketError::CreateError("RecvFrom() with multiple datagrams is only supported for UDP");
+		}
+
+		if (socket_error != nullptr)
+		{
+			logae("An error occurred while read data: %s\nStack trace: %s",
+				  socket_error->What(),
+				  StackTrace::GetStackTrace().CStr());
+
+			CloseWithState(SocketState::Error);
+		}
+
+		return socket_error;
+	}
+
 	std::chrono::system_clock::time_point Socket::GetLastRecvTime() const
 	{
 		return _last_recv_time;
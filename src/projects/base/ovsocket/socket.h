@@ -11,6 +11,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 
+#include "../ovlibrary/file_range.h"
 #include "socket_address.h"
 #include "socket_address_pair.h"
 #include "socket_wrapper.h"
@@ -35,8 +36,16 @@ namespace ov
 {
 	// Forward declaration
 	class Socket;
+	class DatagramSocket;
 	class SocketPoolWorker;
 
+	// A datagram received with recvmmsg()
+	struct Datagram
+	{
+		SocketAddressPair address_pair;
+		std::shared_ptr<Data> data;
+	};
+
 	class SocketAsyncInterface
 	{
 	public:
@@ -55,6 +64,8 @@ namespace ov
 	{
 	protected:
 		friend class SocketPoolWorker;
+		// To flush the batched datagrams (See DatagramSocket::Batch)
+		friend class DatagramSocket;
 
 		OV_SOCKET_DECLARE_PRIVATE_TOKEN();
 
@@ -174,6 +185,8 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Send the data in order using scatter-gather I/O (The data are not merged into a buffer)
+		bool Send(const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -181,6 +194,21 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		// Send the range of the file using sendfile() (TCP only, other sockets read the range into the memory)
+		bool SendFile(const FileRange &file_range);
+
+		// Offload the TLS encryption of the outgoing data to the kernel (kTLS, TCP only)
+		//
+		// crypto_info: struct tls_crypto_info of <linux/tls.h> which is filled by OpenSSL
+		// Fails if there are data waiting to be sent, because they are already encrypted.
+		bool EnableKernelTlsTx(const void *crypto_info);
+		bool IsKernelTlsTxEnabled() const
+		{
+			return _is_ktls_tx_enabled;
+		}
+		// Send a TLS record that is not application data (such as handshake/alert) through the kTLS socket
+		ssize_t SendKernelTlsRecord(uint8_t record_type, const void *data, size_t length);
+
 		// When Recv is called in non-blocking mode,
 		//
 		// 1. return != nullptr: An error occurred (Include disconnecting the client)
@@ -195,6 +223,10 @@ namespace ov
 
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block = false);
+		// Receive up to <datagrams.size()> (at most UdpBatchCount) datagrams at once using recvmmsg() (Only used when UDP)
+		//
+		// Each datagram.data must be allocated in advance, and *received_count == 0 means retry later (EAGAIN)
+		std::shared_ptr<const SocketError> RecvFrom(std::vector<Datagram> &datagrams, size_t *received_count, const bool non_block = false);
 
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
@@ -262,6 +294,8 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send the file range using sendfile()
+				SendFile = 0x04,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -287,6 +321,9 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendFile:
+						return "SendFile";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -323,6 +360,13 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const FileRange &file_range)
+				: type(Type::SendFile),
+				  file_range(file_range),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -343,6 +387,7 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  file_range(another_command.file_range),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -355,9 +400,21 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(file_range, another_command.file_range);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
+			// Length of the data (or file range) that have not been sent
+			size_t GetLength() const
+			{
+				if (type == Type::SendFile)
+				{
+					return file_range.length;
+				}
+
+				return (data != nullptr) ? data->GetLength() : 0;
+			}
+
 			bool IsCloseCommand() const
 			{
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
@@ -398,6 +455,11 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (type == DispatchCommand::Type::SendFile)
+				{
+					description.AppendFormat(", file: %s", file_range.ToString().CStr());
+				}
+
 				description.Append('>');
 
 				return description;
@@ -408,6 +470,7 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			FileRange file_range;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -437,11 +500,13 @@ namespace ov
 		bool DispatchEventsAfterAppendCommand();
 
 		ssize_t SendData(const std::shared_ptr<const Data> &data);
+		ssize_t SendDataList(const std::vector<std::shared_ptr<const Data>> &data_list);
 		ssize_t SendSrtData(const std::shared_ptr<const Data> &data);
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
 		ssize_t SendToInternal(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		ssize_t SendFromToInternal(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
+		ssize_t SendFileInternal(const FileRange &file_range);
 
 		std::shared_ptr<SocketError> RecvInternal(void *data, size_t length, size_t *received_length);
 
@@ -525,6 +590,8 @@ namespace ov
 		std::deque<DispatchCommand> _dispatch_queue;
 		bool _has_close_command = false;
 
+		std::atomic<bool> _is_ktls_tx_enabled{false};
+
 		std::atomic<bool> _connection_event_fired{false};
 		std::shared_ptr<SocketAsyncInterface> _callback;
 
@@ -8,6 +8,8 @@
 //==============================================================================
 #pragma once
 
+#include <array>
+
 #include "./socket_address.h"
 
 namespace ov
@@ -15,6 +17,39 @@ namespace ov
 	class SocketAddressPair
 	{
 	public:
+		// Fixed-size representation of the pair (family, address, port and scope id of both addresses) used as a hash key
+		struct PackedKey
+		{
+			// For each address: [family | port | scope id], [address high], [address low]
+			std::array<uint64_t, 6> words{};
+
+			bool operator==(const PackedKey &key) const
+			{
+				return words == key.words;
+			}
+
+			bool operator!=(const PackedKey &key) const
+			{
+				return words != key.words;
+			}
+		};
+
+		struct PackedKeyHash
+		{
+			size_t operator()(const PackedKey &key) const
+			{
+				uint64_t hash = 0xcbf29ce484222325ULL;
+
+				for (auto word : key.words)
+				{
+					hash = (hash ^ word) * 0x100000001b3ULL;
+					hash ^= hash >> 29;
+				}
+
+				return static_cast<size_t>(hash);
+			}
+		};
+
 		SocketAddressPair()
 		{
 		}
@@ -85,6 +120,16 @@ namespace ov
 			return false;
 		}
 
+		PackedKey Pack() const
+		{
+			PackedKey key;
+
+			PackAddress(_local_address, &key.words[0]);
+			PackAddress(_remote_address, &key.words[3]);
+
+			return key;
+		}
+
 		String ToString() const
 		{
 			return String::FormatString(
@@ -95,6 +140,33 @@ namespace ov
 		}
 
 	private:
+		static void PackAddress(const SocketAddress &address, uint64_t *words)
+		{
+			uint64_t family = static_cast<uint16_t>(address.GetFamily());
+
+			if (address.IsIPv4())
+			{
+				auto address_in = address.ToSockAddrIn4();
+
+				words[0] = (family << 48) | (static_cast<uint64_t>(address_in->sin_port) << 32);
+				words[1] = 0;
+				words[2] = address_in->sin_addr.s_addr;
+			}
+			else if (address.IsIPv6())
+			{
+				auto address_in6 = address.ToSockAddrIn6();
+
+				words[0] = (family << 48) | (static_cast<uint64_t>(address_in6->sin6_port) << 32) | address_in6->sin6_scope_id;
+				::memcpy(&words[1], &(address_in6->sin6_addr), sizeof(address_in6->sin6_addr));
+			}
+			else
+			{
+				words[0] = family << 48;
+				words[1] = 0;
+				words[2] = 0;
+			}
+		}
+
 		SocketAddress _local_address;
 		SocketAddress _remote_address;
 	};
@@ -47,6 +47,8 @@ namespace ov
 
 	const ssize_t TcpBufferSize = 4096;
 	const ssize_t UdpBufferSize = 4096;
+	// Maximum number of datagrams to receive at once using recvmmsg()
+	constexpr const size_t UdpBatchCount = 32;
 
 	enum class SocketConnectionState : int8_t
 	{
@@ -219,7 +221,11 @@ namespace ov
 	// For UDP sockets
 	class DatagramSocket;
 
+	struct Datagram;
+
 	typedef std::function<void(const std::shared_ptr<DatagramSocket> &client, const SocketAddressPair &address_pair, const std::shared_ptr<Data> &data)> DatagramCallback;
+	// Only the first <count> items of <datagrams> are valid
+	typedef std::function<void(const std::shared_ptr<DatagramSocket> &client, const std::vector<Datagram> &datagrams, size_t count)> DatagramBatchCallback;
 
 	static String StringFromEpollEvent(const epoll_event &event)
 	{
@@ -90,9 +90,12 @@ namespace pvd
 
 			logtd("Time taken to reconnect is %lld milliseconds. add to the basetime", reconnection_time_us/1000);
 
-			for (const auto &[track_id, timestamp] : _base_timestamp_us_map)
+			for (auto &state : _track_timestamp_states)
 			{
-				_base_timestamp_us_map[track_id] = (timestamp + reconnection_time_us);
+				if (state.has_base_timestamp)
+				{
+					state.base_timestamp_us += reconnection_time_us;
+				}
 			}
 		}
 	}
@@ -254,43 +257,77 @@ namespace pvd
 		// In this algorithm, the timestamp of A or V jumps for synchronization.
 		// But after testing with a variety of players, this is better.
 		double last_timestamp = std::numeric_limits<double>::min();
-		for (const auto &[track_id, timestamp] : _last_timestamp_us_map)
+		for (const auto &state : _track_timestamp_states)
 		{
-			auto track = GetTrack(track_id);
+			if (state.has_last_timestamp == false)
+			{
+				continue;
+			}
+
+			auto track = GetTrack(state.track_id);
 			if (!track)
 			{
 				continue;
 			}
 
-			last_timestamp = std::max<int64_t>(timestamp, last_timestamp);
+			last_timestamp = std::max<int64_t>(state.last_timestamp_us, last_timestamp);
 		}	
 #endif
 
 		// Update base timestamp using last received timestamp
-		for (const auto &[track_id, timestamp] : _last_timestamp_us_map)
+		for (auto &state : _track_timestamp_states)
 		{
+			if (state.has_last_timestamp == false)
+			{
+				continue;
+			}
+
 			// base_timestamp is the last timestamp value of the previous stream. Increase it based on this.
 			// last_timestamp is a value that is updated every time a packet is received.
 			[[maybe_unused]]
-			int64_t prev_base_timestamp = _base_timestamp_us_map[track_id];
+			int64_t prev_base_timestamp = state.base_timestamp_us;
 			
-			_base_timestamp_us_map[track_id] = last_timestamp;
-
 			// + last_duration
-			if (_last_duration_us_map.find(track_id) != _last_duration_us_map.end())
-			{
-				_base_timestamp_us_map[track_id] += _last_duration_us_map[track_id];
-			}
+			state.base_timestamp_us = last_timestamp + state.last_duration_us;
+			state.has_base_timestamp = true;
 
 			logtd("%s/%s(%u) Update base timestamp [%d] %lld => %lld, last_timestamp: %lld",
 				  GetApplicationName(), GetName().CStr(), GetId(),
-				  track_id, prev_base_timestamp, _base_timestamp_us_map[track_id], last_timestamp);
+				  state.track_id, prev_base_timestamp, (int64_t)state.base_timestamp_us, (int64_t)last_timestamp);
 		}
 
 		// Initialized start timestamp
 		_start_timestamp = -1LL;
 
-		_source_timestamp_map.clear();
+		for (auto &state : _track_timestamp_states)
+		{
+			state.has_source_timestamp = false;
+		}
+	}
+
+	Stream::TrackTimestampState &Stream::GetTrackTimestampState(uint32_t track_id)
+	{
+		if ((_last_track_timestamp_state_index < _track_timestamp_states.size()) &&
+			(_track_timestamp_states[_last_track_timestamp_state_index].track_id == track_id))
+		{
+			return _track_timestamp_states[_last_track_timestamp_state_index];
+		}
+
+		for (size_t index = 0; index < _track_timestamp_states.size(); index++)
+		{
+			if (_track_timestamp_states[index].track_id == track_id)
+			{
+				_last_track_timestamp_state_index = index;
+				return _track_timestamp_states[index];
+			}
+		}
+
+		_last_track_timestamp_state_index = _track_timestamp_states.size();
+
+		auto &state = _track_timestamp_states.emplace_back();
+		state.track_id = track_id;
+
+		return state;
 	}
 
 	void Stream::RegisterRtpClock(uint32_t track_id, double clock_rate)
@@ -402,12 +439,13 @@ namespace pvd
 		}
 		double start_timestamp_tb = static_cast<int64_t>(_start_timestamp * expr_us2tb);
 
+		auto &state = GetTrackTimestampState(track_id);
+
 		// 2. Get the base timestamp of the track
 		double base_timestamp_tb = 0;
-		auto it = _base_timestamp_us_map.find(track_id);
-		if (it != _base_timestamp_us_map.end())
+		if (state.has_base_timestamp)
 		{
-			base_timestamp_tb = static_cast<double>(it->second) * expr_us2tb;
+			base_timestamp_tb = state.base_timestamp_us * expr_us2tb;
 		}
 
 		// 3. Calculate PTS/DTS (base_timestamp + (pts - start_timestamp))
@@ -415,82 +453,71 @@ namespace pvd
 		double final_pkt_pts_tb_d = base_timestamp_tb + (pts - start_timestamp_tb);
 		int64_t final_pkt_pts_tb = static_cast<int64_t>(final_pkt_pts_tb_d);
 		// remainder
-		_last_pts_tb_remainder_map[track_id] += final_pkt_pts_tb_d - final_pkt_pts_tb;
-		if (_last_pts_tb_remainder_map[track_id] >= 1.0)
+		state.last_pts_tb_remainder += final_pkt_pts_tb_d - final_pkt_pts_tb;
+		if (state.last_pts_tb_remainder >= 1.0)
 		{
 			final_pkt_pts_tb++;
-			_last_pts_tb_remainder_map[track_id] -= 1.0;
+			state.last_pts_tb_remainder -= 1.0;
 		}
 
 		double final_pkt_dts_tb_d = base_timestamp_tb + (dts - start_timestamp_tb);
 		int64_t final_pkt_dts_tb = static_cast<int64_t>(final_pkt_dts_tb_d);
 		// remainder
-		_last_dts_tb_remainder_map[track_id] += final_pkt_dts_tb_d - final_pkt_dts_tb;
-		if (_last_dts_tb_remainder_map[track_id] >= 1.0)
+		state.last_dts_tb_remainder += final_pkt_dts_tb_d - final_pkt_dts_tb;
+		if (state.last_dts_tb_remainder >= 1.0)
 		{
 			final_pkt_dts_tb++;
-			_last_dts_tb_remainder_map[track_id] -= 1.0;
+			state.last_dts_tb_remainder -= 1.0;
 		}
 
 		// 4. Check wrap around and adjust PTS/DTS
 
-		// Initialize wraparound count for PTS
-		if (_wraparound_count_map[0].find(track_id) == _wraparound_count_map[0].end())
-		{
-			_wraparound_count_map[0][track_id] = 0;
-		}
-
-		// Initialize wraparound count for DTS
-		if (_wraparound_count_map[1].find(track_id) == _wraparound_count_map[1].end())
-		{
-			_wraparound_count_map[1][track_id] = 0;
-		}
-
 		// For PTS
 
 		// PTS is not sequential. Therefore, the PTS may wrap around and return again.
-		if (_last_origin_ts_map[0].find(track_id) != _last_origin_ts_map[0].end())
+		if (state.has_last_origin_ts)
 		{
 			// Check if wrap arounded or reverse wrap arounded
-			auto last_origin_pts = _last_origin_ts_map[0][track_id];
+			auto last_origin_pts = state.last_origin_ts[0];
 			if (last_origin_pts - pts > max_timestamp / 2)
 			{
-				_wraparound_count_map[0][track_id]++;
+				state.wraparound_count[0]++;
 				logti("[PTS] Wrap around detected. track:%d", track_id);
 			}
 			else if (pts - last_origin_pts > max_timestamp / 2)
 			{
-				if (_wraparound_count_map[0][track_id] > 0)
+				if (state.wraparound_count[0] > 0)
 				{
-					_wraparound_count_map[0][track_id]--;
+					state.wraparound_count[0]--;
 					logti("[PTS] Reverse wrap around detected. It could be caused by b-frames. track:%d", track_id);
 				}
 			}
 		}
 
-		final_pkt_pts_tb += _wraparound_count_map[0][track_id] * max_timestamp;
+		final_pkt_pts_tb += state.wraparound_count[0] * max_timestamp;
 
 		// For DTS
-		if (_last_origin_ts_map[1].find(track_id) != _last_origin_ts_map[1].end())
+		if (state.has_last_origin_ts)
 		{
-			auto last_origin_dts = _last_origin_ts_map[1][track_id];
+			auto last_origin_dts = state.last_origin_ts[1];
 			if (last_origin_dts - dts > max_timestamp / 2)
 			{
-				_wraparound_count_map[1][track_id]++;
+				state.wraparound_count[1]++;
 				logti("[DTS] Wrap around detected. track:%d", track_id);
 			}
 		}
 
-		final_pkt_dts_tb += _wraparound_count_map[1][track_id] * max_timestamp;
+		final_pkt_dts_tb += state.wraparound_count[1] * max_timestamp;
 		
 		// 5. Update last timestamp ( Managed in microseconds )
-		_last_timestamp_us_map[track_id] = static_cast<double>(final_pkt_dts_tb) * expr_tb2us;
+		state.last_timestamp_us = static_cast<double>(final_pkt_dts_tb) * expr_tb2us;
+		state.has_last_timestamp = true;
 
-		_last_origin_ts_map[0][track_id] = pts;
-		_last_origin_ts_map[1][track_id] = dts;
+		state.last_origin_ts[0] = pts;
+		state.last_origin_ts[1] = dts;
+		state.has_last_origin_ts = true;
 
-		auto duration_us = static_cast<double>(duration) * expr_tb2us;
-		_last_duration_us_map[track_id] = duration_us;
+		state.last_duration_us = static_cast<double>(duration) * expr_tb2us;
 
 		pts = final_pkt_pts_tb;
 		dts = final_pkt_dts_tb;
@@ -502,7 +529,7 @@ namespace pvd
 				pts, final_pkt_pts_tb, (int64_t)((double)final_pkt_pts_tb * expr_tb2us), 
 				dts, final_pkt_dts_tb, (int64_t)((double)final_pkt_dts_tb * expr_tb2us),
 				track->GetTimeBase().GetNum(), track->GetTimeBase().GetDen(),
-				_last_timestamp_map[track_id], (int64_t)(base_timestamp_tb * expr_tb2us));
+				(int64_t)state.last_timestamp_us, (int64_t)(base_timestamp_tb * expr_tb2us));
 #endif
 
 		return pts;
@@ -517,9 +544,10 @@ namespace pvd
 		}
 
 		int64_t base_timestamp = 0;
-		if (_base_timestamp_us_map.find(track_id) != _base_timestamp_us_map.end())
+		auto &state = GetTrackTimestampState(track_id);
+		if (state.has_base_timestamp)
 		{
-			base_timestamp = _base_timestamp_us_map[track_id];
+			base_timestamp = state.base_timestamp_us;
 		}
 
 		auto base_timestamp_tb = (base_timestamp * track->GetTimeBase().GetTimescale() / 1000000);
@@ -532,32 +560,36 @@ namespace pvd
 	{
 		int64_t curr_timestamp;
 
-		if (_last_timestamp_us_map.find(track_id) == _last_timestamp_us_map.end())
+		auto &state = GetTrackTimestampState(track_id);
+		if (state.has_last_timestamp == false)
 		{
 			curr_timestamp = 0;
 		}
 		else
 		{
-			curr_timestamp = _last_timestamp_us_map[track_id];
+			curr_timestamp = state.last_timestamp_us;
 		}
 
-		auto delta = GetDeltaTimestamp(track_id, timestamp, max_timestamp);
+		auto delta = GetDeltaTimestamp(state, timestamp, max_timestamp);
 		curr_timestamp += delta;
 
-		_last_timestamp_us_map[track_id] = curr_timestamp;
+		state.last_timestamp_us = curr_timestamp;
+		state.has_last_timestamp = true;
 
 		return curr_timestamp;
 	}
 
-	int64_t Stream::GetDeltaTimestamp(uint32_t track_id, int64_t timestamp, int64_t max_timestamp)
+	int64_t Stream::GetDeltaTimestamp(TrackTimestampState &state, int64_t timestamp, int64_t max_timestamp)
 	{
-		auto track = GetTrack(track_id);
+		[[maybe_unused]]
+		auto track_id = state.track_id;
 
 		// First timestamp
-		if (_source_timestamp_map.find(track_id) == _source_timestamp_map.end())
+		if (state.has_source_timestamp == false)
 		{
 			logtd("New track timestamp(%u) : curr(%lld)", track_id, timestamp);
-			_source_timestamp_map[track_id] = timestamp;
+			state.source_timestamp = timestamp;
+			state.has_source_timestamp = true;
 
 			// Start with zero
 			return 0;
@@ -566,27 +598,27 @@ namespace pvd
 		int64_t delta = 0;
 
 		// Wrap around or change source
-		if (timestamp < _source_timestamp_map[track_id])
+		if (timestamp < state.source_timestamp)
 		{
 			// If the last timestamp exceeds 99.99%, it is judged to be wrapped around.
-			if (_source_timestamp_map[track_id] > ((double)max_timestamp * 99.99) / 100)
+			if (state.source_timestamp > ((double)max_timestamp * 99.99) / 100)
 			{
-				logtd("Wrapped around(%u) : last(%lld) curr(%lld)", track_id, _source_timestamp_map[track_id], timestamp);
-				delta = (max_timestamp - _source_timestamp_map[track_id]) + timestamp;
+				logtd("Wrapped around(%u) : last(%lld) curr(%lld)", track_id, state.source_timestamp, timestamp);
+				delta = (max_timestamp - state.source_timestamp) + timestamp;
 			}
 			// Otherwise, the source might be changed. (restarted)
 			else
 			{
-				logtd("Source changed(%u) : last(%lld) curr(%lld)", track_id, _source_timestamp_map[track_id], timestamp);
+				logtd("Source changed(%u) : last(%lld) curr(%lld)", track_id, state.source_timestamp, timestamp);
 				delta = 0;
 			}
 		}
 		else
 		{
-			delta = timestamp - _source_timestamp_map[track_id];
+			delta = timestamp - state.source_timestamp;
 		}
 
-		_source_timestamp_map[track_id] = timestamp;
+		state.source_timestamp = timestamp;
 		return delta;
 	}
 
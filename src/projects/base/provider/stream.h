@@ -106,22 +106,45 @@ namespace pvd
 		bool AdjustRtpTimestamp(uint32_t track_id, int64_t timestamp, int64_t max_timestamp, int64_t &adjusted_timestamp);
 		
 	private:
+		struct TrackTimestampState;
+
 		void ResetSourceStreamTimestamp();
-		int64_t GetDeltaTimestamp(uint32_t track_id, int64_t timestamp, int64_t max_timestamp);
+		int64_t GetDeltaTimestamp(TrackTimestampState &state, int64_t timestamp, int64_t max_timestamp);
 		void UpdateReconnectTimeToBasetime();
 
-		// TrackID : Timestamp(us)
-		std::map<uint32_t, int64_t>			_source_timestamp_map;
-		std::map<uint32_t, double>			_last_timestamp_us_map;
-		std::map<uint32_t, double>			_base_timestamp_us_map;
-		std::map<uint32_t, double>			_last_duration_us_map;
+		// Timestamp state of a track.
+		// All the states of a track are in one cache line, so a packet needs only one lookup.
+		struct alignas(64) TrackTimestampState
+		{
+			uint32_t track_id = 0;
+
+			bool has_source_timestamp = false;
+			bool has_last_timestamp = false;
+			bool has_base_timestamp = false;
+			// For Wraparound
+			bool has_last_origin_ts = false;
+
+			int64_t source_timestamp = 0;
+			// Timestamp(us)
+			double last_timestamp_us = 0.0;
+			double base_timestamp_us = 0.0;
+			double last_duration_us = 0.0;
+
+			double last_pts_tb_remainder = 0.0;
+			double last_dts_tb_remainder = 0.0;
+
+			// For Wraparound (0 : pts 1: dts)
+			int64_t last_origin_ts[2] = {0, 0};
+			int64_t wraparound_count[2] = {0, 0};
+		};
 
-		std::map<uint32_t, double>			_last_pts_tb_remainder_map;
-		std::map<uint32_t, double>			_last_dts_tb_remainder_map;
+		// Returns the state of the track (created if not exists)
+		TrackTimestampState &GetTrackTimestampState(uint32_t track_id);
 
-		// For Wraparound
-		std::map<uint32_t, int64_t>			_last_origin_ts_map[2];
-		std::map<uint32_t, int64_t>			_wraparound_count_map[2]; // 0 : pts 1: dts
+		// A stream has only a few tracks, so a linear search on a dense array is faster than a tree
+		std::vector<TrackTimestampState>	_track_timestamp_states;
+		// Index of the state found last (packets of the same track usually arrive in a row)
+		size_t								_last_track_timestamp_state_index = 0;
 
 		double								_start_timestamp = -1LL;
 		std::chrono::time_point<std::chrono::system_clock>	_last_pkt_received_time = std::chrono::time_point<std::chrono::system_clock>::min();
@@ -44,8 +44,6 @@ namespace pub
 			return true;
 		}
 
-		_stream_data_queue.Clear();
-
 		_stop_thread_flag = true;
 
 		_queue_event.Stop();
@@ -55,6 +53,9 @@ namespace pub
 			_worker_thread.join();
 		}
 
+		// The queue has a single consumer, so it is cleared after WorkerThread() is finished
+		_stream_data_queue.Clear();
+
 		return true;
 	}
 
@@ -68,7 +68,8 @@ namespace pub
 		std::thread _worker_thread;
 		ov::Semaphore _queue_event;
 
-		ov::ManagedQueue<std::shared_ptr<StreamData>> _stream_data_queue;
+		// Multiple MediaRouter threads push, only WorkerThread() pops
+		ov::ManagedQueue<std::shared_ptr<StreamData>, ov::ManagedQueueType::Mpsc> _stream_data_queue;
 
 		[[maybe_unused]] int64_t _last_video_ts_ms = 0;
 		[[maybe_unused]] int64_t _last_audio_ts_ms = 0;
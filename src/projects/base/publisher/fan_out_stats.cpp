@@ -0,0 +1,107 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fan_out_stats.h"
+
+namespace pub
+{
+	static size_t GetLatencyBucketIndex(int64_t latency_us)
+	{
+		if (latency_us <= 0)
+		{
+			return 0;
+		}
+
+		auto index = static_cast<size_t>(64 - __builtin_clzll(static_cast<unsigned long long>(latency_us)));
+
+		return std::min(index, FanOutStats::LatencyBucketCount - 1);
+	}
+
+	void FanOutStats::Snapshot::Merge(const Snapshot &other)
+	{
+		packet_count += other.packet_count;
+		delivery_count += other.delivery_count;
+		sampled_delivery_count += other.sampled_delivery_count;
+		sampled_busy_time_us += other.sampled_busy_time_us;
+
+		for (size_t index = 0; index < LatencyBucketCount; index++)
+		{
+			latency_buckets[index] += other.latency_buckets[index];
+		}
+	}
+
+	int64_t FanOutStats::Snapshot::GetLatencyPercentileUs(double percentile) const
+	{
+		uint64_t total_count = 0;
+
+		for (auto count : latency_buckets)
+		{
+			total_count += count;
+		}
+
+		if (total_count == 0)
+		{
+			return 0;
+		}
+
+		auto target_count = static_cast<uint64_t>(std::ceil(total_count * std::clamp(percentile, 0.0, 1.0)));
+		uint64_t count = 0;
+
+		for (size_t index = 0; index < LatencyBucketCount; index++)
+		{
+			count += latency_buckets[index];
+
+			if ((count >= target_count) && (count > 0))
+			{
+				return (index == 0) ? 0 : (1LL << index);
+			}
+		}
+
+		return 1LL << (LatencyBucketCount - 1);
+	}
+
+	void FanOutStats::Count(size_t session_count)
+	{
+		_packet_count.fetch_add(1, std::memory_order_relaxed);
+		_delivery_count.fetch_add(session_count, std::memory_order_relaxed);
+	}
+
+	void FanOutStats::AddSample(int64_t latency_us, int64_t busy_time_us, size_t session_count)
+	{
+		_sampled_delivery_count.fetch_add(session_count, std::memory_order_relaxed);
+		_sampled_busy_time_us.fetch_add(busy_time_us, std::memory_order_relaxed);
+
+		_current_buckets[GetLatencyBucketIndex(latency_us)]++;
+	}
+
+	void FanOutStats::Roll()
+	{
+		for (size_t index = 0; index < LatencyBucketCount; index++)
+		{
+			_last_buckets[index].store(_current_buckets[index], std::memory_order_relaxed);
+			_current_buckets[index] = 0;
+		}
+	}
+
+	FanOutStats::Snapshot FanOutStats::GetSnapshot() const
+	{
+		Snapshot snapshot;
+
+		snapshot.packet_count = _packet_count.load(std::memory_order_relaxed);
+		snapshot.delivery_count = _delivery_count.load(std::memory_order_relaxed);
+		snapshot.sampled_delivery_count = _sampled_delivery_count.load(std::memory_order_relaxed);
+		snapshot.sampled_busy_time_us = _sampled_busy_time_us.load(std::memory_order_relaxed);
+
+		for (size_t index = 0; index < LatencyBucketCount; index++)
+		{
+			snapshot.latency_buckets[index] = _last_buckets[index].load(std::memory_order_relaxed);
+		}
+
+		return snapshot;
+	}
+}  // namespace pub
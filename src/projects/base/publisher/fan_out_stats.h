@@ -0,0 +1,80 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <array>
+#include <atomic>
+
+// One of this number of packets is timed
+#define FAN_OUT_STATS_SAMPLE_INTERVAL 64
+
+namespace pub
+{
+	// Measures the cost of delivering packets from a StreamWorker to its sessions
+	//
+	// Count()/AddSample()/Roll() are called only by the worker thread, and GetSnapshot() can be called by any thread.
+	// Every packet is counted, but only the sampled packets (1 of FAN_OUT_STATS_SAMPLE_INTERVAL) are timed,
+	// so the fan-out of the other packets does not read the clock.
+	// Latencies are collected into log2 buckets, so percentiles are accurate to a factor of 2.
+	class FanOutStats
+	{
+	public:
+		// Bucket N holds latencies in [2^(N-1), 2^N) microseconds (bucket 0 holds 0us)
+		static constexpr size_t LatencyBucketCount = 32;
+
+		struct Snapshot
+		{
+			// Number of packets taken from the queue
+			uint64_t packet_count = 0;
+			// Number of packets delivered to sessions (packet_count x session count)
+			uint64_t delivery_count = 0;
+
+			// Number of deliveries of the sampled packets
+			uint64_t sampled_delivery_count = 0;
+			// Time spent in SendOutgoingData() of the sessions for the sampled packets
+			int64_t sampled_busy_time_us = 0;
+
+			// Latency from BroadcastPacket() to the delivery to the last session of the sampled packets, collected during the last interval
+			std::array<uint64_t, LatencyBucketCount> latency_buckets{};
+
+			void Merge(const Snapshot &other);
+
+			// percentile: 0.0 ~ 1.0 - returns the upper bound of the bucket
+			int64_t GetLatencyPercentileUs(double percentile) const;
+
+			double GetBusyTimeUsPerDelivery() const
+			{
+				return (sampled_delivery_count > 0) ? (static_cast<double>(sampled_busy_time_us) / sampled_delivery_count) : 0.0;
+			}
+		};
+
+		// Called for every packet
+		void Count(size_t session_count);
+		// Called only for the sampled packets
+		void AddSample(int64_t latency_us, int64_t busy_time_us, size_t session_count);
+
+		// Publish the latencies collected since the last call, and start a new interval
+		void Roll();
+
+		Snapshot GetSnapshot() const;
+
+	private:
+		std::atomic<uint64_t> _packet_count{0};
+		std::atomic<uint64_t> _delivery_count{0};
+		std::atomic<uint64_t> _sampled_delivery_count{0};
+		std::atomic<int64_t> _sampled_busy_time_us{0};
+
+		// Latencies of the current interval (accessed only by the worker thread)
+		std::array<uint64_t, LatencyBucketCount> _current_buckets{};
+		// Latencies of the last interval
+		std::array<std::atomic<uint64_t>, LatencyBucketCount> _last_buckets{};
+	};
+}  // namespace pub
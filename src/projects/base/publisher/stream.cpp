@@ -2,17 +2,33 @@
 #include "application.h"
 #include "publisher_private.h"
 
+// Interval to report the fan-out stats of the StreamWorker
+#define STREAM_WORKER_FAN_OUT_REPORT_INTERVAL_MS (10 * 1000)
+// Interval to check whether a StreamWorker lags behind the others
+#define STREAM_WORKER_REBALANCE_INTERVAL_MS 1000
+// Sessions are moved only if the queue of the lagging worker has at least this many packets
+#define STREAM_WORKER_REBALANCE_QUEUE_THRESHOLD 50
+
 namespace pub
 {
-	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream)
-		: _packet_queue(nullptr, 500)
+	StreamWorker::StreamWorker(const std::shared_ptr<Stream> &parent_stream, uint32_t worker_index)
+		: _worker_index(worker_index),
+		  _packet_queue(nullptr, 500)
 	{
 		_stop_thread_flag = true;
 		_parent = parent_stream;
+		_session_snapshot = new SessionSnapshot();
 	}
 
 	StreamWorker::~StreamWorker()
 	{
+		// The worker thread has been stopped, so nobody reads the snapshots
+		for (auto snapshot : _retired_snapshots)
+		{
+			delete snapshot;
+		}
+
+		delete _session_snapshot.load();
 	}
 
 	bool StreamWorker::Start()
@@ -61,14 +77,23 @@ namespace pub
 
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
 
+		// The markers of these handoffs will never be dequeued, and this worker no longer calls the sessions
+		for (auto const &handoff : _outgoing_handoffs)
+		{
+			handoff->Complete();
+		}
+		_outgoing_handoffs.clear();
+
 		logtd("Try to stop all sessions of %s", worker_name.CStr());
 		for (auto const &x : _sessions)
 		{
-			auto session = std::static_pointer_cast<Session>(x.second);
+			auto session = x.second->session;
 			session->Stop();
 		}
+		[[maybe_unused]] auto session_count = _sessions.size();
 		_sessions.clear();
-		logtd("All sessions(%d) of %s has been stopped successfully", _sessions.size(), worker_name.CStr());
+		PublishSessionSnapshot();
+		logtd("All sessions(%zu) of %s has been stopped successfully", session_count, worker_name.CStr());
 
 		return true;
 	}
@@ -82,7 +107,8 @@ namespace pub
 		}
 
 		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
-		_sessions[session->GetId()] = session;
+		_sessions[session->GetId()] = std::make_shared<SessionEntry>(session, nullptr);
+		PublishSessionSnapshot();
 
 		return true;
 	}
@@ -96,17 +122,37 @@ namespace pub
 		}
 
 		std::unique_lock<std::shared_mutex> lock(_session_map_mutex);
-		if (_sessions.count(id) <= 0)
+		auto item = _sessions.find(id);
+		if (item == _sessions.end())
 		{
 			logte("Cannot find session : %u", id);
 			return false;
 		}
 
-		auto session = _sessions[id];
-		_sessions.erase(id);
+		auto entry = item->second;
+		_sessions.erase(item);
+		PublishSessionSnapshot();
 		lock.unlock();
 
-		session->Stop();
+		if (entry->waiting_for_handoff.exchange(false))
+		{
+			_incoming_handoff_count--;
+
+			// The source worker may still be delivering packets/messages to the session.
+			// The handoff is completed by the source worker thread outside of the fan-out, after the session is
+			// removed from its snapshot, so the source worker no longer calls the session once it is completed.
+			// (If the source worker thread removes the session itself, it must not wait for itself)
+			auto source = entry->handoff->source.lock();
+			if ((source != nullptr) && (source->IsWorkerThread() == false))
+			{
+				entry->handoff->WaitForCompletion();
+			}
+		}
+
+		// The session must not be stopped while this worker thread is still delivering a packet to it
+		WaitForFanOutQuiescence();
+
+		entry->session->Stop();
 
 		return true;
 	}
@@ -114,18 +160,234 @@ namespace pub
 	std::shared_ptr<Session> StreamWorker::GetSession(session_id_t id)
 	{
 		std::shared_lock<std::shared_mutex> lock(_session_map_mutex);
-		if (_sessions.count(id) <= 0)
+		auto item = _sessions.find(id);
+		if (item == _sessions.end())
 		{
 			// logte("Cannot find session : %u", id);
 			return nullptr;
 		}
 
-		return _sessions[id];
+		return item->second->session;
+	}
+
+	size_t StreamWorker::GetSessionCount() const
+	{
+		return _session_count.load(std::memory_order_relaxed);
+	}
+
+	void StreamWorker::PublishSessionSnapshot()
+	{
+		auto snapshot = new SessionSnapshot();
+
+		snapshot->entries.reserve(_sessions.size());
+		for (auto const &x : _sessions)
+		{
+			snapshot->entries.push_back(x.second);
+		}
+
+		_session_count = snapshot->entries.size();
+
+		// The worker thread may still be fanning out with the old snapshot, which is deleted later
+		// by ReclaimSessionSnapshots(), so the writer does not wait here with _session_map_mutex held
+		_retired_snapshots.push_back(_session_snapshot.exchange(snapshot));
+		_has_retired_snapshots = true;
+	}
+
+	void StreamWorker::WaitForFanOutQuiescence()
+	{
+		// Called by the worker thread itself (e.g. from OnMessageReceived())
+		if (IsWorkerThread())
+		{
+			return;
+		}
+
+		_snapshot_readers.Synchronize();
+	}
+
+	void StreamWorker::ReclaimSessionSnapshots()
+	{
+		std::vector<const SessionSnapshot *> retired_snapshots;
+
+		{
+			std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+
+			retired_snapshots.swap(_retired_snapshots);
+			_has_retired_snapshots = false;
+		}
+
+		if (retired_snapshots.empty())
+		{
+			return;
+		}
+
+		// The snapshots were replaced before this call, so the readers that may use them have entered before it
+		_snapshot_readers.Synchronize();
+
+		for (auto snapshot : retired_snapshots)
+		{
+			delete snapshot;
+		}
+	}
+
+	std::shared_ptr<SessionHandoff> StreamWorker::DetachSessions(size_t count, const std::shared_ptr<StreamWorker> &target, uint64_t fence_sequence, const std::function<bool(const std::shared_ptr<Session> &session)> &is_movable)
+	{
+		auto handoff = std::make_shared<SessionHandoff>();
+		handoff->target = target;
+		handoff->fence_sequence = fence_sequence;
+
+		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+
+		for (auto const &x : _sessions)
+		{
+			if (handoff->sessions.size() >= count)
+			{
+				break;
+			}
+
+			auto &entry = x.second;
+
+			// Sessions that are still moving in or out cannot be moved again
+			if (entry->leaving || entry->waiting_for_handoff || (is_movable(entry->session) == false))
+			{
+				continue;
+			}
+
+			entry->leaving = true;
+			handoff->sessions.push_back(entry->session);
+		}
+
+		if (handoff->sessions.empty())
+		{
+			return nullptr;
+		}
+
+		_outgoing_handoffs.push_back(handoff);
+
+		// The sessions leave this worker when the marker is dequeued, after all packets queued before it are delivered
+		_packet_queue.Enqueue({std::any(), 0, std::chrono::steady_clock::time_point(), handoff});
+		_queue_event.Notify();
+
+		return handoff;
 	}
 
-	void StreamWorker::SendPacket(const std::any &packet)
+	void StreamWorker::AttachSessions(const std::shared_ptr<SessionHandoff> &handoff)
 	{
-		_packet_queue.Enqueue(packet);
+		std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+
+		for (auto const &session : handoff->sessions)
+		{
+			auto entry = std::make_shared<SessionEntry>(session, handoff);
+
+			// The packets already queued in this worker are delivered by the source worker
+			entry->first_sequence = handoff->fence_sequence;
+
+			_sessions[session->GetId()] = entry;
+			_incoming_handoff_count++;
+		}
+
+		PublishSessionSnapshot();
+
+		// The handoff may have been completed before the entries are published
+		_queue_event.Notify();
+	}
+
+	void StreamWorker::CompleteHandoff(const std::shared_ptr<SessionHandoff> &handoff)
+	{
+		// Messages for the sessions may have been queued in this worker before they were moved
+		// (Stream::SendMessage() cannot enqueue a message while the sessions are being detached).
+		// Deliver them here, otherwise this worker would call the sessions after the target worker takes them over.
+		while (auto session_message = PopSessionMessage())
+		{
+			DeliverSessionMessage(session_message);
+		}
+
+		{
+			std::lock_guard<std::shared_mutex> lock(_session_map_mutex);
+
+			for (auto const &session : handoff->sessions)
+			{
+				auto item = _sessions.find(session->GetId());
+
+				if ((item != _sessions.end()) && (item->second->session == session))
+				{
+					// The packets from the fence are delivered by the target worker
+					if (item->second->last_sequence >= handoff->fence_sequence)
+					{
+						logtc("Session %u received packet #%llu after the handoff fence #%llu - it will be delivered twice",
+							  session->GetId(), item->second->last_sequence, handoff->fence_sequence);
+					}
+
+					_sessions.erase(item);
+				}
+			}
+
+			PublishSessionSnapshot();
+
+			_outgoing_handoffs.erase(std::remove(_outgoing_handoffs.begin(), _outgoing_handoffs.end(), handoff), _outgoing_handoffs.end());
+		}
+
+		handoff->Complete();
+
+		auto target = handoff->target.lock();
+		if (target != nullptr)
+		{
+			target->_queue_event.Notify();
+		}
+	}
+
+	bool StreamWorker::ResolveHandoff(const std::shared_ptr<SessionEntry> &entry)
+	{
+		if (entry->handoff->completed.load(std::memory_order_acquire) == false)
+		{
+			return false;
+		}
+
+		// Deliver the items held during the handoff in the order they were received
+		for (auto &item : entry->pending_items)
+		{
+			if (item.is_message)
+			{
+				entry->session->OnMessageReceived(item.data);
+			}
+			else
+			{
+				entry->session->SendOutgoingData(item.data);
+			}
+		}
+		entry->pending_items.clear();
+		entry->pending_items.shrink_to_fit();
+
+		if (entry->waiting_for_handoff.exchange(false))
+		{
+			_incoming_handoff_count--;
+		}
+
+		return true;
+	}
+
+	bool StreamWorker::HoldMessageForHandoff(const std::shared_ptr<Session> &session, const std::any &message)
+	{
+		ov::ReaderCounter::ReadSection read_section(_snapshot_readers);
+		auto snapshot = _session_snapshot.load();
+
+		for (auto const &entry : snapshot->entries)
+		{
+			if ((entry->session == session) && entry->waiting_for_handoff.load(std::memory_order_relaxed) && (ResolveHandoff(entry) == false))
+			{
+				entry->pending_items.push_back({true, message});
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void StreamWorker::SendPacket(const std::any &packet, uint64_t sequence)
+	{
+		// Only the sampled packets read the clock
+		auto sampled = (_sent_packet_count.fetch_add(1, std::memory_order_relaxed) % FAN_OUT_STATS_SAMPLE_INTERVAL) == 0;
+
+		_packet_queue.Enqueue({packet, sequence, sampled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point(), nullptr});
 		_queue_event.Notify();
 	}
 
@@ -136,7 +398,7 @@ namespace pub
 		_queue_event.Notify();
 	}
 
-	std::optional<std::any> StreamWorker::PopStreamPacket()
+	std::optional<StreamWorker::StreamPacket> StreamWorker::PopStreamPacket()
 	{
 		if (_packet_queue.IsEmpty())
 		{
@@ -162,34 +424,150 @@ namespace pub
 		return nullptr;
 	}
 
-	void StreamWorker::WorkerThread()
+	void StreamWorker::DeliverSessionMessage(const std::shared_ptr<SessionMessage> &session_message)
 	{
-		std::shared_lock<std::shared_mutex> session_lock(_session_map_mutex, std::defer_lock);
+		if (session_message->_session == nullptr || session_message->_message.has_value() == false)
+		{
+			return;
+		}
 
+		if ((_incoming_handoff_count == 0) || (HoldMessageForHandoff(session_message->_session, session_message->_message) == false))
+		{
+			session_message->_session->OnMessageReceived(session_message->_message);
+		}
+	}
+
+	void StreamWorker::WorkerThread()
+	{
 		while (!_stop_thread_flag)
 		{
 			_queue_event.Wait();
 
+			if (_has_retired_snapshots)
+			{
+				// This thread is the reader of the snapshots, and it is not reading one here
+				ReclaimSessionSnapshots();
+			}
+
 			auto session_message = PopSessionMessage();
-			if (session_message != nullptr && session_message->_session != nullptr && session_message->_message.has_value())
+			if (session_message != nullptr)
 			{
-				session_message->_session->OnMessageReceived(session_message->_message);
+				DeliverSessionMessage(session_message);
+			}
+
+			if (_incoming_handoff_count > 0)
+			{
+				// Flush the items of the completed handoffs even if no packet arrives
+				ov::ReaderCounter::ReadSection read_section(_snapshot_readers);
+				auto snapshot = _session_snapshot.load();
+				for (auto const &entry : snapshot->entries)
+				{
+					if (entry->waiting_for_handoff.load(std::memory_order_relaxed))
+					{
+						ResolveHandoff(entry);
+					}
+				}
 			}
 
 			auto packet = PopStreamPacket();
-			if (packet.has_value())
-			{		
-				session_lock.lock();
-				for (auto const &x : _sessions)
+			if (packet.has_value() == false)
+			{
+				continue;
+			}
+
+			if (packet->handoff != nullptr)
+			{
+				CompleteHandoff(packet->handoff);
+				continue;
+			}
+
+			auto sampled = (packet->enqueued_time.time_since_epoch().count() != 0);
+			auto start_time = sampled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+			size_t session_count = 0;
+			{
+				// Must be entered before loading the snapshot (see WaitForFanOutQuiescence())
+				ov::ReaderCounter::ReadSection read_section(_snapshot_readers);
+				auto snapshot = _session_snapshot.load();
+
+				// UDP datagrams sent by the sessions (e.g. WebRTC) are flushed together with sendmmsg()
+				ov::DatagramSocket::Batch datagram_batch;
+
+				for (auto const &entry : snapshot->entries)
 				{
-					auto session = x.second;
-					session->SendOutgoingData(packet.value());
+					if (packet->sequence < entry->first_sequence)
+					{
+						// Queued before the session moved in - already delivered by the source worker
+						continue;
+					}
+
+					if (entry->waiting_for_handoff.load(std::memory_order_relaxed) && (ResolveHandoff(entry) == false))
+					{
+						entry->pending_items.push_back({false, packet->packet});
+						continue;
+					}
+
+					entry->last_sequence = std::max(entry->last_sequence, packet->sequence);
+					entry->session->SendOutgoingData(packet->packet);
 				}
-				session_lock.unlock();
+
+				session_count = snapshot->entries.size();
 			}
+
+			UpdateFanOutStats(packet->enqueued_time, start_time, session_count);
 		}
 	}
 
+	void StreamWorker::UpdateFanOutStats(const std::chrono::steady_clock::time_point &enqueued_time, const std::chrono::steady_clock::time_point &start_time, size_t session_count)
+	{
+		_fan_out_stats.Count(session_count);
+
+		if (enqueued_time.time_since_epoch().count() == 0)
+		{
+			// Not sampled
+			return;
+		}
+
+		auto now = std::chrono::steady_clock::now();
+
+		_fan_out_stats.AddSample(
+			std::chrono::duration_cast<std::chrono::microseconds>(now - enqueued_time).count(),
+			std::chrono::duration_cast<std::chrono::microseconds>(now - start_time).count(),
+			session_count);
+
+		if (_last_fan_out_report_time.time_since_epoch().count() == 0)
+		{
+			_last_fan_out_report_time = now;
+			return;
+		}
+
+		auto elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - _last_fan_out_report_time).count();
+
+		if (elapsed_ms < STREAM_WORKER_FAN_OUT_REPORT_INTERVAL_MS)
+		{
+			return;
+		}
+
+		_fan_out_stats.Roll();
+
+		auto stats = _fan_out_stats.GetSnapshot();
+
+		logtd("[%s/%s] %s StreamWorker #%u fan-out: %.1f packets/s, %zu sessions, %.2f us/delivery, latency p50: %lld us, p99: %lld us",
+			  _parent->GetApplicationName(), _parent->GetName().CStr(), _parent->GetApplicationTypeName(), _worker_index,
+			  (stats.packet_count - _last_reported_packet_count) * 1000.0 / elapsed_ms,
+			  session_count,
+			  stats.GetBusyTimeUsPerDelivery(),
+			  stats.GetLatencyPercentileUs(0.5), stats.GetLatencyPercentileUs(0.99));
+
+		_last_fan_out_report_time = now;
+		_last_reported_packet_count = stats.packet_count;
+	}
+
+	FanOutStats::Snapshot StreamWorker::GetFanOutStats() const
+	{
+		return _fan_out_stats.GetSnapshot();
+	}
+
 	Stream::Stream(const std::shared_ptr<Application> application, const info::Stream &info)
 		: info::Stream(info)
 	{
@@ -255,7 +633,7 @@ namespace pub
 		// Create WorkerThread
 		for (uint32_t i = 0; i < _worker_count; i++)
 		{
-			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr());
+			auto stream_worker = std::make_shared<StreamWorker>(GetSharedPtr(), i);
 						
 			if (stream_worker->Start() == false)
 			{
@@ -273,6 +651,34 @@ namespace pub
 		return true;
 	}
 
+	FanOutStats::Snapshot Stream::GetFanOutStats()
+	{
+		FanOutStats::Snapshot stats;
+
+		std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
+		for (const auto &worker : _stream_workers)
+		{
+			stats.Merge(worker->GetFanOutStats());
+		}
+
+		return stats;
+	}
+
+	std::vector<FanOutStats::Snapshot> Stream::GetFanOutStatsPerWorker()
+	{
+		std::vector<FanOutStats::Snapshot> stats_list;
+
+		std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
+		for (const auto &worker : _stream_workers)
+		{
+			stats_list.push_back(worker->GetFanOutStats());
+		}
+
+		return stats_list;
+	}
+
 	bool Stream::Stop()
 	{
 		logti("Try to stop %s stream [%s(%u)]", GetApplicationTypeName(), GetName().CStr(), GetId());
@@ -294,6 +700,7 @@ namespace pub
 		logti("[%s(%u)] %s - All StreamWorker has been stopped", GetName().CStr(), GetId(), GetApplicationTypeName());
 
 		_stream_workers.clear();
+		_session_workers.clear();
 
 		worker_lock.unlock();
 
@@ -353,16 +760,93 @@ namespace pub
 		{
 			return nullptr;
 		}
-		std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
-
-		size_t worker_id = session_id % _worker_count;
-		if(worker_id >= _stream_workers.size())
+		auto item = _session_workers.find(session_id);
+		if (item == _session_workers.end())
 		{
-			logtw("Invalid worker id : %d", worker_id);
+			logtw("Cannot find the worker of session : %u", session_id);
 			return nullptr;
 		}
 
-		return _stream_workers[worker_id];
+		return item->second;
+	}
+
+	void Stream::RebalanceStreamWorkersIfNeeded()
+	{
+		auto now_ms = ov::Clock::NowMSec();
+		auto last_check_time_ms = _last_rebalance_check_time_ms.load();
+
+		if ((now_ms - last_check_time_ms < STREAM_WORKER_REBALANCE_INTERVAL_MS) ||
+			(_last_rebalance_check_time_ms.compare_exchange_strong(last_check_time_ms, now_ms) == false))
+		{
+			return;
+		}
+
+		// BroadcastPacket() is blocked while sessions are moving, so no packet is enqueued between the handoff marker
+		// and the packets that the target worker delivers
+		std::unique_lock<std::shared_mutex> worker_lock(_stream_worker_lock, std::try_to_lock);
+		if ((worker_lock.owns_lock() == false) || (_stream_workers.size() < 2))
+		{
+			return;
+		}
+
+		std::shared_ptr<StreamWorker> lagging_worker;
+		std::shared_ptr<StreamWorker> idle_worker;
+
+		for (const auto &worker : _stream_workers)
+		{
+			if ((lagging_worker == nullptr) || (worker->GetQueueSize() > lagging_worker->GetQueueSize()))
+			{
+				lagging_worker = worker;
+			}
+
+			if ((idle_worker == nullptr) || (worker->GetQueueSize() < idle_worker->GetQueueSize()) ||
+				((worker->GetQueueSize() == idle_worker->GetQueueSize()) && (worker->GetSessionCount() < idle_worker->GetSessionCount())))
+			{
+				idle_worker = worker;
+			}
+		}
+
+		auto lagging_queue_size = lagging_worker->GetQueueSize();
+		auto idle_queue_size = idle_worker->GetQueueSize();
+		auto lagging_session_count = lagging_worker->GetSessionCount();
+
+		// The worker lags if its queue is much longer than the queue of the least loaded worker
+		if ((lagging_worker == idle_worker) ||
+			(lagging_queue_size < STREAM_WORKER_REBALANCE_QUEUE_THRESHOLD) ||
+			(lagging_queue_size < idle_queue_size * 4) ||
+			(lagging_session_count < 2))
+		{
+			return;
+		}
+
+		// Move a fraction of the sessions at a time, so the load does not bounce between the workers
+		auto move_count = std::max<size_t>(1, lagging_session_count / 8);
+
+		// A session that is being removed (no longer in _session_workers) stays in the lagging worker
+		// No packet is broadcast until the sessions are attached, so the next one is the first packet for the target worker
+		auto fence_sequence = _last_packet_sequence.load() + 1;
+
+		auto handoff = lagging_worker->DetachSessions(move_count, idle_worker, fence_sequence, [&](const std::shared_ptr<Session> &session) {
+			auto item = _session_workers.find(session->GetId());
+			return (item != _session_workers.end()) && (item->second == lagging_worker);
+		});
+		if (handoff == nullptr)
+		{
+			return;
+		}
+
+		handoff->source = lagging_worker;
+
+		for (const auto &session : handoff->sessions)
+		{
+			_session_workers[session->GetId()] = idle_worker;
+		}
+
+		idle_worker->AttachSessions(handoff);
+
+		logtd("[%s/%s] %s - Moved %zu sessions from StreamWorker #%u (queue: %zu) to #%u (queue: %zu)",
+			  GetApplicationName(), GetName().CStr(), GetApplicationTypeName(),
+			  handoff->sessions.size(), lagging_worker->GetWorkerIndex(), lagging_queue_size, idle_worker->GetWorkerIndex(), idle_queue_size);
 	}
 
 	bool Stream::AddSession(std::shared_ptr<Session> session)
@@ -373,11 +857,26 @@ namespace pub
 
 		if(_worker_count > 0)
 		{
-			auto worker = GetWorkerBySessionID(session->GetId());
-			if(worker == nullptr)
+			std::shared_ptr<StreamWorker> worker;
 			{
-				logte("Cannot find worker for session : %u", session->GetId());
-				return false;
+				std::unique_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
+				// Assign the session to the worker with the fewest sessions
+				for (const auto &stream_worker : _stream_workers)
+				{
+					if ((worker == nullptr) || (stream_worker->GetSessionCount() < worker->GetSessionCount()))
+					{
+						worker = stream_worker;
+					}
+				}
+
+				if (worker == nullptr)
+				{
+					logte("Cannot find worker for session : %u", session->GetId());
+					return false;
+				}
+
+				_session_workers[session->GetId()] = worker;
 			}
 
 			return worker->AddSession(session);
@@ -400,7 +899,18 @@ namespace pub
 
 		if(_worker_count > 0)
 		{
-			auto worker = GetWorkerBySessionID(id);
+			std::shared_ptr<StreamWorker> worker;
+			{
+				std::unique_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
+				auto item = _session_workers.find(id);
+				if (item != _session_workers.end())
+				{
+					worker = item->second;
+					_session_workers.erase(item);
+				}
+			}
+
 			if (worker == nullptr)
 			{
 				logte("Cannot find worker for session : %u", id);
@@ -440,10 +950,19 @@ namespace pub
 	{
 		if(_worker_count > 0)
 		{
+			if (_worker_count > 1)
+			{
+				RebalanceStreamWorkersIfNeeded();
+			}
+
 			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
+			// Issued with the lock held, so a handoff fence splits the packets between the workers exactly
+			auto sequence = ++_last_packet_sequence;
+
 			for (uint32_t i = 0; i < _stream_workers.size(); i++)
 			{
-				_stream_workers[i]->SendPacket(packet);
+				_stream_workers[i]->SendPacket(packet, sequence);
 			}
 		}
 		else
@@ -463,6 +982,9 @@ namespace pub
 	{
 		if(_worker_count > 0)
 		{
+			// The message must be enqueued before the session is detached from the worker (see StreamWorker::CompleteHandoff())
+			std::shared_lock<std::shared_mutex> worker_lock(_stream_worker_lock);
+
 			auto worker = GetWorkerBySessionID(session->GetId());
 			if(worker == nullptr)
 			{
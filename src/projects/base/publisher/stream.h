@@ -1,5 +1,6 @@
 #pragma once
 
+#include <condition_variable>
 #include <shared_mutex>
 #include "base/common_types.h"
 #include "base/info/stream.h"
@@ -7,16 +8,60 @@
 #include "base/mediarouter/media_buffer.h"
 #include "base/mediarouter/media_event.h"
 #include "modules/managed_queue/managed_queue.h"
+#include "fan_out_stats.h"
 #include "session.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
 
 namespace pub
 {
+	class StreamWorker;
+
+	// Describes sessions that are moving from one StreamWorker to another
+	//
+	// The source worker keeps delivering packets to the sessions until it dequeues the handoff marker,
+	// and the target worker holds packets/messages for the sessions until the handoff is completed.
+	// The messages queued in the source worker are delivered by the source worker before the handoff is completed.
+	//
+	// Every packet is broadcast to all workers, so the target worker has also queued the packets that the source worker
+	// delivers before the marker. fence_sequence splits them: the packets with a lower sequence are delivered only by
+	// the source worker, and the others only by the target worker.
+	// So each session receives every packet exactly once and in order, and is never called by two workers at the same time.
+	struct SessionHandoff
+	{
+		std::vector<std::shared_ptr<Session>> sessions;
+		std::weak_ptr<StreamWorker> source;
+		std::weak_ptr<StreamWorker> target;
+		// Sequence of the first packet broadcast after the sessions are moved
+		uint64_t fence_sequence = 0;
+		std::atomic<bool> completed{false};
+
+		// Called by the source worker when the sessions have left it (or when it is stopped)
+		void Complete()
+		{
+			{
+				std::lock_guard<std::mutex> lock(completion_mutex);
+				completed.store(true, std::memory_order_release);
+			}
+
+			completion_condition.notify_all();
+		}
+
+		void WaitForCompletion()
+		{
+			std::unique_lock<std::mutex> lock(completion_mutex);
+			completion_condition.wait(lock, [this]() { return completed.load(std::memory_order_acquire); });
+		}
+
+	private:
+		std::mutex completion_mutex;
+		std::condition_variable completion_condition;
+	};
+
 	class StreamWorker
 	{
 	public:
-		StreamWorker(const std::shared_ptr<Stream> &parent_stream);
+		StreamWorker(const std::shared_ptr<Stream> &parent_stream, uint32_t worker_index);
 		~StreamWorker();
 
 		bool Start();
@@ -25,23 +70,133 @@ namespace pub
 		bool AddSession(const std::shared_ptr<Session> &session);
 		bool RemoveSession(session_id_t id);
 		std::shared_ptr<Session> GetSession(session_id_t id);
+		size_t GetSessionCount() const;
+
+		// Used to move sessions between workers (called by Stream while BroadcastPacket() and SendMessage() are blocked)
+		//
+		// Only the sessions for which is_movable() returns true are moved
+		// fence_sequence: sequence of the next packet to be broadcast
+		std::shared_ptr<SessionHandoff> DetachSessions(size_t count, const std::shared_ptr<StreamWorker> &target, uint64_t fence_sequence, const std::function<bool(const std::shared_ptr<Session> &session)> &is_movable);
+		void AttachSessions(const std::shared_ptr<SessionHandoff> &handoff);
 
 		// Send to a specific session
 		void SendMessage(const std::shared_ptr<Session> &session, const std::any &message);
 
-		// Send to all sessions
-		void SendPacket(const std::any &packet);
+		// Send to all sessions (sequence is issued by the Stream for each broadcast packet)
+		void SendPacket(const std::any &packet, uint64_t sequence);
+
+		uint32_t GetWorkerIndex() const
+		{
+			return _worker_index;
+		}
+
+		size_t GetQueueSize() const
+		{
+			return _packet_queue.Size();
+		}
+
+		FanOutStats::Snapshot GetFanOutStats() const;
 
 	private:
+		struct PendingItem
+		{
+			bool is_message;
+			std::any data;
+		};
+
+		struct SessionEntry
+		{
+			SessionEntry(const std::shared_ptr<Session> &session, const std::shared_ptr<SessionHandoff> &handoff)
+				: session(session),
+				  handoff(handoff),
+				  waiting_for_handoff(handoff != nullptr)
+			{
+			}
+
+			std::shared_ptr<Session> session;
+
+			// Set when the session has moved in from another worker
+			std::shared_ptr<SessionHandoff> handoff;
+			// Packets with a lower sequence were delivered by the source worker of the handoff
+			uint64_t first_sequence = 0;
+			// The highest sequence delivered to the session by this worker (accessed only by the worker thread)
+			uint64_t last_sequence = 0;
+			std::atomic<bool> waiting_for_handoff;
+			// Packets and messages received while waiting for the handoff (accessed only by the worker thread)
+			std::vector<PendingItem> pending_items;
+
+			// Set when the session is scheduled to move to another worker
+			bool leaving = false;
+		};
+
+		// Immutable list of sessions, which is replaced (not modified) whenever a session is added or removed,
+		// so the worker thread can fan out packets without taking _session_map_mutex
+		//
+		// The worker thread reads it in a ReadSection of _snapshot_readers, and a replaced snapshot is deleted
+		// after the readers that may still use it have left (see ReclaimSessionSnapshots())
+		struct SessionSnapshot
+		{
+			std::vector<std::shared_ptr<SessionEntry>> entries;
+		};
+
 		void WorkerThread();
+		// enqueued_time/start_time are set only for the sampled packets
+		void UpdateFanOutStats(const std::chrono::steady_clock::time_point &enqueued_time, const std::chrono::steady_clock::time_point &start_time, size_t session_count);
+
+		// Must be called with _session_map_mutex held
+		void PublishSessionSnapshot();
+		// Wait until the worker thread no longer uses the snapshots replaced before this call
+		// (returns immediately if called by the worker thread itself)
+		void WaitForFanOutQuiescence();
+		// Delete the replaced snapshots (must not be called with _session_map_mutex held, or in a ReadSection)
+		void ReclaimSessionSnapshots();
+		bool IsWorkerThread() const
+		{
+			return std::this_thread::get_id() == _worker_thread.get_id();
+		}
 
-		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
-		std::shared_mutex _session_map_mutex;
+		// Returns false if the entry still waits for the handoff
+		bool ResolveHandoff(const std::shared_ptr<SessionEntry> &entry);
+		bool HoldMessageForHandoff(const std::shared_ptr<Session> &session, const std::any &message);
+		void CompleteHandoff(const std::shared_ptr<SessionHandoff> &handoff);
+
+		uint32_t _worker_index;
+
+		std::map<session_id_t, std::shared_ptr<SessionEntry>> _sessions;
+		mutable std::shared_mutex _session_map_mutex;
+
+		std::atomic<const SessionSnapshot *> _session_snapshot{nullptr};
+		ov::ReaderCounter _snapshot_readers;
+		// Snapshots replaced but not deleted yet (protected by _session_map_mutex)
+		std::vector<const SessionSnapshot *> _retired_snapshots;
+		std::atomic<bool> _has_retired_snapshots{false};
+		std::atomic<size_t> _session_count{0};
+		// Handoffs whose marker is queued in this worker (protected by _session_map_mutex)
+		std::vector<std::shared_ptr<SessionHandoff>> _outgoing_handoffs;
+		// Number of entries waiting for a handoff
+		std::atomic<int32_t> _incoming_handoff_count{0};
 		
 		ov::Semaphore _queue_event;
 
-		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
+		struct StreamPacket
+		{
+			std::any packet;
+			// Issued by Stream::BroadcastPacket() (0 for a handoff marker)
+			uint64_t sequence;
+			// Used to measure the fan-out latency (set only for the sampled packets)
+			std::chrono::steady_clock::time_point enqueued_time;
+			// If set, this is a marker that moves sessions to another worker instead of a packet
+			std::shared_ptr<SessionHandoff> handoff;
+		};
+
+		std::optional<StreamPacket> PopStreamPacket();
+		ov::ManagedQueue<StreamPacket> _packet_queue;
+
+		FanOutStats _fan_out_stats;
+		// Used to select the packets to be timed
+		std::atomic<uint64_t> _sent_packet_count{0};
+		std::chrono::steady_clock::time_point _last_fan_out_report_time;
+		uint64_t _last_reported_packet_count = 0;
 
 		struct SessionMessage
 		{
@@ -56,6 +211,7 @@ namespace pub
 		};
 
 		std::shared_ptr<SessionMessage> PopSessionMessage();
+		void DeliverSessionMessage(const std::shared_ptr<SessionMessage> &session_message);
 		ov::Queue<std::shared_ptr<SessionMessage>> _session_message_queue;
 
 		std::atomic<bool> _stop_thread_flag;
@@ -143,6 +299,10 @@ namespace pub
 
 		bool CreateStreamWorker(uint32_t worker_count);
 
+		// Fan-out measurements of all StreamWorkers, and of each StreamWorker
+		FanOutStats::Snapshot GetFanOutStats();
+		std::vector<FanOutStats::Snapshot> GetFanOutStatsPerWorker();
+
 		uint32_t IssueUniqueSessionId();
 
 		std::shared_ptr<Application> GetApplication() const;
@@ -166,7 +326,11 @@ namespace pub
 		virtual ~Stream();
 
 	private:
+		// Must be called with _stream_worker_lock held
 		std::shared_ptr<StreamWorker> GetWorkerBySessionID(session_id_t session_id);
+		// Moves sessions from a lagging StreamWorker to the least loaded one
+		void RebalanceStreamWorkersIfNeeded();
+
 		std::map<session_id_t, std::shared_ptr<Session>> _sessions;
 		std::shared_mutex _session_map_mutex;
 
@@ -174,6 +338,11 @@ namespace pub
 		
 		std::shared_mutex _stream_worker_lock;
 		std::vector<std::shared_ptr<StreamWorker>>	_stream_workers;
+		// Worker that owns each session (protected by _stream_worker_lock)
+		std::unordered_map<session_id_t, std::shared_ptr<StreamWorker>> _session_workers;
+		std::atomic<uint64_t> _last_rebalance_check_time_ms{0};
+		// Sequence of the last packet broadcast (issued with _stream_worker_lock held in shared mode)
+		std::atomic<uint64_t> _last_packet_sequence{0};
 		std::shared_ptr<Application> _application;
 
 		session_id_t _last_issued_session_id;
@@ -0,0 +1,47 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Pool of the buffers of ov::Data and MediaPacket
+		struct MemoryPool : public ModuleTemplate
+		{
+		protected:
+			// Maximum size of the freed buffers kept for reuse (in MB)
+			int _max_cached_size = 256;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMaxCachedSize, _max_cached_size)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					server.xml:
+						<Modules>
+							<MemoryPool>
+								<!-- If disabled, the freed buffers are released to the system immediately -->
+								<Enable>true</Enable>
+								<!-- MB -->
+								<MaxCachedSize>256</MaxCachedSize>
+							</MemoryPool>
+						</Modules>
+				*/
+				Register<Optional>("MaxCachedSize", &_max_cached_size);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -14,6 +14,9 @@
 #include "recovery.h"
 #include "dynamic_app_removal.h"
 #include "etag.h"
+#include "ktls.h"
+#include "transcode_scheduler.h"
+#include "memory_pool.h"
 
 namespace cfg
 {
@@ -28,6 +31,9 @@ namespace cfg
 			Recovery _recovery;
 			DynamicAppRemoval _dynamic_app_removal;
 			ETag _etag;
+			KTLS _ktls;
+			TranscodeScheduler _transcode_scheduler;
+			MemoryPool _memory_pool;
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
@@ -36,6 +42,9 @@ namespace cfg
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetRecovery, _recovery)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetDynamicAppRemoval, _dynamic_app_removal)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetETag, _etag)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetKTLS, _ktls)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscodeScheduler, _transcode_scheduler)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMemoryPool, _memory_pool)
 
 		protected:
 			void MakeList() override
@@ -46,6 +55,9 @@ namespace cfg
 				Register<Optional>("Recovery", &_recovery);
 				Register<Optional>("DynamicAppRemoval", &_dynamic_app_removal);
 				Register<Optional>("ETag", &_etag);
+				Register<Optional>("KTLS", &_ktls);
+				Register<Optional>("TranscodeScheduler", &_transcode_scheduler);
+				Register<Optional>("MemoryPool", &_memory_pool);
 			}
 		};
 	}  // namespace modules
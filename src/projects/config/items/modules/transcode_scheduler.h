@@ -0,0 +1,62 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		// Shared worker threads for the decoders, filters and encoders of all transcoded streams
+		struct TranscodeScheduler : public ModuleTemplate
+		{
+		protected:
+			// 0: The stages share the CPU cores left by the stages with a configured count
+			int _decoder_worker_count = 0;
+			int _filter_worker_count = 0;
+			int _encoder_worker_count = 0;
+			bool _numa_affinity = true;
+
+		public:
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetDecoderWorkerCount, _decoder_worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetFilterWorkerCount, _filter_worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetEncoderWorkerCount, _encoder_worker_count)
+			CFG_DECLARE_CONST_REF_GETTER_OF(IsNumaAffinityEnabled, _numa_affinity)
+
+		protected:
+			void MakeList() override
+			{
+				// Disabled by default, the decoders/filters/encoders run on dedicated threads
+				SetEnable(false);
+
+				ModuleTemplate::MakeList();
+
+				/**
+					server.xml:
+						<Modules>
+							<TranscodeScheduler>
+								<Enable>false</Enable>
+								<!-- 0: Share the CPU cores with the other stages -->
+								<DecoderWorkerCount>0</DecoderWorkerCount>
+								<FilterWorkerCount>0</FilterWorkerCount>
+								<EncoderWorkerCount>0</EncoderWorkerCount>
+								<!-- Pin the workers to the CPUs of a NUMA node (round-robin) -->
+								<NumaAffinity>true</NumaAffinity>
+							</TranscodeScheduler>
+						</Modules>
+				*/
+				Register<Optional>("DecoderWorkerCount", &_decoder_worker_count);
+				Register<Optional>("FilterWorkerCount", &_filter_worker_count);
+				Register<Optional>("EncoderWorkerCount", &_encoder_worker_count);
+				Register<Optional>("NumaAffinity", &_numa_affinity);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
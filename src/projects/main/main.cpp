@@ -108,6 +108,12 @@ int main(int argc, char *argv[])
 
 	logti("This host supports %s", ov::ipv6::Checker::GetInstance()->ToString().CStr());
 
+	// Limit the freed media buffers kept for reuse
+	auto &memory_pool_config = server_config->GetModules().GetMemoryPool();
+	size_t max_cached_bytes = memory_pool_config.IsEnabled() ? static_cast<size_t>(std::max(memory_pool_config.GetMaxCachedSize(), 0)) * 1024 * 1024 : 0;
+	ov::MemoryPool::GetInstance()->SetMaxCachedBytes(max_cached_bytes);
+	logti("Memory pool keeps up to %zu MB of freed buffers", max_cached_bytes / 1024 / 1024);
+
 	bool succeeded = true;
 
 	INIT_EXTERNAL_MODULE("FFmpeg", InitializeFFmpeg);
@@ -146,6 +146,8 @@ static void AbortHandler(int signum, siginfo_t *si, void *context)
 	// Ensure that the version string is not corrupted.
 	g_ome_version[OV_COUNTOF(g_ome_version) - 1] = '\0';
 	logtc("OME %s received signal %d (%s), interrupt.", g_ome_version, signum, GetSignalName(signum));
+	// Logs are written by a background thread, so write the queued logs before the process is terminated
+	ov_log_flush_from_signal_handler();
 
 	std::tm local_time{};
 	::localtime_r(&t, &local_time);
@@ -224,6 +226,8 @@ static void AbortHandler(int signum, siginfo_t *si, void *context)
 		logte("Could not open dump file to write");
 	}
 
+	ov_log_flush_from_signal_handler();
+
 	::exit(signum);
 }
 
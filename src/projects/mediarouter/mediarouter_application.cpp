@@ -51,21 +51,17 @@ MediaRouteApplication::MediaRouteApplication(const info::Application &applicatio
 
 	logti("[%s(%u)] Created Mediarouter application. Worker(%d) DelayBufferTime(%d)", _application_info.GetVHostAppName().CStr(), _application_info.GetId(), _max_worker_thread_count, delay_buffer_time_ms);
 
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
-	{
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetVHostAppName(), nullptr, "imr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 1000);
-			_inbound_stream_indicator.push_back(stream_data);
-		}
+	_inbound_worker_pool = std::make_shared<MediaRouteWorkerPool>(
+		"InboundWorker", _application_info.GetVHostAppName().CStr(), _max_worker_thread_count, 0,
+		[this](const std::shared_ptr<MediaRouteStream> &stream) {
+			ProcessInboundStream(stream);
+		});
 
-		{
-			auto urn = std::make_shared<info::ManagedQueue::URN>(_application_info.GetVHostAppName(), nullptr, "omr", ov::String::FormatString("aw_%d", worker_id));
-			auto stream_data = std::make_shared<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>(urn, 1000);
-			stream_data->SetBufferingDelay(delay_buffer_time_ms);
-			_outbound_stream_indicator.push_back(stream_data);
-		}
-	}
+	_outbound_worker_pool = std::make_shared<MediaRouteWorkerPool>(
+		"OutboundWorker", _application_info.GetVHostAppName().CStr(), _max_worker_thread_count, delay_buffer_time_ms,
+		[this](const std::shared_ptr<MediaRouteStream> &stream) {
+			ProcessOutboundStream(stream);
+		});
 }
 
 MediaRouteApplication::~MediaRouteApplication()
@@ -75,82 +71,25 @@ MediaRouteApplication::~MediaRouteApplication()
 
 bool MediaRouteApplication::Start()
 {
-	_kill_flag = false;
-
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
+	if ((_inbound_worker_pool->Start() == false) || (_outbound_worker_pool->Start() == false))
 	{
-		try
-		{
-			auto inbound_thread = std::thread(&MediaRouteApplication::InboundWorkerThread, this, worker_id);
-			pthread_setname_np(inbound_thread.native_handle(), "InboundWorker");
-			_inbound_threads.push_back(std::move(inbound_thread));
-		}
-		catch (const std::system_error &e)
-		{
-			_kill_flag = true;
-			logte("Failed to start Mediarouter application thread.");
-			return false;
-		}
-	}
+		logte("Failed to start Mediarouter application thread.");
 
-	for (uint32_t worker_id = 0; worker_id < _max_worker_thread_count; worker_id++)
-	{
-		try
-		{
-			auto outbound_thread = std::thread(&MediaRouteApplication::OutboundWorkerThread, this, worker_id);
-			pthread_setname_np(outbound_thread.native_handle(), "OutboundWorker");
-			_outbound_threads.push_back(std::move(outbound_thread));
-		}
-		catch (const std::system_error &e)
-		{
-			_kill_flag = true;
-			logte("Failed to start Mediarouter application thread.");
-			return false;
-		}
+		_inbound_worker_pool->Stop();
+		_outbound_worker_pool->Stop();
+
+		return false;
 	}
 
 	logtd("[%s(%u)] Started Mediarouter application.", _application_info.GetVHostAppName().CStr(), _application_info.GetId());
 
-
 	return true;
 }
 
 bool MediaRouteApplication::Stop()
 {
-	_kill_flag = true;
-
-	for (auto &indicator : _inbound_stream_indicator)
-	{
-		indicator->Stop();
-		indicator->Clear();
-	}
-
-	for (auto &indicator : _outbound_stream_indicator)
-	{
-		indicator->Stop();
-		indicator->Clear();
-	}
-
-	for (auto &worker : _inbound_threads)
-	{
-		if (worker.joinable())
-		{
-			worker.join();
-		}
-	}
-
-	for (auto &worker : _outbound_threads)
-	{
-		if (worker.joinable())
-		{
-			worker.join();
-		}
-	}
-
-	_inbound_stream_indicator.clear();
-	_outbound_stream_indicator.clear();
-	_inbound_threads.clear();
-	_outbound_threads.clear();
+	_inbound_worker_pool->Stop();
+	_outbound_worker_pool->Stop();
 
 	_connectors.clear();
 	_observers.clear();
@@ -751,7 +690,7 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouterAp
 
 		stream->Push(packet);
 
-		_inbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream, packet->IsHighPriority());
+		_inbound_worker_pool->Notify(stream, packet->IsHighPriority());
 	}
 	// Provider(relay), Transcoder => Outbound Stream
 	else if ((IS_CONNECTOR_PROVIDER(connector_type) && IS_REPRENT_RELAY(representation_type)) ||
@@ -765,7 +704,7 @@ bool MediaRouteApplication::OnPacketReceived(const std::shared_ptr<MediaRouterAp
 
 		stream->Push(packet);
 
-		_outbound_stream_indicator[GetWorkerIDByStreamID(stream_info->GetId())]->Enqueue(stream, packet->IsHighPriority());
+		_outbound_worker_pool->Notify(stream, packet->IsHighPriority());
 	}
 	else
 	{
@@ -850,171 +789,127 @@ bool MediaRouteApplication::IsExistingInboundStream(ov::String stream_name)
 	return false;
 }
 
-uint32_t MediaRouteApplication::GetWorkerIDByStreamID(info::stream_id_t stream_id)
-{
-	return stream_id % _max_worker_thread_count;
-}
-
-void MediaRouteApplication::InboundWorkerThread(uint32_t worker_id)
+void MediaRouteApplication::ProcessInboundStream(const std::shared_ptr<MediaRouteStream> &stream)
 {
-	logtd("Created Inbound worker thread #%d", worker_id);
+	// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+	auto media_packet = stream->PopAndNormalize();
+	if (media_packet == nullptr)
+	{
+		return;
+	}
 
-	while (!_kill_flag)
+	// When the inbound stream is finished parsing track information,
+	// Notify the Observer that the stream is parsed
+	if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
 	{
-		auto msg = _inbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
-		{
-			// It may be called due to a normal stop signal.
-			continue;
-		}
+		auto prepared_stream = stream;
+		NotifyStreamPrepared(prepared_stream);
+	}
 
-		auto stream = msg.value();
-		if (stream == nullptr)
-		{
-			logtw("Not found stream info");
-			continue;
-		}
+	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = _observers; // Avoid deadlock
+	lock.unlock();
+	for (const auto &observer : observers)
+	{
+		auto observer_type = observer->GetObserverType();
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->PopAndNormalize();
-		if (media_packet == nullptr)
+		if (observer_type == MediaRouterApplicationObserver::ObserverType::Transcoder)
 		{
-			continue;
-		}
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
 
-		// When the inbound stream is finished parsing track information,
-		// Notify the Observer that the stream is parsed
-		if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
-		{
-			NotifyStreamPrepared(stream);
+			// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
+			observer->OnSendFrame(stream_info, media_packet);
 		}
+	}
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		auto observers = _observers; // Avoid deadlock
-		lock.unlock();
-		for (const auto &observer : observers)
+	// Mirror stream
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
+		auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
+		for (auto iter = it.first; iter != it.second; ++iter)
 		{
-			auto observer_type = observer->GetObserverType();
+			auto stream_tap = iter->second;
 
-			if (observer_type == MediaRouterApplicationObserver::ObserverType::Transcoder)
+			if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
 			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
-
-				// observer->OnSendFrame(stream_info, std::move(media_packet->ClonePacket()));
-				observer->OnSendFrame(stream_info, media_packet);
-			}
-		}
-
-		// Mirror stream
-		{
-			std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
-			auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
-			for (auto iter = it.first; iter != it.second; ++iter)
-			{
-				auto stream_tap = iter->second;
-
-				if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+				if (stream_tap->DoesNeedPastData())
 				{
-					if (stream_tap->DoesNeedPastData())
-					{
-						stream_tap->SetNeedPastData(false);
+					stream_tap->SetNeedPastData(false);
 
-						for (const auto &item : stream->GetMirrorBuffer())
-						{
-							stream_tap->Push(item->packet);
-						}
-					}
-					else
+					for (const auto &item : stream->GetMirrorBuffer())
 					{
-						stream_tap->Push(media_packet);
+						stream_tap->Push(item->packet);
 					}
 				}
+				else
+				{
+					stream_tap->Push(media_packet);
+				}
 			}
 		}
 	}
-
-	logtd("Inbound worker thread #%d has been stopped", worker_id);
 }
 
-void MediaRouteApplication::OutboundWorkerThread(uint32_t worker_id)
+void MediaRouteApplication::ProcessOutboundStream(const std::shared_ptr<MediaRouteStream> &stream)
 {
-	logtd("Created outbound worker thread #%d", worker_id);
-
-	while (!_kill_flag)
+	// check stream is exist, there can be removed streams packet because of delay buffer
+	if (GetOutboundStream(stream->GetStream()->GetId()) == nullptr)
 	{
-		auto msg = _outbound_stream_indicator[worker_id]->Dequeue(ov::Infinite);
-		if (msg.has_value() == false)
-		{
-			// It may be called due to a normal stop signal.
-			continue;
-		}
-		auto stream = msg.value();
-		if (stream == nullptr)
-		{
-			logtw("Not found stream info");
-			continue;
-		}
+		return;
+	}
 
-		// check stream is exist, there can be removed streams packet because of delay buffer
-		if (GetOutboundStream(stream->GetStream()->GetId()) == nullptr)
-		{
-			continue;
-		}
+	// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
+	auto media_packet = stream->PopAndNormalize();
+	if (media_packet == nullptr)
+	{
+		return;
+	}
 
-		// StreamDeliver media packet to Publisher(observer) of Transcoder(observer)
-		auto media_packet = stream->PopAndNormalize();
-		if (media_packet == nullptr)
-		{
-			continue;
-		}
+	if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
+	{
+		auto prepared_stream = stream;
+		NotifyStreamPrepared(prepared_stream);
+	}
 
-		if (stream->IsStreamPrepared() == false && stream->IsStreamReady() == true)
-		{
-			NotifyStreamPrepared(stream);
-		}
+	std::shared_lock<std::shared_mutex> lock(_observers_lock);
+	auto observers = _observers; // Avoid deadlock
+	lock.unlock();
+	for (const auto &observer : observers)
+	{
+		auto observer_type = observer->GetObserverType();
 
-		std::shared_lock<std::shared_mutex> lock(_observers_lock);
-		auto observers = _observers; // Avoid deadlock
-		lock.unlock();
-		for (const auto &observer : observers)
+		if (observer_type == MediaRouterApplicationObserver::ObserverType::Publisher)
 		{
-			auto observer_type = observer->GetObserverType();
-
-			if (observer_type == MediaRouterApplicationObserver::ObserverType::Publisher)
-			{
-				// Get Stream Info
-				auto stream_info = stream->GetStream();
-				observer->OnSendFrame(stream_info, media_packet);
-			}
+			// Get Stream Info
+			auto stream_info = stream->GetStream();
+			observer->OnSendFrame(stream_info, media_packet);
 		}
+	}
 
-		// mirror stream
+	// mirror stream
+	{
+		std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
+		auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
+		for (auto iter = it.first; iter != it.second; ++iter)
 		{
-			std::shared_lock<std::shared_mutex> lock(_stream_taps_lock);
-			auto it = _stream_taps.equal_range(stream->GetStream()->GetId());
-			for (auto iter = it.first; iter != it.second; ++iter)
+			auto stream_tap = iter->second;
+			if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
 			{
-				auto stream_tap = iter->second;
-				if (stream_tap->GetState() == MediaRouterStreamTap::State::Tapped)
+				if (stream_tap->DoesNeedPastData())
 				{
-					if (stream_tap->DoesNeedPastData())
-					{
-						stream_tap->SetNeedPastData(false);
+					stream_tap->SetNeedPastData(false);
 
-						for (const auto &item : stream->GetMirrorBuffer())
-						{
-							stream_tap->Push(item->packet);
-						}
-					}
-					else
+					for (const auto &item : stream->GetMirrorBuffer())
 					{
-						stream_tap->Push(media_packet);
+						stream_tap->Push(item->packet);
 					}
 				}
+				else
+				{
+					stream_tap->Push(media_packet);
+				}
 			}
 		}
 	}
-
-	logtd("Outbound worker thread #%d has been stopped", worker_id);
 }
@@ -23,6 +23,7 @@
 
 #include "mediarouter_stream.h"
 #include "mediarouter_stream_tap.h"
+#include "mediarouter_worker_pool.h"
 
 class ApplicationInfo;
 class Stream;
@@ -157,17 +158,12 @@ private:
 	std::shared_mutex _streams_lock;
 
 private:
-	uint32_t GetWorkerIDByStreamID(info::stream_id_t stream_id);
-	void InboundWorkerThread(uint32_t worker_id);
-	void OutboundWorkerThread(uint32_t worker_id);
-
-	volatile bool _kill_flag;
-	std::vector<std::thread> _inbound_threads;
-	std::vector<std::thread> _outbound_threads;
+	// Called by the worker pools to process a packet of the stream
+	void ProcessInboundStream(const std::shared_ptr<MediaRouteStream> &stream);
+	void ProcessOutboundStream(const std::shared_ptr<MediaRouteStream> &stream);
 
 	uint32_t _max_worker_thread_count;
 
-private:
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _inbound_stream_indicator;
-	std::vector<std::shared_ptr<ov::ManagedQueue<std::shared_ptr<MediaRouteStream>>>> _outbound_stream_indicator;
+	std::shared_ptr<MediaRouteWorkerPool> _inbound_worker_pool;
+	std::shared_ptr<MediaRouteWorkerPool> _outbound_worker_pool;
 };
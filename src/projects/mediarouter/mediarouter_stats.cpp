@@ -41,7 +41,7 @@ void MediaRouterStats::Init(const std::shared_ptr<info::Stream> &stream_info)
 void MediaRouterStats::Update(
 	const int8_t type,
 	const bool prepared,
-	const ov::ManagedQueue<std::shared_ptr<MediaPacket>> &packets_queue,
+	const ov::ManagedQueue<std::shared_ptr<MediaPacket>, ov::ManagedQueueType::Mpsc> &packets_queue,
 	const std::shared_ptr<info::Stream> &stream_info,
 	const std::shared_ptr<MediaTrack> &media_track,
 	const std::shared_ptr<MediaPacket> &media_packet)
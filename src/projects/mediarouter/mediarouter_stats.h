@@ -31,7 +31,7 @@ public:
 	void Update(
 		const int8_t type,
 		const bool prepared,
-		const ov::ManagedQueue<std::shared_ptr<MediaPacket>> &packets_queue,
+		const ov::ManagedQueue<std::shared_ptr<MediaPacket>, ov::ManagedQueueType::Mpsc> &packets_queue,
 		const std::shared_ptr<info::Stream> &stream_info,
 		const std::shared_ptr<MediaTrack> &media_track,
 		const std::shared_ptr<MediaPacket> &media_packet);
@@ -20,6 +20,7 @@
 #include "mediarouter_nomalize.h"
 #include "mediarouter_stats.h"
 #include "mediarouter_event_generator.h"
+#include "mediarouter_worker_pool.h"
 #include "modules/managed_queue/managed_queue.h"
 
 enum class MediaRouterStreamType : int8_t
@@ -75,7 +76,13 @@ public:
 	bool IsStreamReady();
 
 	void Flush();
-	
+
+	// Used by MediaRouteWorkerPool to schedule this stream
+	MediaRouteWorkerTask &GetWorkerTask()
+	{
+		return _worker_task;
+	}
+
 private:
 	void DropNonDecodingPackets();
 	void DetectAbnormalPackets(std::shared_ptr<MediaTrack> &media_track, std::shared_ptr<MediaPacket> &packet);
@@ -93,7 +100,8 @@ private:
 	std::map<MediaTrackId, std::shared_ptr<MediaPacket>> _media_packet_stash;
 
 	// Packets queue
-	ov::ManagedQueue<std::shared_ptr<MediaPacket>> _packets_queue;
+	// Provider/transcoder threads push, the worker that runs the stream pops
+	ov::ManagedQueue<std::shared_ptr<MediaPacket>, ov::ManagedQueueType::Mpsc> _packets_queue;
 
 	// Mirror buffer
 	std::vector<std::shared_ptr<MirrorBufferItem>> _mirror_buffer;
@@ -101,4 +109,6 @@ private:
 	// Store the correction values in case of sudden change in PTS.
 	// If the PTS suddenly increases, the filter behaves incorrectly.
 	std::map<MediaTrackId, int64_t> _pts_last;
+
+	MediaRouteWorkerTask _worker_task;
 };
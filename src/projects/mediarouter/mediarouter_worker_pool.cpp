@@ -0,0 +1,514 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mediarouter_worker_pool.h"
+
+#include "mediarouter_private.h"
+#include "mediarouter_stream.h"
+
+// Maximum number of packets processed at once before the stream yields to other streams
+#define MEDIAROUTE_WORKER_MAX_PACKETS_PER_RUN 32
+// Maximum time for an idle worker to sleep
+#define MEDIAROUTE_WORKER_IDLE_TIMEOUT_MS 100
+// Interval to calculate the utilization of the workers
+#define MEDIAROUTE_WORKER_STATS_INTERVAL_US (10 * 1000 * 1000)
+
+thread_local MediaRouteWorkerPool *MediaRouteWorkerPool::_current_pool = nullptr;
+thread_local MediaRouteWorkerPool::Worker *MediaRouteWorkerPool::_current_worker = nullptr;
+
+std::mutex MediaRouteWorkerPool::_pools_mutex;
+std::vector<MediaRouteWorkerPool *> MediaRouteWorkerPool::_pools;
+
+static int64_t GetSteadyTimeUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+MediaRouteWorkerPool::MediaRouteWorkerPool(const ov::String &name, const ov::String &owner, uint32_t worker_count, int buffering_delay_ms, Handler handler)
+	: _name(name),
+	  _owner(owner),
+	  _handler(std::move(handler)),
+	  _buffering_delay_ms(std::max(buffering_delay_ms, 0))
+{
+	for (uint32_t worker_id = 0; worker_id < std::max(worker_count, 1U); worker_id++)
+	{
+		auto worker = std::make_unique<Worker>();
+		worker->worker_id = worker_id;
+
+		_workers.push_back(std::move(worker));
+	}
+}
+
+MediaRouteWorkerPool::~MediaRouteWorkerPool()
+{
+	Stop();
+}
+
+bool MediaRouteWorkerPool::Start()
+{
+	_kill_flag = false;
+	_last_stats_time_us = GetSteadyTimeUs();
+
+	for (auto &worker : _workers)
+	{
+		try
+		{
+			worker->thread = std::thread(&MediaRouteWorkerPool::WorkerThread, this, worker.get());
+			pthread_setname_np(worker->thread.native_handle(), _name.CStr());
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Failed to start %s thread #%u", _name.CStr(), worker->worker_id);
+			Stop();
+
+			return false;
+		}
+	}
+
+	{
+		std::lock_guard lock_guard(_pools_mutex);
+		_pools.push_back(this);
+	}
+
+	return true;
+}
+
+void MediaRouteWorkerPool::Stop()
+{
+	{
+		std::lock_guard lock_guard(_pools_mutex);
+		_pools.erase(std::remove(_pools.begin(), _pools.end(), this), _pools.end());
+	}
+
+	{
+		std::lock_guard lock_guard(_idle_mutex);
+		_kill_flag = true;
+	}
+
+	_idle_condition.notify_all();
+
+	for (auto &worker : _workers)
+	{
+		if (worker->thread.joinable())
+		{
+			worker->thread.join();
+		}
+
+		std::lock_guard lock_guard(worker->ready_streams_mutex);
+		worker->ready_streams.clear();
+	}
+
+	std::lock_guard lock_guard(_delayed_streams_mutex);
+	_delayed_streams = {};
+	_ready_count = 0;
+}
+
+void MediaRouteWorkerPool::Notify(const std::shared_ptr<MediaRouteStream> &stream, bool urgent)
+{
+	if (_kill_flag)
+	{
+		return;
+	}
+
+	auto &task = stream->GetWorkerTask();
+	auto due_time = std::chrono::steady_clock::now();
+
+	if (_buffering_delay_ms > 0)
+	{
+		std::lock_guard lock_guard(task.due_time_list_mutex);
+
+		if (urgent)
+		{
+			// Urgent packets are pushed to the front of the stream queue, and are not delayed
+			task.due_time_list.push_front(due_time);
+		}
+		else
+		{
+			due_time += std::chrono::milliseconds(_buffering_delay_ms);
+			task.due_time_list.push_back(due_time);
+		}
+	}
+
+	if (task.pending_count.fetch_add(1) != 0)
+	{
+		// The stream is already scheduled or being processed by a worker
+		if (urgent && (_buffering_delay_ms > 0))
+		{
+			// If the stream is waiting for the due time of a delayed packet, the urgent packet must not wait for it
+			bool is_delayed = false;
+
+			{
+				std::lock_guard lock_guard(_delayed_streams_mutex);
+				is_delayed = task.is_delayed;
+				task.is_delayed = false;
+			}
+
+			if (is_delayed)
+			{
+				Schedule(GetNotifiedWorker(), stream, true);
+			}
+		}
+
+		return;
+	}
+
+	if ((_buffering_delay_ms > 0) && (urgent == false))
+	{
+		bool is_earliest = false;
+
+		{
+			std::lock_guard lock_guard(_delayed_streams_mutex);
+			DelayStream(stream, due_time);
+			is_earliest = (_delayed_streams.top().stream == stream);
+		}
+
+		if (is_earliest)
+		{
+			// Let an idle worker recalculate the time to wake up
+			std::lock_guard lock_guard(_idle_mutex);
+			_idle_condition.notify_one();
+		}
+
+		return;
+	}
+
+	Schedule(GetNotifiedWorker(), stream, urgent);
+}
+
+MediaRouteWorkerPool::Worker *MediaRouteWorkerPool::GetNotifiedWorker()
+{
+	// Prefer the worker of the current thread to keep the cache warm, otherwise distribute the streams in round-robin
+	return (_current_pool == this)
+			   ? _current_worker
+			   : _workers[_next_worker_index.fetch_add(1, std::memory_order_relaxed) % _workers.size()].get();
+}
+
+void MediaRouteWorkerPool::DelayStream(const std::shared_ptr<MediaRouteStream> &stream, std::chrono::steady_clock::time_point due_time)
+{
+	auto &task = stream->GetWorkerTask();
+
+	task.is_delayed = true;
+	task.delay_generation++;
+
+	_delayed_streams.push({due_time, stream, task.delay_generation});
+}
+
+void MediaRouteWorkerPool::Schedule(Worker *worker, const std::shared_ptr<MediaRouteStream> &stream, bool urgent)
+{
+	{
+		std::lock_guard lock_guard(worker->ready_streams_mutex);
+
+		if (urgent)
+		{
+			worker->ready_streams.push_front(stream);
+		}
+		else
+		{
+			worker->ready_streams.push_back(stream);
+		}
+	}
+
+	_ready_count.fetch_add(1);
+
+	if (_idle_worker_count.load() > 0)
+	{
+		std::lock_guard lock_guard(_idle_mutex);
+		_idle_condition.notify_one();
+	}
+}
+
+std::shared_ptr<MediaRouteStream> MediaRouteWorkerPool::PopReadyStream(Worker *worker)
+{
+	std::lock_guard lock_guard(worker->ready_streams_mutex);
+
+	if (worker->ready_streams.empty())
+	{
+		return nullptr;
+	}
+
+	auto stream = std::move(worker->ready_streams.front());
+	worker->ready_streams.pop_front();
+
+	_ready_count.fetch_sub(1);
+
+	return stream;
+}
+
+std::shared_ptr<MediaRouteStream> MediaRouteWorkerPool::StealReadyStream(Worker *worker)
+{
+	if (_ready_count.load() <= 0)
+	{
+		return nullptr;
+	}
+
+	auto worker_count = _workers.size();
+
+	for (size_t offset = 1; offset < worker_count; offset++)
+	{
+		auto victim = _workers[(worker->worker_id + offset) % worker_count].get();
+
+		std::unique_lock lock(victim->ready_streams_mutex, std::try_to_lock);
+
+		if ((lock.owns_lock() == false) || victim->ready_streams.empty())
+		{
+			continue;
+		}
+
+		auto stream = std::move(victim->ready_streams.back());
+		victim->ready_streams.pop_back();
+
+		_ready_count.fetch_sub(1);
+		worker->steal_count.fetch_add(1, std::memory_order_relaxed);
+
+		return stream;
+	}
+
+	return nullptr;
+}
+
+void MediaRouteWorkerPool::ScheduleDueStreams(Worker *worker)
+{
+	if (_buffering_delay_ms <= 0)
+	{
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+
+	std::unique_lock lock(_delayed_streams_mutex, std::try_to_lock);
+
+	if (lock.owns_lock() == false)
+	{
+		// Another worker is moving the delayed streams
+		return;
+	}
+
+	while ((_delayed_streams.empty() == false) && (_delayed_streams.top().due_time <= now))
+	{
+		auto stream = _delayed_streams.top().stream;
+		auto generation = _delayed_streams.top().generation;
+		_delayed_streams.pop();
+
+		auto &task = stream->GetWorkerTask();
+
+		if ((task.is_delayed == false) || (task.delay_generation != generation))
+		{
+			// The stream has already been rescheduled by an urgent packet
+			continue;
+		}
+
+		task.is_delayed = false;
+
+		Schedule(worker, stream, false);
+	}
+}
+
+bool MediaRouteWorkerPool::RunStream(Worker *worker, const std::shared_ptr<MediaRouteStream> &stream, std::chrono::steady_clock::time_point *due_time)
+{
+	auto &task = stream->GetWorkerTask();
+
+	for (int index = 0; index < MEDIAROUTE_WORKER_MAX_PACKETS_PER_RUN; index++)
+	{
+		if (_buffering_delay_ms > 0)
+		{
+			std::lock_guard lock_guard(task.due_time_list_mutex);
+
+			if (task.due_time_list.empty() == false)
+			{
+				auto front_due_time = task.due_time_list.front();
+
+				if (front_due_time > std::chrono::steady_clock::now())
+				{
+					*due_time = front_due_time;
+					return true;
+				}
+
+				task.due_time_list.pop_front();
+			}
+		}
+
+		_handler(stream);
+		worker->processed_count.fetch_add(1, std::memory_order_relaxed);
+
+		if (task.pending_count.fetch_sub(1) == 1)
+		{
+			// All pending packets are processed - the stream will be scheduled again by the next Notify()
+			return false;
+		}
+	}
+
+	// Yield to other streams
+	*due_time = std::chrono::steady_clock::time_point::min();
+	return true;
+}
+
+void MediaRouteWorkerPool::WorkerThread(Worker *worker)
+{
+	_current_pool = this;
+	_current_worker = worker;
+
+	logtd("Created %s thread #%u", _name.CStr(), worker->worker_id);
+
+	while (_kill_flag == false)
+	{
+		ScheduleDueStreams(worker);
+
+		auto stream = PopReadyStream(worker);
+
+		if (stream == nullptr)
+		{
+			stream = StealReadyStream(worker);
+		}
+
+		if (stream == nullptr)
+		{
+			auto wake_up_time = std::chrono::steady_clock::now() + std::chrono::milliseconds(MEDIAROUTE_WORKER_IDLE_TIMEOUT_MS);
+
+			{
+				std::lock_guard lock_guard(_delayed_streams_mutex);
+
+				if (_delayed_streams.empty() == false)
+				{
+					wake_up_time = std::min(wake_up_time, _delayed_streams.top().due_time);
+				}
+			}
+
+			std::unique_lock lock(_idle_mutex);
+
+			_idle_worker_count.fetch_add(1);
+			_idle_condition.wait_until(lock, wake_up_time, [this]() {
+				return _kill_flag || (_ready_count.load() > 0);
+			});
+			_idle_worker_count.fetch_sub(1);
+
+			continue;
+		}
+
+		auto start_time_us = GetSteadyTimeUs();
+
+		std::chrono::steady_clock::time_point due_time;
+		bool has_pending_packets = RunStream(worker, stream, &due_time);
+
+		worker->busy_time_us.fetch_add(GetSteadyTimeUs() - start_time_us, std::memory_order_relaxed);
+
+		if (has_pending_packets)
+		{
+			bool is_delayed = false;
+			bool is_urgent = false;
+
+			if (due_time > std::chrono::steady_clock::now())
+			{
+				std::lock_guard lock_guard(_delayed_streams_mutex);
+
+				// An urgent packet may have been pushed to the front after RunStream() returned.
+				// Notify() could not reschedule the stream since it was not delayed yet, so check the front again here.
+				// If the urgent packet is pushed after this, Notify() will see is_delayed under the same mutex.
+				{
+					std::lock_guard due_time_lock_guard(stream->GetWorkerTask().due_time_list_mutex);
+					auto &due_time_list = stream->GetWorkerTask().due_time_list;
+
+					if (due_time_list.empty() == false)
+					{
+						due_time = due_time_list.front();
+					}
+				}
+
+				if (due_time > std::chrono::steady_clock::now())
+				{
+					DelayStream(stream, due_time);
+					is_delayed = true;
+				}
+				else
+				{
+					is_urgent = true;
+				}
+			}
+
+			if (is_delayed == false)
+			{
+				Schedule(worker, stream, is_urgent);
+			}
+		}
+
+		UpdateUtilization();
+	}
+
+	logtd("%s thread #%u has been stopped", _name.CStr(), worker->worker_id);
+
+	_current_pool = nullptr;
+	_current_worker = nullptr;
+}
+
+void MediaRouteWorkerPool::UpdateUtilization()
+{
+	auto now_us = GetSteadyTimeUs();
+	auto last_stats_time_us = _last_stats_time_us.load(std::memory_order_relaxed);
+	auto elapsed_us = now_us - last_stats_time_us;
+
+	if ((elapsed_us < MEDIAROUTE_WORKER_STATS_INTERVAL_US) ||
+		(_last_stats_time_us.compare_exchange_strong(last_stats_time_us, now_us) == false))
+	{
+		return;
+	}
+
+	ov::String stats;
+
+	for (auto &worker : _workers)
+	{
+		auto busy_time_us = worker->busy_time_us.load(std::memory_order_relaxed);
+		auto utilization_permille = std::min<int64_t>((busy_time_us - worker->last_busy_time_us) * 1000 / elapsed_us, 1000);
+
+		worker->last_busy_time_us = busy_time_us;
+		worker->utilization_permille = utilization_permille;
+
+		stats.AppendFormat(" #%u: %.1f%%", worker->worker_id, utilization_permille / 10.0);
+	}
+
+	logtd("%s utilization:%s", _name.CStr(), stats.CStr());
+}
+
+std::vector<MediaRouteWorkerPool::WorkerStats> MediaRouteWorkerPool::GetStats() const
+{
+	std::vector<WorkerStats> stats_list;
+
+	for (auto &worker : _workers)
+	{
+		WorkerStats stats;
+
+		stats.worker_id = worker->worker_id;
+		stats.processed_count = worker->processed_count.load(std::memory_order_relaxed);
+		stats.steal_count = worker->steal_count.load(std::memory_order_relaxed);
+		stats.busy_time_us = worker->busy_time_us.load(std::memory_order_relaxed);
+		stats.utilization = worker->utilization_permille.load(std::memory_order_relaxed) / 1000.0;
+
+		stats_list.push_back(stats);
+	}
+
+	return stats_list;
+}
+
+std::vector<MediaRouteWorkerPool::PoolStats> MediaRouteWorkerPool::GetAllStats()
+{
+	std::vector<PoolStats> stats_list;
+
+	// The pool cannot be destroyed while the lock is held, because Stop() removes it from the list first
+	std::lock_guard lock_guard(_pools_mutex);
+
+	for (auto pool : _pools)
+	{
+		PoolStats stats;
+
+		stats.name = pool->_name;
+		stats.owner = pool->_owner;
+		stats.workers = pool->GetStats();
+
+		stats_list.push_back(std::move(stats));
+	}
+
+	return stats_list;
+}
@@ -0,0 +1,178 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class MediaRouteStream;
+
+// Scheduling state of a stream, owned by MediaRouteStream and used only by MediaRouteWorkerPool
+struct MediaRouteWorkerTask
+{
+	// Number of packets notified but not processed yet.
+	// The stream is scheduled when this value changes from 0 to 1, so the stream is never processed by two workers at the same time.
+	std::atomic<int64_t> pending_count{0};
+
+	// Used only when the buffering delay is set - the time at which each pending packet can be processed
+	std::mutex due_time_list_mutex;
+	std::deque<std::chrono::steady_clock::time_point> due_time_list;
+
+	// Guarded by _delayed_streams_mutex of the pool
+	// Whether the stream is waiting in the delayed streams of the pool (it is owned by the pool, not by a worker)
+	bool is_delayed = false;
+	// Used to ignore the entry in the delayed streams after the stream is rescheduled by an urgent packet
+	uint64_t delay_generation = 0;
+};
+
+// Work-stealing worker pool for MediaRouteApplication
+//
+// Each stream is a serial task (the packets of a stream are processed in order by one worker at a time),
+// and a worker that has no ready streams steals a stream from other workers,
+// so a heavy stream does not block the other streams assigned to the same worker.
+class MediaRouteWorkerPool
+{
+public:
+	// Called to process one packet of the stream
+	using Handler = std::function<void(const std::shared_ptr<MediaRouteStream> &stream)>;
+
+	struct WorkerStats
+	{
+		uint32_t worker_id = 0;
+
+		// Number of packets processed
+		uint64_t processed_count = 0;
+		// Number of streams stolen from other workers
+		uint64_t steal_count = 0;
+
+		// Time spent to process the packets
+		int64_t busy_time_us = 0;
+		// Ratio of busy time since the last stats report (0.0 ~ 1.0)
+		double utilization = 0.0;
+	};
+
+	struct PoolStats
+	{
+		ov::String name;
+		// VHost/App name of the pool
+		ov::String owner;
+
+		std::vector<WorkerStats> workers;
+	};
+
+	// name: Used for the thread name and logs (e.g. "InboundWorker")
+	// owner: Used for the stats (e.g. VHost/App name)
+	// buffering_delay_ms: Packets are processed after this delay unless they are urgent
+	MediaRouteWorkerPool(const ov::String &name, const ov::String &owner, uint32_t worker_count, int buffering_delay_ms, Handler handler);
+	~MediaRouteWorkerPool();
+
+	bool Start();
+	void Stop();
+
+	// Notify that a packet is pushed to the stream
+	void Notify(const std::shared_ptr<MediaRouteStream> &stream, bool urgent);
+
+	std::vector<WorkerStats> GetStats() const;
+
+	// Stats of all running pools
+	static std::vector<PoolStats> GetAllStats();
+
+protected:
+	struct DelayedStream
+	{
+		std::chrono::steady_clock::time_point due_time;
+		std::shared_ptr<MediaRouteStream> stream;
+		// Same as delay_generation of the task when the stream is delayed
+		uint64_t generation = 0;
+
+		bool operator>(const DelayedStream &other) const
+		{
+			return due_time > other.due_time;
+		}
+	};
+
+	struct alignas(64) Worker
+	{
+		uint32_t worker_id = 0;
+		std::thread thread;
+
+		std::mutex ready_streams_mutex;
+		// The owner pops from the front, and thieves steal from the back
+		std::deque<std::shared_ptr<MediaRouteStream>> ready_streams;
+
+		std::atomic<uint64_t> processed_count{0};
+		std::atomic<uint64_t> steal_count{0};
+		std::atomic<int64_t> busy_time_us{0};
+
+		// Used to calculate the utilization
+		int64_t last_busy_time_us = 0;
+		std::atomic<uint64_t> utilization_permille{0};
+	};
+
+	void WorkerThread(Worker *worker);
+
+	Worker *GetNotifiedWorker();
+	void Schedule(Worker *worker, const std::shared_ptr<MediaRouteStream> &stream, bool urgent);
+	std::shared_ptr<MediaRouteStream> PopReadyStream(Worker *worker);
+	std::shared_ptr<MediaRouteStream> StealReadyStream(Worker *worker);
+
+	// Move the delayed streams that can be processed to the worker
+	void ScheduleDueStreams(Worker *worker);
+
+	// _delayed_streams_mutex must be locked
+	void DelayStream(const std::shared_ptr<MediaRouteStream> &stream, std::chrono::steady_clock::time_point due_time);
+
+	// Process the packets of the stream
+	//
+	// Returns false if all pending packets are processed.
+	// Otherwise, due_time is set to the time at which the next packet can be processed.
+	bool RunStream(Worker *worker, const std::shared_ptr<MediaRouteStream> &stream, std::chrono::steady_clock::time_point *due_time);
+
+	void UpdateUtilization();
+
+	ov::String _name;
+	ov::String _owner;
+	Handler _handler;
+	int _buffering_delay_ms = 0;
+
+	std::vector<std::unique_ptr<Worker>> _workers;
+	std::atomic<bool> _kill_flag{true};
+
+	// Used to distribute the streams notified by non-worker threads
+	std::atomic<uint32_t> _next_worker_index{0};
+
+	// Used to wake up the idle workers
+	std::mutex _idle_mutex;
+	std::condition_variable _idle_condition;
+	std::atomic<int64_t> _ready_count{0};
+	std::atomic<int32_t> _idle_worker_count{0};
+
+	std::mutex _delayed_streams_mutex;
+	std::priority_queue<DelayedStream, std::vector<DelayedStream>, std::greater<DelayedStream>> _delayed_streams;
+
+	std::atomic<int64_t> _last_stats_time_us{0};
+
+	// Running pools, used to report the stats
+	static std::mutex _pools_mutex;
+	static std::vector<MediaRouteWorkerPool *> _pools;
+
+	// The pool/worker of the current thread (nullptr if the thread is not a worker)
+	static thread_local MediaRouteWorkerPool *_current_pool;
+	static thread_local Worker *_current_worker;
+};
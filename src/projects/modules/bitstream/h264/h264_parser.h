@@ -1,6 +1,7 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <modules/bitstream/nalu/nal_start_code_finder.h>
 #include <modules/bitstream/nalu/nal_unit_bitstream_parser.h>
 #include <stdint.h>
 
@@ -180,13 +181,6 @@ private:
 	friend class H264Parser;
 };
 
-struct NaluIndex
-{
-	size_t _start_offset;
-	size_t _payload_offset;
-	size_t _payload_size;
-};
-
 // H264 Bitstream Parser Utility
 class H264Parser
 {
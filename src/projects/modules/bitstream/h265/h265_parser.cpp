@@ -12,35 +12,7 @@
 // returns -1 if there is no start code in the buffer
 int H265Parser::FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size)
 {
-	size_t offset = 0;
-	start_code_size = 0;
-
-	while (offset < length)
-	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
-
-		if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
-		{
-			if (data[2] == 0x01)
-			{
-				start_code_size = 3;
-			}
-			else
-			{
-				start_code_size = 4;
-			}
-
-			return offset;
-		}
-		else
-		{
-			offset += 1;
-		}
-	}
-
-	return -1;
+	return static_cast<int>(NalStartCodeFinder::Find(bitstream, length, start_code_size));
 }
 
 bool H265Parser::CheckKeyframe(const uint8_t *bitstream, size_t length)
@@ -48,38 +20,27 @@ bool H265Parser::CheckKeyframe(const uint8_t *bitstream, size_t length)
 	size_t offset = 0;
 	while (offset < length)
 	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
+		size_t start_code_size = 0;
 
-		if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
+		auto pos = FindAnnexBStartCode(bitstream + offset, length - offset, start_code_size);
+		if (pos == -1)
 		{
-			if (data[2] == 0x01)
-			{
-				offset += 3;
-			}
-			else
-			{
-				offset += 4;
-			}
+			break;
+		}
 
-			if (length - offset > H265_NAL_UNIT_HEADER_SIZE)
-			{
-				H265NalUnitHeader header;
-				ParseNalUnitHeader(bitstream + offset, H265_NAL_UNIT_HEADER_SIZE, header);
+		offset = offset + pos + start_code_size;
+		if (length - offset > H265_NAL_UNIT_HEADER_SIZE)
+		{
+			H265NalUnitHeader header;
+			ParseNalUnitHeader(bitstream + offset, H265_NAL_UNIT_HEADER_SIZE, header);
 
-				if (header.GetNalUnitType() == H265NALUnitType::IDR_W_RADL ||
-					header.GetNalUnitType() == H265NALUnitType::CRA_NUT ||
-					header.GetNalUnitType() == H265NALUnitType::BLA_W_RADL)
-				{
-					return true;
-				}
+			if (header.GetNalUnitType() == H265NALUnitType::IDR_W_RADL ||
+				header.GetNalUnitType() == H265NALUnitType::CRA_NUT ||
+				header.GetNalUnitType() == H265NALUnitType::BLA_W_RADL)
+			{
+				return true;
 			}
 		}
-		else
-		{
-			offset++;
-		}
 	}
 	return false;
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <modules/bitstream/nalu/nal_start_code_finder.h>
 #include <modules/bitstream/nalu/nal_unit_bitstream_parser.h>
 #include <stdint.h>
 
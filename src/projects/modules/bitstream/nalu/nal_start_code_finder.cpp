@@ -0,0 +1,173 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "nal_start_code_finder.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#	include <immintrin.h>
+#	define NAL_START_CODE_FINDER_X86 1
+#else
+#	define NAL_START_CODE_FINDER_X86 0
+#endif
+
+// Returns the offset of the first 0x000001, or length if not found
+static size_t FindPrefixScalar(const uint8_t *data, size_t offset, size_t length)
+{
+	while ((offset + 2) < length)
+	{
+		// If the 3rd byte isn't 0 or 1, 0x000001 cannot start within these 3 bytes
+		if (data[offset + 2] > 0x01)
+		{
+			offset += 3;
+		}
+		else if ((data[offset + 2] == 0x01) && (data[offset] == 0x00) && (data[offset + 1] == 0x00))
+		{
+			return offset;
+		}
+		else
+		{
+			offset++;
+		}
+	}
+
+	return length;
+}
+
+#if NAL_START_CODE_FINDER_X86
+static size_t FindPrefixSse2(const uint8_t *data, size_t length)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i one = _mm_set1_epi8(0x01);
+
+	size_t offset = 0;
+
+	// Compare 16 candidate positions at once: data[i] == 0 && data[i + 1] == 0 && data[i + 2] == 1
+	while ((offset + 2 + 16) <= length)
+	{
+		auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+		auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset + 1));
+		auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset + 2));
+
+		auto match = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(v0, zero), _mm_cmpeq_epi8(v1, zero)), _mm_cmpeq_epi8(v2, one));
+		auto mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+
+		if (mask != 0)
+		{
+			return offset + __builtin_ctz(mask);
+		}
+
+		offset += 16;
+	}
+
+	return FindPrefixScalar(data, offset, length);
+}
+
+__attribute__((target("avx2"))) static size_t FindPrefixAvx2(const uint8_t *data, size_t length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi8(0x01);
+
+	size_t offset = 0;
+
+	while ((offset + 2 + 32) <= length)
+	{
+		auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+		auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset + 1));
+		auto v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset + 2));
+
+		auto match = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(v0, zero), _mm256_cmpeq_epi8(v1, zero)), _mm256_cmpeq_epi8(v2, one));
+		auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(match));
+
+		if (mask != 0)
+		{
+			return offset + __builtin_ctz(mask);
+		}
+
+		offset += 32;
+	}
+
+	return FindPrefixScalar(data, offset, length);
+}
+#endif	// NAL_START_CODE_FINDER_X86
+
+static size_t FindPrefix(const uint8_t *data, size_t length)
+{
+#if NAL_START_CODE_FINDER_X86
+	static const bool avx2_supported = __builtin_cpu_supports("avx2");
+
+	return avx2_supported ? FindPrefixAvx2(data, length) : FindPrefixSse2(data, length);
+#else
+	return FindPrefixScalar(data, 0, length);
+#endif	// NAL_START_CODE_FINDER_X86
+}
+
+ssize_t NalStartCodeFinder::Find(const uint8_t *bitstream, size_t length, size_t &start_code_size)
+{
+	start_code_size = 0;
+
+	if ((bitstream == nullptr) || (length < 3))
+	{
+		return -1;
+	}
+
+	auto offset = FindPrefix(bitstream, length);
+
+	if (offset >= length)
+	{
+		return -1;
+	}
+
+	// 0x00000001 is found as 0x000001 preceded by 0x00
+	if ((offset > 0) && (bitstream[offset - 1] == 0x00))
+	{
+		start_code_size = 4;
+		return static_cast<ssize_t>(offset - 1);
+	}
+
+	start_code_size = 3;
+	return static_cast<ssize_t>(offset);
+}
+
+std::vector<NaluIndex> NalStartCodeFinder::FindNaluIndexes(const uint8_t *bitstream, size_t length)
+{
+	std::vector<NaluIndex> indexes;
+
+	size_t offset = 0;
+
+	while (offset < length)
+	{
+		size_t start_code_size = 0;
+		auto position = Find(bitstream + offset, length - offset, start_code_size);
+
+		if (indexes.empty() == false)
+		{
+			auto &prev_index = indexes.back();
+
+			// The previous NAL unit ends at the next start code (or the end of the bitstream)
+			prev_index._payload_size = ((position < 0) ? length : (offset + position)) - prev_index._payload_offset;
+		}
+
+		if (position < 0)
+		{
+			break;
+		}
+
+		offset += position;
+
+		NaluIndex index;
+		index._start_offset = offset;
+		index._payload_offset = offset + start_code_size;
+		index._payload_size = length - index._payload_offset;
+
+		indexes.push_back(index);
+
+		offset += start_code_size;
+	}
+
+	return indexes;
+}
@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <vector>
+
+// View of a NAL unit in the Annex-B bitstream (offsets from the beginning of the bitstream)
+struct NaluIndex
+{
+	// Offset of the start code
+	size_t _start_offset;
+	// Offset of the NAL unit header
+	size_t _payload_offset;
+	// Length of the NAL unit (excluding the start code)
+	size_t _payload_size;
+};
+
+// Finds Annex-B start codes (0x000001 or 0x00000001) in H.264/H.265 bitstreams
+//
+// The bitstream is scanned with SSE2 (or AVX2 if the CPU supports it) on x86,
+// and byte-by-byte on other architectures.
+class NalStartCodeFinder
+{
+public:
+	// Returns the offset of the first start code, or -1 if there is no start code in the bitstream
+	// start_code_size is set to 3 (0x000001) or 4 (0x00000001)
+	static ssize_t Find(const uint8_t *bitstream, size_t length, size_t &start_code_size);
+
+	// Returns the views of all NAL units that follow a start code
+	// (the data before the first start code is ignored)
+	static std::vector<NaluIndex> FindNaluIndexes(const uint8_t *bitstream, size_t length);
+};
@@ -1,5 +1,7 @@
 #include "nal_stream_converter.h"
 
+#include "nal_start_code_finder.h"
+
 #define OV_LOG_TAG "NalStreamConverter"
 
 static uint8_t START_CODE[4] = {0x00, 0x00, 0x00, 0x01};
@@ -37,109 +39,48 @@ std::shared_ptr<ov::Data> NalStreamConverter::ConvertXvccToAnnexb(const std::sha
 	return annexb_data;
 }
 
-static inline int GetStartPatternSize(const void *data, size_t length, int first_pattern_size)
-{
-	if (data != nullptr)
-	{
-		auto buffer = static_cast<const uint8_t *>(data);
-
-		if (first_pattern_size > 0)
-		{
-			if ((buffer[0] == 0x00) && (buffer[1] == 0x00))
-			{
-				if (
-					(first_pattern_size == 4) &&
-					((length >= 4) && (buffer[2] == 0x00) && (buffer[3] == 0x01)))
-				{
-					// 0x00 0x00 0x00 0x01 pattern
-					return 4;
-				}
-				else if (
-					(first_pattern_size == 3) &&
-					((length >= 3) && (buffer[2] == 0x01)))
-				{
-					// 0x00 0x00 0x01 pattern
-					return 3;
-				}
-			}
-
-			// pattern_size must be the same with the first_pattern_size
-			return -1;
-		}
-		else
-		{
-			// probe mode
-
-			if ((length >= 4) && ((buffer[0] == 0x00) && (buffer[1] == 0x00) && (buffer[2] == 0x00) && (buffer[3] == 0x01)))
-			{
-				// 0x00 0x00 0x00 0x01 pattern
-				return 4;
-			}
-			if ((length >= 3) && ((buffer[0] == 0x00) && (buffer[1] == 0x00) && (buffer[2] == 0x01)))
-			{
-				// 0x00 0x00 0x01 pattern
-				return 3;
-			}
-		}
-	}
-
-	return -1;
-}
-
 std::shared_ptr<ov::Data> NalStreamConverter::ConvertAnnexbToXvcc(const std::shared_ptr<const ov::Data> &data)
 {
-	// size_t total_pattern_length = 0;
-
 	auto buffer = data->GetDataAs<uint8_t>();
-	size_t remained = data->GetLength();
-	off_t offset = 0;
-	off_t last_offset = 0;
+	size_t length = data->GetLength();
+	size_t offset = 0;
+	size_t last_offset = 0;
 
 	auto avcc_data = std::make_shared<ov::Data>(data->GetLength() + 1024);
 	ov::ByteStream byte_stream(avcc_data);
 
 	// This code assumes that (NALULengthSizeMinusOne == 3)
-	while (remained > 0)
+	while (offset < length)
 	{
-		if (*buffer == 0x00)
-		{
-			auto pattern_size = GetStartPatternSize(buffer, remained, 0);
+		size_t start_code_size = 0;
+		auto position = NalStartCodeFinder::Find(buffer + offset, length - offset, start_code_size);
 
-			if (pattern_size > 0)
-			{
-				if (last_offset < offset)
-				{
-					auto nalu = data->Subdata(last_offset, offset - last_offset);
-
-					byte_stream.WriteBE32(nalu->GetLength());
-					byte_stream.Write(nalu);
+		if (position < 0)
+		{
+			break;
+		}
 
-					last_offset = offset;
-				}
+		offset += position;
 
-				buffer += pattern_size;
-				offset += pattern_size;
-				last_offset += pattern_size;
-				remained -= pattern_size;
+		if (last_offset < offset)
+		{
+			auto nalu = data->Subdata(last_offset, offset - last_offset);
 
-				continue;
-			}
+			byte_stream.WriteBE32(nalu->GetLength());
+			byte_stream.Write(nalu);
 		}
 
-		buffer++;
-		offset++;
-		remained--;
+		offset += start_code_size;
+		last_offset = offset;
 	}
 
-	if (last_offset < offset)
+	if (last_offset < length)
 	{
 		// Append remained data
-		auto nalu = data->Subdata(last_offset, offset - last_offset);
+		auto nalu = data->Subdata(last_offset, length - last_offset);
 
 		byte_stream.WriteBE32(nalu->GetLength());
 		byte_stream.Write(nalu);
-
-		last_offset = offset;
 	}
 
 	return avcc_data;
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <vector>
 
+#include "nal_start_code_finder.h"
+
 class NalUnitSplitter;
 class NalUnitList
 {
@@ -12,20 +14,24 @@ public:
     {
         return _nal_list.size();
     }
+
+    // Returns a view of the NAL unit (the bitstream passed to NalUnitSplitter::Parse() must outlive the returned data)
     std::shared_ptr<ov::Data>   GetNalUnit(uint32_t index)
     {
-        if(index > GetCount() - 1)
+        if(index >= GetCount())
         {
             return nullptr;
         }
 
-        return _nal_list[index];
+        auto &nal_index = _nal_list[index];
+
+        return std::make_shared<ov::Data>(_bitstream + nal_index._payload_offset, nal_index._payload_size, true);
     }
 
 private:
-    std::vector<std::shared_ptr<ov::Data>>   _nal_list;
-    uint8_t _bitstream;
-    size_t _bitstream_length;
+    std::vector<NaluIndex>   _nal_list;
+    const uint8_t *_bitstream = nullptr;
+    size_t _bitstream_length = 0;
 
     friend class NalUnitSplitter;
 };
@@ -35,4 +41,4 @@ class NalUnitSplitter
 public:
     static std::shared_ptr<NalUnitList> Parse(const uint8_t* bitstream, size_t bitstream_length);
 private:
-};
\ No newline at end of file
+};
@@ -408,7 +408,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::AllocateShared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::H264_AVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -424,7 +424,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::AllocateShared<MediaPacket>(*media_packet);
 			new_packet->SetData(converted_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::HVCC);
 			new_packet->SetPacketType(cmn::PacketType::NALU);
@@ -440,7 +440,7 @@ namespace bmff
 				return nullptr;
 			}
 
-			auto new_packet = std::make_shared<MediaPacket>(*media_packet);
+			auto new_packet = ov::AllocateShared<MediaPacket>(*media_packet);
 			new_packet->SetData(raw_data);
 			new_packet->SetBitstreamFormat(cmn::BitstreamFormat::AAC_RAW);
 			new_packet->SetPacketType(cmn::PacketType::RAW);
@@ -206,14 +206,20 @@ namespace bmff
 			}
 		}
 
-		// Save to file
-		if (ov::DumpToFile(file_path, segment->GetData()) == nullptr)
+		// Save to file (Write the chunks in order without merging them)
+		bool append = false;
+		for (const auto &data : segment->GetDataList())
 		{
-			logte("Could not save segment to file: %s", file_path.CStr());
-			return false;
+			if (ov::DumpToFile(file_path, data, 0, append) == nullptr)
+			{
+				logte("Could not save segment to file: %s", file_path.CStr());
+				return false;
+			}
+
+			append = true;
 		}
 
-		_dvr_info.AppendSegment(segment->GetNumber(), segment->GetDuration(), segment->GetData()->GetLength());
+		_dvr_info.AppendSegment(segment->GetNumber(), segment->GetDuration(), segment->GetSize());
 
 		// Delete old segments until the total duration is less than the maximum DVR duration
 		while (_dvr_info.GetTotalDurationMs() > (_config.dvr_duration_sec * 1000.0))
@@ -230,6 +236,9 @@ namespace bmff
 				logte("Could not delete DVR segment file: %s", file_path.CStr());
 			}
 
+			// Close the descriptor kept for sendfile()
+			ov::FileHandleCache::GetInstance()->Remove(file_path);
+
 			if (_observer != nullptr)
 			{
 				_observer->OnMediaSegmentDeleted(_track->GetId(), segment_to_delete.segment_number);
@@ -255,14 +264,15 @@ namespace bmff
 
 		auto file_path = GetSegmentFilePath(segment_number);
 
-		auto data = ov::LoadFromFile(file_path);
-		if (data == nullptr)
+		// The segment is not loaded into the memory, it is sent from the file using sendfile() if possible
+		auto file_range = ov::FileHandleCache::GetInstance()->OpenRange(file_path);
+		if (file_range.IsValid() == false)
 		{
-			logte("Could not load segment from file: %s", file_path.CStr());
+			logte("Could not open segment file: %s", file_path.CStr());
 			return nullptr;
 		}
 
-		auto segment = std::make_shared<FMP4Segment>(segment_number, info.duration_ms, data);
+		auto segment = std::make_shared<FMP4Segment>(segment_number, info.duration_ms, file_range);
 		if (segment == nullptr)
 		{
 			logte("Could not create segment: %u", segment_number);
@@ -64,22 +64,34 @@ namespace bmff
 		std::shared_ptr<ov::Data> _data;
 	};
 
+	// The segment does not have its own buffer, it is represented as a list of the chunk data (rope),
+	// so the bytes of each chunk are kept only once and can be sent using scatter-gather I/O.
 	class FMP4Segment
 	{
 	public:
 		FMP4Segment(uint64_t number, uint64_t target_duration)
 		{
 			_number = number;
-
-			// For performance, reserve memory for 4Mbps * target_duration (sec)
-			_data = std::make_shared<ov::Data>(((1000.0 * 1000.0 * 4.0)/8.0) * (static_cast<double>(target_duration) / 1000.0));
 		}
 
+		// Segment loaded from a file (DVR)
 		FMP4Segment(uint64_t number, double duration_ms, const std::shared_ptr<ov::Data> &data)
 		{
 			_number = number;
 			_duration_ms = duration_ms;
 			_data = data;
+			_size = data->GetLength();
+
+			SetCompleted();
+		}
+
+		// Segment stored in a file (DVR) - the data is read only when GetData()/GetDataList() is called
+		FMP4Segment(uint64_t number, double duration_ms, const ov::FileRange &file_range)
+		{
+			_number = number;
+			_duration_ms = duration_ms;
+			_file_range = file_range;
+			_size = file_range.length;
 
 			SetCompleted();
 		}
@@ -111,20 +123,86 @@ namespace bmff
 
 			_chunks.emplace_back(std::make_shared<FMP4Chunk>(chunk_data, chunk_number, start_timestamp, duration_ms, independent));
 			_last_chunk_number = chunk_number;
+			_size += chunk_data->GetLength();
 
 			lock.unlock();
-			
-			// Append data
+
 			_duration_ms += duration_ms;
-			_data->Append(chunk_data);
 
 			return true;
 		}
 
+		// Get the list of the data that make up this segment (without copying the data)
+		std::vector<std::shared_ptr<const ov::Data>> GetDataList() const
+		{
+			std::vector<std::shared_ptr<const ov::Data>> data_list;
+
+			if (_data != nullptr)
+			{
+				data_list.push_back(_data);
+				return data_list;
+			}
+
+			if (_file_range.IsValid())
+			{
+				auto data = _file_range.Read();
+
+				if (data != nullptr)
+				{
+					data_list.push_back(data);
+				}
+
+				return data_list;
+			}
+
+			std::shared_lock<std::shared_mutex> lock(_chunks_lock);
+
+			data_list.reserve(_chunks.size());
+
+			for (const auto &chunk : _chunks)
+			{
+				data_list.push_back(chunk->GetData());
+			}
+
+			return data_list;
+		}
+
 		// Get Data
+		//
+		// NOTE: This copies all chunks into a new contiguous buffer, use GetDataList() if possible
 		std::shared_ptr<ov::Data> GetData() const
 		{
-			return _data;
+			if (_data != nullptr)
+			{
+				return _data;
+			}
+
+			if (_file_range.IsValid())
+			{
+				return _file_range.Read();
+			}
+
+			std::shared_lock<std::shared_mutex> lock(_chunks_lock);
+
+			auto data = std::make_shared<ov::Data>(_size);
+
+			for (const auto &chunk : _chunks)
+			{
+				data->Append(chunk->GetData());
+			}
+
+			return data;
+		}
+
+		// The segment is stored in a file and can be sent using sendfile()
+		bool IsFileBacked() const
+		{
+			return _file_range.IsValid();
+		}
+
+		const ov::FileRange &GetFileRange() const
+		{
+			return _file_range;
 		}
 
 		// Get Number
@@ -154,7 +232,7 @@ namespace bmff
 
 		size_t GetSize() const
 		{
-			return _data->GetLength();
+			return _size;
 		}
 
 		// Get Last Chunk Number
@@ -209,8 +287,13 @@ namespace bmff
 
 		int64_t _last_chunk_number = -1;
 
-		// Segment Data
+		// Total size of the chunks
+		std::atomic<size_t> _size{0};
+
+		// Segment Data (Only used for the segment loaded from a file)
 		std::shared_ptr<ov::Data> _data;
+		// Segment File (Only used for the segment stored in a file)
+		ov::FileRange _file_range;
 
 		std::vector<Marker> _markers;
 	};
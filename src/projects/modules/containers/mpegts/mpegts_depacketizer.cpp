@@ -9,6 +9,7 @@
 #include <base/ovlibrary/bit_reader.h>
 
 #include "mpegts_depacketizer.h"
+#include "mpegts_packet_buffer.h"
 
 #define OV_LOG_TAG "MPEGTS_DEPACKETIZER"
 
@@ -27,49 +28,73 @@ namespace mpegts
 
 	bool MpegTsDepacketizer::AddPacket(const std::shared_ptr<const ov::Data> &packet)
 	{
-		_buffer->Append(packet);
+		std::shared_ptr<const ov::Data> data = packet;
 
-		while(_buffer->GetLength() >= MPEGTS_MIN_PACKET_SIZE)
+		if(_buffer->IsEmpty() == false)
 		{
-			auto packet = std::make_shared<Packet>(_buffer);
-			
-			uint32_t parsed_length = packet->Parse();
-			if(parsed_length == 0)
-			{
-				_buffer = _buffer->Subdata(MPEGTS_MIN_PACKET_SIZE);
-				continue;
-			}
+			// Prepend the incomplete packet received previously
+			_buffer->Append(packet);
+			data = _buffer;
+		}
 
-			_buffer = _buffer->Subdata(parsed_length);
+		// Index the TS packets of the data without copying them
+		PacketBuffer packet_buffer(data);
 
-			if(AddPacket(packet) == false)
+		for(size_t index = 0; index < packet_buffer.GetPacketCount(); index++)
+		{
+			Packet ts_packet(packet_buffer.GetPacket(index), MPEGTS_MIN_PACKET_SIZE);
+
+			if(ts_packet.Parse() == 0)
 			{
 				continue;
 			}
+
+			AddPacket(ts_packet);
+		}
+
+		// Keep the incomplete packet for the next data
+		auto remaining_length = packet_buffer.GetRemainingLength();
+
+		if(remaining_length == 0)
+		{
+			_buffer->Clear();
+		}
+		else if(data == _buffer)
+		{
+			_buffer->Erase(0, _buffer->GetLength() - remaining_length);
+		}
+		else
+		{
+			_buffer->Append(packet_buffer.GetRemainingData(), remaining_length);
 		}
 
 		return true;
 	}
 
 	bool MpegTsDepacketizer::AddPacket(const std::shared_ptr<Packet> &packet)
+	{
+		return AddPacket(*packet);
+	}
+
+	bool MpegTsDepacketizer::AddPacket(Packet &packet)
 	{
 		auto packet_type = GetPacketType(packet);
 
 		if(packet_type == PacketType::UNSUPPORTED_SECTION || packet_type == PacketType::UNKNOWN)
 		{
 			// FFMPEG ususally sends PID 17 (DVB - SDT), but we don't use this table now
-			logtd("Ignored unsupported or unknown MPEG-TS packets.(PID: %d)", packet->PacketIdentifier());
+			logtd("Ignored unsupported or unknown MPEG-TS packets.(PID: %d)", packet.PacketIdentifier());
 			return false;
 		}
 
 		// Check continuity counter
 		// TODO(Getroot): Later, it can be used for jitter buffer to correct the UDP packet order
-		if (packet->HasPayload())
+		if (packet.HasPayload())
 		{	
-			auto it = _last_continuity_counter_map.find(packet->PacketIdentifier());
+			auto it = _last_continuity_counter_map.find(packet.PacketIdentifier());
 			if(it == _last_continuity_counter_map.end())
 			{
-				_last_continuity_counter_map.emplace(packet->PacketIdentifier(), packet->ContinuityCounter());
+				_last_continuity_counter_map.emplace(packet.PacketIdentifier(), packet.ContinuityCounter());
 			}
 			else
 			{
@@ -85,13 +110,13 @@ namespace mpegts
 					expected_counter = 0;
 				}
 
-				if(packet->ContinuityCounter() != expected_counter)
+				if(packet.ContinuityCounter() != expected_counter)
 				{
 					logtw("An out-of-order packet was received.(PID : %d Expected : %d, Received : %d",
-						packet->PacketIdentifier(), expected_counter, packet->ContinuityCounter());
+						packet.PacketIdentifier(), expected_counter, packet.ContinuityCounter());
 				}
 
-				_last_continuity_counter_map[packet->PacketIdentifier()] = packet->ContinuityCounter();
+				_last_continuity_counter_map[packet.PacketIdentifier()] = packet.ContinuityCounter();
 			}	
 		}
 
@@ -182,9 +207,9 @@ namespace mpegts
 		return es;
 	}
 
-	PacketType MpegTsDepacketizer::GetPacketType(const std::shared_ptr<Packet> &packet)
+	PacketType MpegTsDepacketizer::GetPacketType(Packet &packet)
 	{
-		switch(packet->PacketIdentifier())
+		switch(packet.PacketIdentifier())
 		{
 			// Well known PIDs
 			case static_cast<uint16_t>(WellKnownPacketId::PAT):
@@ -200,7 +225,7 @@ namespace mpegts
 
 		// PMT's PID are in PAT, PES's PID are in PMT
 		// For quickly search they are stored in packet_type_table
-		auto it = _packet_type_table.find(packet->PacketIdentifier());
+		auto it = _packet_type_table.find(packet.PacketIdentifier());
 		if(it == _packet_type_table.end())
 		{
 			return PacketType::UNKNOWN;
@@ -211,18 +236,18 @@ namespace mpegts
 		return packet_type;
 	}
 
-	bool MpegTsDepacketizer::ParseSection(const std::shared_ptr<Packet> &packet)
+	bool MpegTsDepacketizer::ParseSection(Packet &packet)
 	{
-		BitReader bit_reader(packet->Payload(), packet->PayloadLength());
+		BitReader bit_reader(packet.Payload(), packet.PayloadLength());
 
 		// First packet of section, it means need to create new section draft and completed previous section
-		if(packet->PayloadUnitStartIndicator())
+		if(packet.PayloadUnitStartIndicator())
 		{
 			// read pointer field - 8 bits
 			auto pointer_field = bit_reader.ReadBytes<uint8_t>();
 
 			// Check if there was an incomplete section
-			auto prev_section = GetSectionDraft(packet->PacketIdentifier());
+			auto prev_section = GetSectionDraft(packet.PacketIdentifier());
 			if(prev_section != nullptr)
 			{
 				// Extract remaining data of previous section
@@ -234,14 +259,14 @@ namespace mpegts
 					// Previous section completed
 					if(CompleteSection(prev_section) == false)
 					{
-						logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+						logte("Could not complete section(PID: %d)", packet.PacketIdentifier());
 						return false;
 					}
 				}
 				else
 				{
 					// Somethind wrong
-					logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+					logte("Could not complete section(PID: %d)", packet.PacketIdentifier());
 				}
 			}
 
@@ -251,13 +276,13 @@ namespace mpegts
 			// Parsing new section
 			while(bit_reader.BytesRemained() > 0)
 			{
-				auto new_section = std::make_shared<Section>(packet->PacketIdentifier());
+				auto new_section = std::make_shared<Section>(packet.PacketIdentifier());
 				// There can be more than 2 sections
 				auto consumed_bytes = new_section->AppendData(bit_reader.CurrentPosition(), bit_reader.BytesRemained());
 				if(consumed_bytes == 0)
 				{
 					// Something wrong
-					logte("Could not parse section(PID: %d)", packet->PacketIdentifier());
+					logte("Could not parse section(PID: %d)", packet.PacketIdentifier());
 					return false;
 				}
 
@@ -267,7 +292,7 @@ namespace mpegts
 				{
 					if(CompleteSection(new_section) == false)
 					{
-						logte("Could not complete section(PID: %d)", packet->PacketIdentifier());
+						logte("Could not complete section(PID: %d)", packet.PacketIdentifier());
 						return false;
 					}
 				}
@@ -281,17 +306,17 @@ namespace mpegts
 		// There is only continuation of section data
 		else
 		{
-			auto section = GetSectionDraft(packet->PacketIdentifier());
+			auto section = GetSectionDraft(packet.PacketIdentifier());
 			if(section == nullptr)
 			{
 				// Something wrong
-				logte("Could not find section(PID: %d) for depacketizing", packet->PacketIdentifier());
+				logte("Could not find section(PID: %d) for depacketizing", packet.PacketIdentifier());
 				return false;
 			}
 
 			// There is no new section in this packet, so all remained data has to be consumed
-			auto consumed_length = section->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto consumed_length = section->AppendData(packet.Payload(), packet.PayloadLength());
+			if(consumed_length != packet.PayloadLength())
 			{
 				return false;
 			}
@@ -305,21 +330,21 @@ namespace mpegts
 		return true;
 	}
 
-	bool MpegTsDepacketizer::ParsePes(const std::shared_ptr<Packet> &packet)
+	bool MpegTsDepacketizer::ParsePes(Packet &packet)
 	{
 		// First packet of pes, it has pes header
-		if(packet->PayloadUnitStartIndicator())
+		if(packet.PayloadUnitStartIndicator())
 		{
 			// If there is previous PES, that is completed
-			auto prev_pes = GetPesDraft(packet->PacketIdentifier());
+			auto prev_pes = GetPesDraft(packet.PacketIdentifier());
 			if(prev_pes != nullptr)
 			{
 				CompletePes(prev_pes);
 			}
 
-			auto pes = std::make_shared<Pes>(packet->PacketIdentifier());
-			auto consumed_length = pes->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto pes = std::make_shared<Pes>(packet.PacketIdentifier());
+			auto consumed_length = pes->AppendData(packet.Payload(), packet.PayloadLength());
+			if(consumed_length != packet.PayloadLength())
 			{
 				logte("Something wrong with parsing PES");
 				return false;
@@ -340,17 +365,17 @@ namespace mpegts
 		}
 		else
 		{
-			auto pes = GetPesDraft(packet->PacketIdentifier());
+			auto pes = GetPesDraft(packet.PacketIdentifier());
 			if(pes == nullptr)
 			{
 				// This can be called if the encoder sends faster than the server starts. 
 				// These packets can be ignored. 
-				logtd("Could not find the pes draft (PID: %d)", packet->PacketIdentifier());
+				logtd("Could not find the pes draft (PID: %d)", packet.PacketIdentifier());
 				return false;
 			}
 
-			auto consumed_length = pes->AppendData(packet->Payload(), packet->PayloadLength());
-			if(consumed_length != packet->PayloadLength())
+			auto consumed_length = pes->AppendData(packet.Payload(), packet.PayloadLength());
+			if(consumed_length != packet.PayloadLength())
 			{
 				logte("Something wrong with parsing PES");
 				return false;
@@ -58,10 +58,12 @@ namespace mpegts
 		const std::shared_ptr<Pes> PopES();
 
 	private:
-		PacketType GetPacketType(const std::shared_ptr<Packet> &packet);
+		// The packet may refer to the buffer of the received data (Do not keep it)
+		bool AddPacket(Packet &packet);
+		PacketType GetPacketType(Packet &packet);
 
-		bool ParseSection(const std::shared_ptr<Packet> &packet);
-		bool ParsePes(const std::shared_ptr<Packet> &packet);
+		bool ParseSection(Packet &packet);
+		bool ParsePes(Packet &packet);
 		
 		const std::shared_ptr<Section> GetSectionDraft(uint16_t pid);	
 		// incompleted section will be inserted
@@ -54,18 +54,6 @@ namespace mpegts
         return _last_segment_id ++;
     }
 
-    std::shared_ptr<ov::Data> Packager::MergeTsPacketData(const std::vector<std::shared_ptr<mpegts::Packet>> &ts_packets)
-    {
-        auto data = std::make_shared<ov::Data>(SEGMENT_BUFFER_SIZE);
-
-        for (const auto &ts_packet : ts_packets)
-        {
-            data->Append(ts_packet->GetData());
-        }
-
-        return data;
-    }
-    
     std::shared_ptr<const MediaTrack> Packager::GetMediaTrack(uint32_t track_id) const
     {
         auto it = _media_tracks.find(track_id);
@@ -88,7 +76,7 @@ namespace mpegts
         return it->second;
     }
 
-    void Packager::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets)
+    void Packager::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data)
     {
         logtd("OnPsi %u tracks", tracks.size());
 
@@ -116,8 +104,7 @@ namespace mpegts
             _sample_buffers.emplace(track->GetId(), std::make_shared<SampleBuffer>(track));
         }
 
-        _psi_packets = psi_packets;
-        _psi_packet_data = MergeTsPacketData(psi_packets);
+        _psi_packet_data = psi_data;
     }
 
 	void Packager::Flush()
@@ -176,7 +163,7 @@ namespace mpegts
 		return segment->GetData();
 	}
 
-    void Packager::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets)
+    void Packager::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data)
     {
        //logtd("OnFrame track_id %u", media_packet->GetTrackId());
 
@@ -190,7 +177,7 @@ namespace mpegts
             return;
         }
 
-		auto sample = mpegts::Sample(media_packet, MergeTsPacketData(pes_packets), track->GetTimeBase().GetTimescale());
+		auto sample = mpegts::Sample(media_packet, frame_data, track->GetTimeBase().GetTimescale());
 
 		if (track_id == _main_track_id)
 		{
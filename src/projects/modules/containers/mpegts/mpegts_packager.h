@@ -407,9 +407,9 @@ namespace mpegts
         ////////////////////////////////
 
         // PAT, PMT, ...
-        void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets) override;
+        void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data) override;
         // PES packets for a frame
-        void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets) override;
+        void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data) override;
 
 		void Flush();
 
@@ -422,8 +422,6 @@ namespace mpegts
 
         uint64_t GetNextSegmentId();
 
-        std::shared_ptr<ov::Data> MergeTsPacketData(const std::vector<std::shared_ptr<mpegts::Packet>> &ts_packets);
-    
         std::shared_ptr<const MediaTrack> GetMediaTrack(uint32_t track_id) const;
         std::shared_ptr<SampleBuffer> GetSampleBuffer(uint32_t track_id) const;
 
@@ -468,8 +466,7 @@ namespace mpegts
 
         uint32_t _main_track_id = UINT32_MAX;
         std::map<uint32_t, std::shared_ptr<const MediaTrack>> _media_tracks;
-        std::vector<std::shared_ptr<mpegts::Packet>> _psi_packets;
-        std::shared_ptr<ov::Data> _psi_packet_data;
+        std::shared_ptr<const ov::Data> _psi_packet_data;
 
         uint64_t _last_segment_id = 0;
 
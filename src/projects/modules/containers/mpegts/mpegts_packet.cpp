@@ -11,6 +11,7 @@
 #include <base/ovlibrary/byte_io.h>
 #include <base/ovlibrary/memory_utilities.h>
 
+#include "mpegts_packet_buffer.h"
 #include "mpegts_section.h"
 #include "mpegts_pes.h"
 
@@ -22,6 +23,7 @@ namespace mpegts
 	{
 		_data = std::make_shared<ov::Data>(MPEGTS_MIN_PACKET_SIZE);
 		_buffer = _data->GetWritableDataAs<uint8_t>();
+		_buffer_length = _data->GetLength();
 	}
 
 	Packet::Packet(const std::shared_ptr<ov::Data> &data)
@@ -33,6 +35,18 @@ namespace mpegts
 
 		_data = data;
 		_buffer = _data->GetWritableDataAs<uint8_t>();
+		_buffer_length = _data->GetLength();
+	}
+
+	Packet::Packet(const uint8_t *buffer, size_t length)
+	{
+		if(length < MPEGTS_MIN_PACKET_SIZE)
+		{
+			return;
+		}
+
+		_buffer = buffer;
+		_buffer_length = length;
 	}
 
 	Packet::~Packet()
@@ -60,23 +74,20 @@ namespace mpegts
 		return packet;
 	}
 
-	std::vector<std::shared_ptr<Packet>> Packet::Build(const std::shared_ptr<Pes> &pes, bool has_pcr, uint8_t continuity_counter)
+	size_t Packet::Build(const std::shared_ptr<Pes> &pes, bool has_pcr, uint8_t continuity_counter, PacketBuffer *packet_buffer)
 	{
-		std::vector<std::shared_ptr<Packet>> packets;
-
 		if (pes->GetData() == nullptr)
 		{
-			return packets;
+			return 0;
 		}
 
 		auto pes_data = pes->GetData()->GetDataAs<uint8_t>();
 		size_t pes_data_length = pes->GetData()->GetLength();
 		size_t offset = 0;
-		uint8_t packet_count = 0;
+		size_t packet_count = 0;
+		auto pid = pes->PID();
 
-		logtd("PES Data Length: %d", pes_data_length);
-
-		size_t total_payload_size = 0;
+		logtd("PES Data Length: %zu", pes_data_length);
 
 		bool first_packet = true;
 		while (offset < pes_data_length)
@@ -84,7 +95,7 @@ namespace mpegts
 			size_t remaining_pes_bytes = pes_data_length - offset;
 			size_t payload_buffer_size = MPEGTS_MIN_PACKET_SIZE - MPEGTS_HEADER_SIZE;
 			bool has_adaptation_field = false;
-			
+
 			// It means that this is the first packet
 			if (has_pcr)
 			{
@@ -97,8 +108,8 @@ namespace mpegts
 				has_adaptation_field = true;
 				payload_buffer_size -= 2; // Adaptation field(2)
 			}
-			
-			// We always use adaptation field for the last packet 
+
+			// We always use adaptation field for the last packet
 			// It may be last packet, but if the remaining bytes are 183, it is not the last packet
 			if (remaining_pes_bytes < payload_buffer_size)
 			{
@@ -113,94 +124,71 @@ namespace mpegts
 
 			size_t payload_size = std::min(payload_buffer_size, remaining_pes_bytes);
 
-			logtd("remaining (%d) payload_size(%d) payload_buffer_size(%d) has_adaptation_field(%d)", remaining_pes_bytes, payload_size, payload_buffer_size, has_adaptation_field);
-
-			total_payload_size += payload_size;
-			logtd("Payload Size: %d / %d", payload_size, total_payload_size);
-
-			auto packet = std::make_shared<Packet>();
-
-			packet->_sync_byte = 0x47;
-			packet->_transport_error_indicator = false;
-			packet->_payload_unit_start_indicator = first_packet;
-			packet->_transport_priority = false;
-			packet->_packet_identifier = pes->PID();
-			packet->_transport_scrambling_control = 0;
+			// The packet is filled with 0xFF (stuffing bytes)
+			auto packet = packet_buffer->AllocatePacket();
+			if (packet == nullptr)
+			{
+				return 0;
+			}
 
 			// adaptation_field_control
 			// 01: No adaptation_field, payload only
-			// 10: Adaptation_field only, no payload
 			// 11: Adaptation_field followed by payload
+			uint8_t adaptation_field_control = has_adaptation_field ? 0b11 : 0b01;
+			uint8_t packet_continuity_counter = (continuity_counter + packet_count) % 16;
 
-			if (has_adaptation_field == false && payload_size > 0)
-			{
-				packet->_adaptation_field_control = 0b01;
-			}
-			else if (has_adaptation_field == true && payload_size > 0)
-			{
-				packet->_adaptation_field_control = 0b11;
-			}
-			else
-			{
-				// rare case
-				packet->_adaptation_field_control = 0b10;
-			}
+			//  76543210  76543210  76543210  76543210
+			// [ssssssss][tpTPPPPP][PPPPPPPP][SSaacccc]
+			packet[0] = MPEGTS_SYNC_BYTE;
+			packet[1] = (first_packet ? 0x40 : 0x00) | ((pid >> 8) & 0x1F);
+			packet[2] = pid & 0xFF;
+			packet[3] = (adaptation_field_control << 4) | packet_continuity_counter;
 
-			packet->_continuity_counter = (continuity_counter + packet_count) % 16;
-			packet_count ++;
+			size_t position = MPEGTS_HEADER_SIZE;
 
 			if (has_adaptation_field)
 			{
 				size_t stuffing_bytes = payload_buffer_size - payload_size;
-				packet->_adaptation_field._length = 1 + (has_pcr ? 6 : 0) + stuffing_bytes; // flags(8bits) + PCR(6) + stuffing_bytes
-				packet->_adaptation_field._pcr_flag = has_pcr;
-				packet->_adaptation_field._random_access_indicator = true;
 
-				packet->_adaptation_field_size = 1 + packet->_adaptation_field._length; // length(8bits) + flags(8bits) + PCR(6) + stuffing_bytes
+				// flags(8bits) + PCR(6) + stuffing_bytes
+				packet[position++] = static_cast<uint8_t>(1 + (has_pcr ? 6 : 0) + stuffing_bytes);
+				// random_access_indicator (+ PCR_flag)
+				packet[position++] = 0x40 | (has_pcr ? 0x10 : 0x00);
 
-				if (packet->_adaptation_field._pcr_flag)
+				if (has_pcr)
 				{
 					// PCR
-					uint64_t pcr_base = pes->Pcr() / 300;
-					uint32_t pcr_ext = pes->Pcr() % 300;
-					// auto most_significant_32_bits_pcr = static_cast<uint32_t>(pcr_base >> 1);
-					// auto pcr_last_bit_reserved_and_extension = static_cast<uint16_t>(((pcr_base & 0x1) << 15) | 0x7e00);
-
-					packet->_adaptation_field._pcr._base = pcr_base & 0x1FFFFFFFF; // 33 bits
-					packet->_adaptation_field._pcr._reserved = 0x3F; // 6 bits
-					packet->_adaptation_field._pcr._extension = pcr_ext & 0x1FF; // 9 bits
+					uint64_t pcr_base = (pes->Pcr() / 300) & 0x1FFFFFFFF;  // 33 bits
+					uint32_t pcr_ext = (pes->Pcr() % 300) & 0x1FF;		   // 9 bits
+
+					packet[position++] = static_cast<uint8_t>(pcr_base >> 25);
+					packet[position++] = static_cast<uint8_t>(pcr_base >> 17);
+					packet[position++] = static_cast<uint8_t>(pcr_base >> 9);
+					packet[position++] = static_cast<uint8_t>(pcr_base >> 1);
+					// base(1) + reserved(6) + extension(1)
+					packet[position++] = static_cast<uint8_t>(((pcr_base & 0x01) << 7) | 0x7E | ((pcr_ext >> 8) & 0x01));
+					packet[position++] = static_cast<uint8_t>(pcr_ext & 0xFF);
 				}
 
-				packet->_adaptation_field._stuffing_bytes = stuffing_bytes;
+				// Stuffing bytes (already filled with 0xFF)
+				position += stuffing_bytes;
 			}
 
-			auto total_packet_size = MPEGTS_HEADER_SIZE + packet->_adaptation_field_size + payload_size;
-			logtd("Packet: PID(%d) ContinuityCounter(%d) AdaptationFieldControl(%d) AdaptationFieldSize(%d) PayloadSize(%d) Total(%d)", packet->_packet_identifier, packet->_continuity_counter, packet->_adaptation_field_control, packet->_adaptation_field_size, payload_size, total_packet_size);
-
 			// Payload
-			if (payload_size > 0)
-			{
-				packet->_payload_data = std::make_shared<ov::Data>(pes_data + offset, payload_size);
-			}
-			else
-			{
-				logtc("Unexpected payload size: %d", payload_size);
-			}
-
-			offset += packet->_payload_data->GetLength();
-
-			packet->_need_to_update_data = true;
+			::memcpy(packet + position, pes_data + offset, payload_size);
+			offset += payload_size;
 
+			OV_ASSERT((position + payload_size) == MPEGTS_MIN_PACKET_SIZE, "Invalid packet size: %zu", position + payload_size);
 			OV_ASSERT(offset <= pes_data_length, "Offset is out of range");
 
-			packets.push_back(packet);
+			packet_count++;
 
 			// just set the pcr to the first packet
 			has_pcr = false;
 			first_packet = false;
 		}
 
-		return packets;
+		return packet_count;
 	}
 
 	void Packet::UpdateData()
@@ -252,7 +240,15 @@ namespace mpegts
 		if (has_payload)
 		{
 			// Copy payload
-			ts_writer->WriteData(_payload_data->GetDataAs<uint8_t>(), _payload_data->GetLength());
+			if (_payload_data != nullptr)
+			{
+				ts_writer->WriteData(_payload_data->GetDataAs<uint8_t>(), _payload_data->GetLength());
+			}
+			else
+			{
+				// Parsed packet refers to the payload of the original buffer
+				ts_writer->WriteData(_payload, _payload_length);
+			}
 		}
 
 		if (ts_writer->GetDataSize() != MPEGTS_MIN_PACKET_SIZE)
@@ -270,6 +266,7 @@ namespace mpegts
 		}
 
 		_buffer = _data->GetWritableDataAs<uint8_t>();
+		_buffer_length = _data->GetLength();
 		_payload = _buffer + payload_offset;
 		_payload_length = _data->GetLength() - payload_offset;
 
@@ -363,18 +360,32 @@ namespace mpegts
 	uint32_t Packet::Parse()
 	{
 		// already parsed
-		if(_ts_parser != nullptr)
+		if(_parsed)
 		{
 			return 0;
 		}
 
 		// this time, ome only supports for 188 bytes mpegts packet
-		if(_data->GetLength() < MPEGTS_MIN_PACKET_SIZE)
+		if((_buffer == nullptr) || (_buffer_length < MPEGTS_MIN_PACKET_SIZE))
 		{
 			return 0;
 		}
 
-		_ts_parser = std::make_shared<BitReader>(_buffer, _data->GetLength());
+		_parsed = true;
+
+		// The reader is used only while parsing, to avoid allocating it for each packet
+		BitReader ts_parser(_buffer, MPEGTS_MIN_PACKET_SIZE);
+		_ts_parser = &ts_parser;
+
+		auto parsed_length = ParseInternal();
+
+		_ts_parser = nullptr;
+
+		return parsed_length;
+	}
+
+	uint32_t Packet::ParseInternal()
+	{
 
 		//  76543210  76543210  76543210  76543210
 		// [ssssssss][tpTPPPPP][PPPPPPPP][SSaacccc]...
@@ -473,7 +484,6 @@ namespace mpegts
 	{
 		_payload = _ts_parser->CurrentPosition();
 		_payload_length = _packet_size - _ts_parser->BytesConsumed();
-		_payload_data = std::make_shared<ov::Data>(_payload, _payload_length);
 		
 		// Just skip A packet
 		return _ts_parser->SkipBytes(_payload_length);
@@ -503,7 +513,7 @@ namespace mpegts
 
 		// Hex
 		str.AppendFormat("\n\tHex: ");
-		str.Append(ov::ToHexStringWithDelimiter(_data.get(), ' '));
+		str.Append(ov::ToHexStringWithDelimiter(_buffer, _buffer_length, ' '));
 
 		return str;
 	}
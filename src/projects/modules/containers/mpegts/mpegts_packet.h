@@ -153,11 +153,14 @@ namespace mpegts
 
 	class Section;
 	class Pes;
+	class PacketBuffer;
 	class Packet
 	{
 	public:
 		Packet();
 		Packet(const std::shared_ptr<ov::Data> &data);
+		// Refers to the buffer without copying it (for parsing, the buffer must be valid while using the packet)
+		Packet(const uint8_t *buffer, size_t length);
 		virtual ~Packet();
 
 		//Note: Now, it only supports 188 bytes of mpegts packet
@@ -166,7 +169,8 @@ namespace mpegts
 		uint32_t Parse();
 
 		static std::shared_ptr<Packet> Build(const std::shared_ptr<Section> &section, uint8_t continuity_counter);
-		static std::vector<std::shared_ptr<Packet>> Build(const std::shared_ptr<Pes> &pes, bool has_pcr, uint8_t continuity_counter);
+		// Write the TS packets of the PES into the packet_buffer, and returns the number of packets
+		static size_t Build(const std::shared_ptr<Pes> &pes, bool has_pcr, uint8_t continuity_counter, PacketBuffer *packet_buffer);
 
 		// Getter
 		uint8_t SyncByte();
@@ -192,6 +196,7 @@ namespace mpegts
 		ov::String ToDebugString() const;
 
 	private:
+		uint32_t ParseInternal();
 		bool ParseAdaptationHeader();
 		bool ParsePayload();
 		void UpdateData();
@@ -228,8 +233,11 @@ namespace mpegts
 		AdaptationField	_adaptation_field;
 		size_t			_adaptation_field_size = 0U;
 
-		std::shared_ptr<BitReader>	_ts_parser = nullptr;
+		// Valid only while parsing
+		BitReader *					_ts_parser = nullptr;
+		bool						_parsed = false;
 		const uint8_t *				_buffer = nullptr;
+		size_t						_buffer_length = 0;
 		
 		// Before UpdateData(), it will be used in UpdateData()
 		std::shared_ptr<ov::Data>	_payload_data = nullptr;
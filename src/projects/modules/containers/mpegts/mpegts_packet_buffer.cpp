@@ -0,0 +1,71 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mpegts_packet_buffer.h"
+
+#include "mpegts_private.h"
+
+namespace mpegts
+{
+	PacketBuffer::PacketBuffer(size_t reserved_packet_count)
+	{
+		_writable_data = std::make_shared<ov::Data>(std::max<size_t>(reserved_packet_count, 1) * MPEGTS_MIN_PACKET_SIZE);
+		_data = _writable_data;
+
+		_offsets.reserve(reserved_packet_count);
+	}
+
+	PacketBuffer::PacketBuffer(const std::shared_ptr<const ov::Data> &data)
+		: _data(data)
+	{
+		auto buffer = _data->GetDataAs<uint8_t>();
+		size_t length = _data->GetLength();
+		size_t offset = 0;
+
+		_offsets.reserve(length / MPEGTS_MIN_PACKET_SIZE);
+
+		while ((length - offset) >= MPEGTS_MIN_PACKET_SIZE)
+		{
+			if (buffer[offset] != MPEGTS_SYNC_BYTE)
+			{
+				// Find the next sync byte
+				offset++;
+				continue;
+			}
+
+			_offsets.push_back(static_cast<uint32_t>(offset));
+			offset += MPEGTS_MIN_PACKET_SIZE;
+		}
+
+		_remaining_length = length - offset;
+	}
+
+	uint8_t *PacketBuffer::AllocatePacket()
+	{
+		if (_writable_data == nullptr)
+		{
+			// Read-only buffer
+			OV_ASSERT2(false);
+			return nullptr;
+		}
+
+		auto offset = _writable_data->GetLength();
+
+		if (_writable_data->SetLength(offset + MPEGTS_MIN_PACKET_SIZE) == false)
+		{
+			return nullptr;
+		}
+
+		auto packet = _writable_data->GetWritableDataAs<uint8_t>() + offset;
+		::memset(packet, 0xFF, MPEGTS_MIN_PACKET_SIZE);
+
+		_offsets.push_back(static_cast<uint32_t>(offset));
+
+		return packet;
+	}
+}  // namespace mpegts
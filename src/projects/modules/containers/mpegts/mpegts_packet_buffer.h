@@ -0,0 +1,68 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "mpegts_packet.h"
+
+namespace mpegts
+{
+	// TS packets stored in one contiguous buffer (with the offsets of each packet)
+	//
+	// Used instead of std::vector<std::shared_ptr<Packet>> to avoid allocating an object per 188-byte packet
+	// - Writing: AllocatePacket() appends a packet to the end of the buffer
+	// - Reading: The constructor indexes the packets of the data (The data is not copied)
+	class PacketBuffer
+	{
+	public:
+		// For writing
+		explicit PacketBuffer(size_t reserved_packet_count = 0);
+		// For reading (Bytes that are not aligned to the sync byte are skipped)
+		PacketBuffer(const std::shared_ptr<const ov::Data> &data);
+
+		// Returns the buffer of a new packet (filled with 0xFF)
+		//
+		// The pointer is valid until the next call of AllocatePacket()
+		uint8_t *AllocatePacket();
+
+		size_t GetPacketCount() const
+		{
+			return _offsets.size();
+		}
+
+		const uint8_t *GetPacket(size_t index) const
+		{
+			return _data->GetDataAs<uint8_t>() + _offsets[index];
+		}
+
+		// The number of bytes after the last packet (an incomplete packet)
+		size_t GetRemainingLength() const
+		{
+			return _remaining_length;
+		}
+
+		const uint8_t *GetRemainingData() const
+		{
+			return _data->GetDataAs<uint8_t>() + (_data->GetLength() - _remaining_length);
+		}
+
+		std::shared_ptr<const ov::Data> GetData() const
+		{
+			return _data;
+		}
+
+	protected:
+		std::shared_ptr<ov::Data> _writable_data;
+		std::shared_ptr<const ov::Data> _data;
+
+		std::vector<uint32_t> _offsets;
+		size_t _remaining_length = 0;
+	};
+}  // namespace mpegts
@@ -114,6 +114,8 @@ namespace mpegts
         logtd("PMT : %s", _pmt_packet->GetData()->ToHexString().CStr());
 #endif
 
+        _psi_data = MergePackets({_pat_packet, _pmt_packet});
+
         BroadcastPsi();
 
         _started = true;
@@ -171,8 +173,10 @@ namespace mpegts
 
         auto continuity_counter = GetNextContinuityCounter(pid);
         bool has_pcr = (pid == _pmt._pcr_pid);
-        auto packets = Packet::Build(pes, has_pcr, continuity_counter);
-        if (packets.empty())
+        // All TS packets of the frame are written into one buffer
+        PacketBuffer packet_buffer((pes->GetData() != nullptr) ? ((pes->GetData()->GetLength() / (MPEGTS_MIN_PACKET_SIZE - MPEGTS_HEADER_SIZE)) + 2) : 0);
+        auto packet_count = Packet::Build(pes, has_pcr, continuity_counter, &packet_buffer);
+        if (packet_count == 0)
         {
             return false;
         }
@@ -181,19 +185,33 @@ namespace mpegts
         // debug print
         logtd("------------------------------------------------------------------------");
         logtd("Track(%u) / MediaPacket(%u)", media_packet->GetTrackId(), media_packet->GetData()->GetLength());
-        for (const auto &packet : packets)
+        for (size_t index = 0; index < packet_buffer.GetPacketCount(); index++)
         {
-            logtd("%s", packet->ToDebugString().CStr());
+            Packet packet(packet_buffer.GetPacket(index), MPEGTS_MIN_PACKET_SIZE);
+            packet.Parse();
+            logtd("%s", packet.ToDebugString().CStr());
         }
 #endif
 
-        IncreaseContinuityCounter(pid, static_cast<uint8_t>(packets.size() - 1));
+        IncreaseContinuityCounter(pid, static_cast<uint8_t>(packet_count - 1));
 
-        BroadcastFrame(media_packet, packets);
+        BroadcastFrame(media_packet, packet_buffer.GetData());
 
         return true;
     }
 
+    std::shared_ptr<ov::Data> Packetizer::MergePackets(const std::vector<std::shared_ptr<mpegts::Packet>> &packets)
+    {
+        auto data = std::make_shared<ov::Data>(packets.size() * MPEGTS_MIN_PACKET_SIZE);
+
+        for (const auto &packet : packets)
+        {
+            data->Append(packet->GetData());
+        }
+
+        return data;
+    }
+
     const Packetizer::Config &Packetizer::GetConfig() const
     {
         return _config;
@@ -410,15 +428,16 @@ namespace mpegts
 
         for (const auto &sink : _sinks)
         {
-            sink->OnPsi(tracks, {_pat_packet, _pmt_packet});
+            sink->OnPsi(tracks, _psi_data);
         }
     }
 
-    void Packetizer::BroadcastFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets)
+    void Packetizer::BroadcastFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data)
     {
+        // The buffer is shared with all sinks
         for (const auto &sink : _sinks)
         {
-            sink->OnFrame(media_packet, pes_packets);
+            sink->OnFrame(media_packet, frame_data);
         }
     }
 }
\ No newline at end of file
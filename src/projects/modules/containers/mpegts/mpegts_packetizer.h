@@ -15,6 +15,7 @@
 #include "mpegts_section.h"
 #include "mpegts_pes.h"
 #include "mpegts_packet.h"
+#include "mpegts_packet_buffer.h"
 
 namespace mpegts
 {
@@ -22,10 +23,11 @@ namespace mpegts
     {
     public:
         virtual ~PacketizerSink() = default;
-        // PAT, PMT, ...
-        virtual void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets) = 0;
-        // PES packets for a frame
-        virtual void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets) = 0;
+        // PAT, PMT, ... (TS packets are concatenated into one buffer)
+        virtual void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data) = 0;
+        // TS packets of PES for a frame (concatenated into one buffer)
+        // The data can be shared with other sinks, so it must not be modified
+        virtual void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data) = 0;
     };
 
     // PAT, PMT, PES, PES, PES, ...
@@ -54,6 +56,9 @@ namespace mpegts
         
         bool AppendFrame(const std::shared_ptr<const MediaPacket> &media_packet);
 
+        // Concatenate the TS packets into one buffer
+        static std::shared_ptr<ov::Data> MergePackets(const std::vector<std::shared_ptr<mpegts::Packet>> &packets);
+
     private:
         const Config &GetConfig() const;
 
@@ -73,7 +78,7 @@ namespace mpegts
         std::shared_ptr<const MediaTrack> GetMediaTrack(uint32_t track_id) const;
 
         void BroadcastPsi();
-        void BroadcastFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets);
+        void BroadcastFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data);
 
         Config _config;
         bool _started = false;
@@ -92,6 +97,8 @@ namespace mpegts
         // PMT
         PMT _pmt;
         std::shared_ptr<mpegts::Packet> _pmt_packet;
+        // PAT + PMT
+        std::shared_ptr<const ov::Data> _psi_data;
 
         // PID
         // track id : pid
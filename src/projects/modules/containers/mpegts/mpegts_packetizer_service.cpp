@@ -0,0 +1,302 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "mpegts_packetizer_service.h"
+
+#include "mpegts_private.h"
+
+namespace mpegts
+{
+	SharedPacketizer::SharedPacketizer(const ov::String &key)
+		: _key(key)
+	{
+		_packetizer = std::make_shared<Packetizer>();
+		_collector = std::make_shared<Collector>();
+
+		_packetizer->AddSink(_collector);
+	}
+
+	bool SharedPacketizer::Start(const std::vector<std::shared_ptr<const MediaTrack>> &tracks)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		for (const auto &track : tracks)
+		{
+			if (_packetizer->AddTrack(track) == false)
+			{
+				// Unsupported tracks are excluded from the TS
+				continue;
+			}
+
+			_tracks.push_back(track);
+			_has_video = _has_video || (track->GetMediaType() == cmn::MediaType::Video);
+		}
+
+		return _packetizer->Start();
+	}
+
+	std::shared_ptr<const ov::Data> SharedPacketizer::GetPsiData() const
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		return _collector->psi_data;
+	}
+
+	std::shared_ptr<const ov::Data> SharedPacketizer::Packetize(const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		std::lock_guard lock_guard(_mutex);
+
+		auto key = media_packet.get();
+		auto item = _frame_cache.find(key);
+
+		if (item != _frame_cache.end())
+		{
+			if (item->second.media_packet.lock() == media_packet)
+			{
+				// Another subscriber has already packetized this frame
+				return item->second.frame_data;
+			}
+
+			// The address is reused by another MediaPacket (it will be replaced below)
+		}
+
+		_collector->frame_data = nullptr;
+		_packetizer->AppendFrame(media_packet);
+
+		auto frame_data = std::move(_collector->frame_data);
+
+		// The frame is cached even if there is only one subscriber, because another subscriber
+		// may be added while the frame is queued for it
+		if (item != _frame_cache.end())
+		{
+			item->second = CachedFrame{media_packet, frame_data};
+		}
+		else
+		{
+			while (_frame_order.size() >= MaxCachedFrameCount)
+			{
+				_frame_cache.erase(_frame_order.front());
+				_frame_order.pop_front();
+			}
+
+			_frame_cache.emplace(key, CachedFrame{media_packet, frame_data});
+			_frame_order.push_back(key);
+		}
+
+		return frame_data;
+	}
+
+	PacketizerSubscription::PacketizerSubscription(const std::shared_ptr<SharedPacketizer> &packetizer, const std::shared_ptr<PacketizerSink> &sink)
+		: _packetizer(packetizer),
+		  _sink(sink)
+	{
+	}
+
+	bool PacketizerSubscription::AppendFrame(const std::shared_ptr<const MediaPacket> &media_packet)
+	{
+		auto sink = _sink.lock();
+
+		if (sink == nullptr)
+		{
+			return false;
+		}
+
+		if (_packetizer->HasVideo() && (_first_video_frame_received == false) && (media_packet->GetMediaType() == cmn::MediaType::Video))
+		{
+			// This subscriber may be started in the middle of the stream
+			if (media_packet->IsKeyFrame() == false)
+			{
+				return false;
+			}
+
+			_first_video_frame_received = true;
+		}
+
+		auto frame_data = _packetizer->Packetize(media_packet);
+
+		if (frame_data == nullptr)
+		{
+			return false;
+		}
+
+		auto random_access = (media_packet->GetMediaType() != cmn::MediaType::Video) || media_packet->IsKeyFrame();
+
+		sink->OnFrame(media_packet, RewriteContinuityCounters(frame_data, random_access));
+
+		return true;
+	}
+
+	std::shared_ptr<const ov::Data> PacketizerSubscription::RewriteContinuityCounters(const std::shared_ptr<const ov::Data> &frame_data, bool random_access)
+	{
+		std::shared_ptr<ov::Data> rewritten_data;
+		uint8_t *writable_data = nullptr;
+
+		auto get_writable_data = [&]() {
+			if (rewritten_data == nullptr)
+			{
+				// The shared data is not modified
+				rewritten_data = frame_data->Clone();
+				writable_data = rewritten_data->GetWritableDataAs<uint8_t>();
+			}
+
+			return writable_data;
+		};
+
+		auto data = frame_data->GetDataAs<uint8_t>();
+		auto length = frame_data->GetLength();
+
+		for (size_t offset = 0; (offset + MPEGTS_MIN_PACKET_SIZE) <= length; offset += MPEGTS_MIN_PACKET_SIZE)
+		{
+			auto packet = data + offset;
+
+			if (packet[0] != MPEGTS_SYNC_BYTE)
+			{
+				OV_ASSERT(false, "Invalid sync byte: 0x%02X", packet[0]);
+				break;
+			}
+
+			uint16_t pid = ((packet[1] & 0x1F) << 8) | packet[2];
+			bool payload_unit_start = OV_GET_BIT(packet[1], 6);
+			bool has_adaptation_field = OV_GET_BIT(packet[3] >> 4, 1);
+			bool has_payload = OV_GET_BIT(packet[3] >> 4, 0);
+			uint8_t continuity_counter = packet[3] & 0x0F;
+
+			auto item = _continuity_states.find(pid);
+
+			if (item == _continuity_states.end())
+			{
+				// The first packet of the PID follows the shared packetizer
+				_continuity_states.emplace(pid, ContinuityState{continuity_counter, false});
+				continue;
+			}
+
+			auto &state = item->second;
+
+			// The counter is not incremented if the packet has no payload
+			uint8_t expected_continuity_counter = has_payload ? ((state.continuity_counter + 1) & 0x0F) : state.continuity_counter;
+
+			if (continuity_counter == expected_continuity_counter)
+			{
+				state.continuity_counter = continuity_counter;
+				state.rewriting = false;
+				continue;
+			}
+
+			if (random_access && payload_unit_start)
+			{
+				// Follow the shared packetizer from this random access point, so the in-order frames are not copied anymore
+				state.continuity_counter = continuity_counter;
+				state.rewriting = false;
+
+				// discontinuity_indicator - not set in the packet with PCR, where it means a discontinuity of the time base
+				if (has_adaptation_field && (packet[4] > 0) && (OV_GET_BIT(packet[5], 4) == false))
+				{
+					get_writable_data()[offset + 5] = packet[5] | 0x80;
+				}
+
+				continue;
+			}
+
+			state.continuity_counter = expected_continuity_counter;
+			state.rewriting = true;
+
+			get_writable_data()[offset + 3] = (packet[3] & 0xF0) | expected_continuity_counter;
+		}
+
+		return (rewritten_data != nullptr) ? rewritten_data : frame_data;
+	}
+
+	PacketizerService *PacketizerService::GetInstance()
+	{
+		static PacketizerService *instance = new PacketizerService();
+		return instance;
+	}
+
+	ov::String PacketizerService::MakeKey(const info::Stream &stream_info, std::vector<std::shared_ptr<const MediaTrack>> &sorted_tracks)
+	{
+		// The PIDs are assigned in the order of the track ID, so the same set of tracks makes the same TS
+		std::sort(sorted_tracks.begin(), sorted_tracks.end(), [](const auto &a, const auto &b) {
+			return a->GetId() < b->GetId();
+		});
+
+		sorted_tracks.erase(
+			std::unique(sorted_tracks.begin(), sorted_tracks.end(), [](const auto &a, const auto &b) {
+				return a->GetId() == b->GetId();
+			}),
+			sorted_tracks.end());
+
+		auto key = ov::String::FormatString("%s/%u", stream_info.GetUUID().CStr(), stream_info.GetId());
+
+		for (const auto &track : sorted_tracks)
+		{
+			key.AppendFormat(":%u", track->GetId());
+		}
+
+		return key;
+	}
+
+	std::shared_ptr<PacketizerSubscription> PacketizerService::Subscribe(
+		const info::Stream &stream_info,
+		const std::vector<std::shared_ptr<const MediaTrack>> &tracks,
+		const std::shared_ptr<PacketizerSink> &sink)
+	{
+		auto sorted_tracks = tracks;
+		auto key = MakeKey(stream_info, sorted_tracks);
+
+		std::shared_ptr<SharedPacketizer> packetizer;
+
+		{
+			std::lock_guard lock_guard(_mutex);
+
+			// Remove the packetizers that are no longer subscribed
+			for (auto item = _packetizers.begin(); item != _packetizers.end();)
+			{
+				if (item->second.expired())
+				{
+					item = _packetizers.erase(item);
+				}
+				else
+				{
+					++item;
+				}
+			}
+
+			auto item = _packetizers.find(key);
+
+			if (item != _packetizers.end())
+			{
+				packetizer = item->second.lock();
+			}
+
+			if (packetizer == nullptr)
+			{
+				packetizer = std::make_shared<SharedPacketizer>(key);
+
+				if (packetizer->Start(sorted_tracks) == false)
+				{
+					logte("Could not start the packetizer: %s", key.CStr());
+					return nullptr;
+				}
+
+				_packetizers[key] = packetizer;
+
+				logtd("A new packetizer is created: %s", key.CStr());
+			}
+			else
+			{
+				logtd("The packetizer is shared: %s", key.CStr());
+			}
+		}
+
+		auto subscription = std::make_shared<PacketizerSubscription>(packetizer, sink);
+
+		sink->OnPsi(packetizer->GetTracks(), packetizer->GetPsiData());
+
+		return subscription;
+	}
+}  // namespace mpegts
@@ -0,0 +1,160 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/stream.h>
+
+#include <deque>
+
+#include "mpegts_packetizer.h"
+
+namespace mpegts
+{
+	// A packetizer shared by the publishers that send the same tracks of a stream (HLS, SRT, ...)
+	//
+	// Each publisher receives the same MediaPacket instance from the MediaRouter,
+	// so the frame is packetized by the first publisher that appends it, and the TS data
+	// is reused by the other publishers.
+	//
+	// A subscriber running behind the cache gets a frame packetized again, so the continuity counters
+	// of the TS data may not follow the ones it has sent (see PacketizerSubscription).
+	class SharedPacketizer
+	{
+	public:
+		// The number of recent frames to keep for the subscribers running behind
+		static constexpr size_t MaxCachedFrameCount = 64;
+
+		SharedPacketizer(const ov::String &key);
+
+		bool Start(const std::vector<std::shared_ptr<const MediaTrack>> &tracks);
+
+		const ov::String &GetKey() const
+		{
+			return _key;
+		}
+
+		const std::vector<std::shared_ptr<const MediaTrack>> &GetTracks() const
+		{
+			return _tracks;
+		}
+
+		bool HasVideo() const
+		{
+			return _has_video;
+		}
+
+		std::shared_ptr<const ov::Data> GetPsiData() const;
+
+		// Returns the TS packets of the frame (nullptr if the frame is dropped by the packetizer)
+		std::shared_ptr<const ov::Data> Packetize(const std::shared_ptr<const MediaPacket> &media_packet);
+
+	protected:
+		// Receives the output of the _packetizer
+		class Collector : public PacketizerSink
+		{
+		public:
+			void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data) override
+			{
+				this->psi_data = psi_data;
+			}
+
+			void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data) override
+			{
+				this->frame_data = frame_data;
+			}
+
+			std::shared_ptr<const ov::Data> psi_data;
+			std::shared_ptr<const ov::Data> frame_data;
+		};
+
+		struct CachedFrame
+		{
+			// To check that the address is not reused by another MediaPacket
+			std::weak_ptr<const MediaPacket> media_packet;
+			std::shared_ptr<const ov::Data> frame_data;
+		};
+
+		ov::String _key;
+		std::vector<std::shared_ptr<const MediaTrack>> _tracks;
+		bool _has_video = false;
+
+		mutable std::mutex _mutex;
+		std::shared_ptr<Packetizer> _packetizer;
+		std::shared_ptr<Collector> _collector;
+
+		std::unordered_map<const MediaPacket *, CachedFrame> _frame_cache;
+		// The oldest frame is at the front
+		std::deque<const MediaPacket *> _frame_order;
+	};
+
+	// A subscriber of the SharedPacketizer
+	//
+	// PacketizerSink::OnFrame() is called in the thread that calls AppendFrame()
+	//
+	// The continuity counters are tracked for each subscription, and the TS data is copied and rewritten
+	// only when the counters of the shared data do not follow the ones sent to this subscriber.
+	// The rewriting stops at the next random access point of the PID (key frame, or any audio/data frame),
+	// where the subscription takes the counters of the shared data again and signals the discontinuity.
+	class PacketizerSubscription
+	{
+	public:
+		PacketizerSubscription(const std::shared_ptr<SharedPacketizer> &packetizer, const std::shared_ptr<PacketizerSink> &sink);
+
+		bool AppendFrame(const std::shared_ptr<const MediaPacket> &media_packet);
+
+		std::shared_ptr<const ov::Data> GetPsiData() const
+		{
+			return _packetizer->GetPsiData();
+		}
+
+	protected:
+		struct ContinuityState
+		{
+			// The last continuity counter sent to the sink
+			uint8_t continuity_counter = 0;
+			// Set while the counters of the shared data do not follow the ones sent to the sink
+			bool rewriting = false;
+		};
+
+		// random_access: true if the frame can be decoded without the previous frames, so the counters can be resynchronized
+		std::shared_ptr<const ov::Data> RewriteContinuityCounters(const std::shared_ptr<const ov::Data> &frame_data, bool random_access);
+
+		std::shared_ptr<SharedPacketizer> _packetizer;
+		// Not to make a circular reference (The sink usually has this subscription)
+		std::weak_ptr<PacketizerSink> _sink;
+
+		bool _first_video_frame_received = false;
+
+		// PID : ContinuityState
+		std::unordered_map<uint16_t, ContinuityState> _continuity_states;
+	};
+
+	class PacketizerService
+	{
+	public:
+		static PacketizerService *GetInstance();
+
+		// Subscribe the packetizer for the tracks of the stream (the packetizer is created if needed)
+		//
+		// PacketizerSink::OnPsi() is called before returning
+		std::shared_ptr<PacketizerSubscription> Subscribe(
+			const info::Stream &stream_info,
+			const std::vector<std::shared_ptr<const MediaTrack>> &tracks,
+			const std::shared_ptr<PacketizerSink> &sink);
+
+	protected:
+		PacketizerService() = default;
+
+		static ov::String MakeKey(const info::Stream &stream_info, std::vector<std::shared_ptr<const MediaTrack>> &sorted_tracks);
+
+		std::mutex _mutex;
+		// key : packetizer (released when the last subscription is released)
+		std::unordered_map<ov::String, std::weak_ptr<SharedPacketizer>> _packetizers;
+	};
+}  // namespace mpegts
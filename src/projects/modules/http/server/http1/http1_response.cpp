@@ -55,6 +55,11 @@ namespace http
 				return _chunked_transfer;
 			}
 
+			bool Http1Response::IsSendfileAvailable() const
+			{
+				return (_chunked_transfer == false);
+			}
+
 			int32_t Http1Response::SendHeader()
 			{
 				std::shared_ptr<ov::Data> response = std::make_shared<ov::Data>(65535);
@@ -109,9 +114,10 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
-				for (const auto &data : GetResponseDataList())
+
+				if (_chunked_transfer)
 				{
-					if (_chunked_transfer)
+					for (const auto &data : GetResponseDataList())
 					{
 						sent &= SendChunkedData(data);
 						if (sent == true)
@@ -124,18 +130,31 @@ namespace http
 							return -1;
 						}
 					}
-					else
+				}
+				else
+				{
+					// Send all data at once using scatter-gather I/O without merging them (e.g. the chunks of a LL-HLS segment)
+					sent = Send(GetResponseDataList());
+
+					// The files (e.g. DVR segments) are sent from the page cache without copying them to the user space
+					for (const auto &file_range : GetResponseFileList())
 					{
-						sent &= Send(data);
-						if (sent == true)
+						if (sent == false)
 						{
-							sent_bytes += data->GetLength();
-						}
-						else
-						{
-							logte("Could not send data : %d bytes", data->GetLength());
-							return -1;
+							break;
 						}
+
+						sent = SendFile(file_range);
+					}
+
+					if (sent == true)
+					{
+						sent_bytes = GetResponseDataSize();
+					}
+					else
+					{
+						logte("Could not send data : %zu bytes", GetResponseDataSize());
+						return -1;
 					}
 				}
 
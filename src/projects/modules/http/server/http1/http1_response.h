@@ -29,6 +29,10 @@ namespace http
 				bool SendChunkedData(const std::shared_ptr<const ov::Data> &data);
 				bool IsChunkedTransfer() const;
 
+			protected:
+				// The files can be sent using sendfile() unless the chunked transfer is used
+				bool IsSendfileAvailable() const override;
+
 			private:
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
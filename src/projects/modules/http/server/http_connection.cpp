@@ -63,7 +63,7 @@ namespace http
 				this,
 				StringFromConnectionType(_connection_type).CStr(),
 				_client_socket->ToString().CStr(),
-				_tls_data ? "Enabled" : "Disabled");
+				(_tls_data == nullptr) ? "Disabled" : (_tls_data->IsKernelTlsEnabled() ? "Enabled, kTLS" : "Enabled"));
 		}
 		
 		// Called every 5 seconds
@@ -144,8 +144,9 @@ namespace http
 
 		void HttpConnection::OnTlsAccepted()
 		{
-			logti("TLS connection accepted : Server Name(%s) Alpn Protocol(%s) Client (%s)", 
-					_tls_data->GetServerName().CStr(), _tls_data->GetSelectedAlpnProtocolStr().CStr(), _client_socket->ToString().CStr());
+			logti("TLS connection accepted : Server Name(%s) Alpn Protocol(%s) kTLS(%s) Client (%s)", 
+					_tls_data->GetServerName().CStr(), _tls_data->GetSelectedAlpnProtocolStr().CStr(),
+					_tls_data->IsKernelTlsEnabled() ? "Offloaded" : "Disabled", _client_socket->ToString().CStr());
 
 			if (_tls_data->GetSelectedAlpnProtocol() == ov::TlsServerData::AlpnProtocol::Http20)
 			{
@@ -0,0 +1,152 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_interceptor_routing_table.h"
+
+#include <ctype.h>
+
+#include "./http_server_private.h"
+#include "http_request.h"
+
+#define INVALID_NODE_INDEX UINT32_MAX
+
+namespace http
+{
+	namespace svr
+	{
+		void InterceptorRoutingTable::Build(const std::vector<std::shared_ptr<RequestInterceptor>> &interceptor_list)
+		{
+			_nodes.clear();
+			_nodes.emplace_back();
+			_dynamic_mask = 0;
+
+			_available = (interceptor_list.size() <= HTTP_INTERCEPTOR_ROUTING_TABLE_MAX_COUNT);
+
+			if (_available == false)
+			{
+				logtw("Too many interceptors are registered (%zu) - all interceptors will be checked for each request", interceptor_list.size());
+				return;
+			}
+
+			for (size_t index = 0; index < interceptor_list.size(); index++)
+			{
+				uint64_t mask = 1ULL << index;
+				auto routes = interceptor_list[index]->GetRoutes();
+
+				if (routes.empty())
+				{
+					_dynamic_mask |= mask;
+					continue;
+				}
+
+				for (const auto &route : routes)
+				{
+					AddRoute(route, mask);
+				}
+			}
+		}
+
+		uint32_t InterceptorRoutingTable::FindChild(uint32_t node_index, char c) const
+		{
+			for (const auto &[child_char, child_index] : _nodes[node_index].children)
+			{
+				if (child_char == c)
+				{
+					return child_index;
+				}
+			}
+
+			return INVALID_NODE_INDEX;
+		}
+
+		void InterceptorRoutingTable::AddRoute(const InterceptorRoute &route, uint64_t mask)
+		{
+			uint32_t node_index = 0;
+			auto suffix = route.file_suffix.LowerCaseString();
+
+			// Insert the suffix in reverse order
+			for (auto index = static_cast<ssize_t>(suffix.GetLength()) - 1; index >= 0; index--)
+			{
+				char c = suffix[index];
+				auto child_index = FindChild(node_index, c);
+
+				if (child_index == INVALID_NODE_INDEX)
+				{
+					child_index = static_cast<uint32_t>(_nodes.size());
+					_nodes.emplace_back();
+					_nodes[node_index].children.emplace_back(c, child_index);
+				}
+
+				node_index = child_index;
+			}
+
+			auto &terminals = _nodes[node_index].terminals;
+
+			for (auto &terminal : terminals)
+			{
+				if ((terminal.method == route.method) && (terminal.websocket_only == route.websocket_only))
+				{
+					terminal.mask |= mask;
+					return;
+				}
+			}
+
+			terminals.push_back({route.method, route.websocket_only, mask});
+		}
+
+		bool InterceptorRoutingTable::FindCandidates(const std::shared_ptr<const HttpRequest> &request, uint64_t &candidates) const
+		{
+			if (_available == false)
+			{
+				return false;
+			}
+
+			auto method = request->GetMethod();
+			bool is_websocket = (request->GetConnectionType() == ConnectionType::WebSocket);
+
+			candidates = _dynamic_mask;
+
+			auto collect = [&](uint32_t node_index) {
+				for (const auto &terminal : _nodes[node_index].terminals)
+				{
+					if (HTTP_CHECK_METHOD(terminal.method, method) && ((terminal.websocket_only == false) || is_websocket))
+					{
+						candidates |= terminal.mask;
+					}
+				}
+			};
+
+			uint32_t node_index = 0;
+			collect(node_index);
+
+			const auto &parsed_uri = request->GetParsedUri();
+
+			if (parsed_uri == nullptr)
+			{
+				return true;
+			}
+
+			const auto &file = parsed_uri->File();
+			auto file_name = file.CStr();
+
+			for (auto index = static_cast<ssize_t>(file.GetLength()) - 1; index >= 0; index--)
+			{
+				node_index = FindChild(node_index, static_cast<char>(::tolower(static_cast<unsigned char>(file_name[index]))));
+
+				if (node_index == INVALID_NODE_INDEX)
+				{
+					break;
+				}
+
+				collect(node_index);
+			}
+
+			return true;
+		}
+	}  // namespace svr
+}  // namespace http
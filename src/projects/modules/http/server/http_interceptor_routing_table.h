@@ -0,0 +1,66 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "http_request_interceptor.h"
+
+// Maximum number of interceptors that can be indexed (one bit per interceptor)
+#define HTTP_INTERCEPTOR_ROUTING_TABLE_MAX_COUNT 64
+
+namespace http
+{
+	namespace svr
+	{
+		// Finds the interceptors that can handle a request using their routes (RequestInterceptor::GetRoutes()),
+		// so HttpServer does not need to call IsInterceptorForRequest() of all interceptors.
+		//
+		// The file suffixes are stored in a trie of reversed strings, so lookup takes O(length of file name).
+		class InterceptorRoutingTable
+		{
+		public:
+			// Must be called whenever the interceptor list is changed
+			void Build(const std::vector<std::shared_ptr<RequestInterceptor>> &interceptor_list);
+
+			// Bit N of candidates is set if interceptor_list[N] (passed to Build()) may handle the request.
+			//
+			// Returns false if the table is not available (too many interceptors),
+			// in which case all interceptors should be checked.
+			bool FindCandidates(const std::shared_ptr<const HttpRequest> &request, uint64_t &candidates) const;
+
+		protected:
+			struct Terminal
+			{
+				Method method;
+				bool websocket_only;
+				uint64_t mask;
+			};
+
+			struct Node
+			{
+				// (character, node index)
+				std::vector<std::pair<char, uint32_t>> children;
+				// Routes that end at this node
+				std::vector<Terminal> terminals;
+			};
+
+			uint32_t FindChild(uint32_t node_index, char c) const;
+			void AddRoute(const InterceptorRoute &route, uint64_t mask);
+
+			bool _available = false;
+
+			// Interceptors that don't have routes
+			uint64_t _dynamic_mask = 0;
+
+			// The first node is the root (routes with empty suffix)
+			std::vector<Node> _nodes;
+		};
+	}  // namespace svr
+}  // namespace http
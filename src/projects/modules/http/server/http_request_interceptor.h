@@ -22,6 +22,17 @@ namespace http
 		class HttpRequest;
 		class HttpConnection;
 		class HttpExchange;
+
+		// Describes the requests that an interceptor can handle
+		struct InterceptorRoute
+		{
+			Method method = Method::All;
+			// Suffix of the file in the path (ov::Url::File(), case-insensitive) - empty matches all files
+			ov::String file_suffix;
+			// If true, only WebSocket requests match this route
+			bool websocket_only = false;
+		};
+
 		class RequestInterceptor
 		{
 		public:
@@ -31,6 +42,15 @@ namespace http
 			// If this method returns true, it will only pass to this interceptor when data is received in the future, but not to another interceptor.
 			virtual bool IsInterceptorForRequest(const std::shared_ptr<const HttpExchange> &client) = 0;
 
+			// Returns the routes used by HttpServer to skip IsInterceptorForRequest() for the requests that cannot match.
+			// The routes must cover all requests for which IsInterceptorForRequest() returns true.
+			//
+			// If empty (default), IsInterceptorForRequest() is called for every request.
+			virtual std::vector<InterceptorRoute> GetRoutes() const
+			{
+				return {};
+			}
+
 			/// A callback called to initialize request/response immediately after IsInterceptorForRequest()
 			///
 			/// @param client An instance that contains informations related to HTTP request/response
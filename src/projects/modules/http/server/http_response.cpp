@@ -43,6 +43,7 @@ namespace http
 			_is_header_sent = http_response->_is_header_sent;
 			_response_header = http_response->_response_header;
 			_response_data_list = http_response->_response_data_list;
+			_response_file_list = http_response->_response_file_list;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -189,22 +190,35 @@ namespace http
 
 			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
 
+			if ((_response_file_list.empty() == false) && (LoadResponseFileList() == false))
+			{
+				// The data must be sent after the files
+				return false;
+			}
+
 			auto cloned_data = data->Clone();
 
 			_response_data_list.push_back(cloned_data);
 			_response_data_size += cloned_data->GetLength();
 
+			UpdateResponseHash(cloned_data);
+
+			return true;
+		}
+
+		void HttpResponse::UpdateResponseHash(const std::shared_ptr<const ov::Data> &data)
+		{
 			if (_etag_enabled_by_config == false)
 			{
-				return true;
+				return;
 			}
 
-			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, cloned_data);
+			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, data);
 			if (md5 == nullptr || md5->GetLength() != 16)
 			{
 				// Could not compute MD5
 				OV_ASSERT2(md5->GetLength() == 16);
-				return true;
+				return;
 			}
 
 			if (_response_hash == nullptr)
@@ -220,8 +234,6 @@ namespace http
 					ptr[i] ^= md5->At(i);
 				}
 			}
-
-			return true;
 		}
 
 		bool HttpResponse::AppendString(const ov::String &string)
@@ -231,8 +243,64 @@ namespace http
 
 		bool HttpResponse::AppendFile(const ov::String &filename)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			auto file_range = ov::FileHandleCache::GetInstance()->OpenRange(filename);
+
+			if (file_range.IsValid() == false)
+			{
+				logte("Could not open file: %s", filename.CStr());
+				return false;
+			}
+
+			return AppendFileRange(file_range);
+		}
+
+		bool HttpResponse::AppendFileRange(const ov::FileRange &file_range)
+		{
+			if (file_range.IsValid() == false)
+			{
+				return false;
+			}
+
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			_response_file_list.push_back(file_range);
+			_response_data_size += file_range.length;
+
+			if (_etag_enabled_by_config)
+			{
+				// Hash the identity of the file instead of reading it
+				auto &file = file_range.file;
+
+				UpdateResponseHash(ov::String::FormatString("%s:%ju:%jd:%jd:%zu",
+															file->GetPath().CStr(),
+															static_cast<uintmax_t>(file->GetInode()),
+															static_cast<intmax_t>(file->GetModifiedTime()),
+															static_cast<intmax_t>(file_range.offset),
+															file_range.length)
+									   .ToData(false));
+			}
+
+			return true;
+		}
+
+		bool HttpResponse::LoadResponseFileList()
+		{
+			for (const auto &file_range : _response_file_list)
+			{
+				auto data = file_range.Read();
+
+				if (data == nullptr)
+				{
+					logte("Could not read file: %s", file_range.ToString().CStr());
+					return false;
+				}
+
+				_response_data_list.push_back(data);
+			}
+
+			_response_file_list.clear();
+
+			return true;
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -252,6 +320,11 @@ namespace http
 			return _response_data_list;
 		}
 
+		const std::vector<ov::FileRange> &HttpResponse::GetResponseFileList() const
+		{
+			return _response_file_list;
+		}
+
 		// Get Response Header
 		const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &HttpResponse::GetResponseHeaderList() const
 		{
@@ -261,6 +334,7 @@ namespace http
 		void HttpResponse::ResetResponseData()
 		{
 			_response_data_list.clear();
+			_response_file_list.clear();
 			_response_data_size = 0ULL;
 		}
 
@@ -341,6 +415,11 @@ namespace http
 				return sent_size;
 			}
 
+			if ((_response_file_list.empty() == false) && (IsSendfileAvailable() == false) && (LoadResponseFileList() == false))
+			{
+				return -1;
+			}
+
 			auto sent_data_size = SendPayload();
 			if (sent_data_size < 0)
 			{
@@ -379,8 +458,9 @@ namespace http
 
 			std::shared_ptr<const ov::Data> send_data;
 
-			if (_tls_data == nullptr)
+			if ((_tls_data == nullptr) || _tls_data->IsKernelTlsEnabled())
 			{
+				// The kernel encrypts the data if kTLS is enabled
 				send_data = data->Clone();
 			}
 			else
@@ -401,6 +481,54 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list)
+		{
+			if ((_tls_data == nullptr) || _tls_data->IsKernelTlsEnabled())
+			{
+				return _client_socket->Send(data_list);
+			}
+
+			std::vector<std::shared_ptr<const ov::Data>> send_data_list;
+			send_data_list.reserve(data_list.size());
+
+			for (const auto &data : data_list)
+			{
+				std::shared_ptr<const ov::Data> send_data;
+
+				if (_tls_data->Encrypt(data, &send_data) == false)
+				{
+					logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+					return false;
+				}
+
+				if ((send_data != nullptr) && (send_data->IsEmpty() == false))
+				{
+					send_data_list.push_back(send_data);
+				}
+			}
+
+			return _client_socket->Send(send_data_list);
+		}
+
+		bool HttpResponse::SendFile(const ov::FileRange &file_range)
+		{
+			if ((_tls_data == nullptr) || _tls_data->IsKernelTlsEnabled())
+			{
+				// sendfile() also works with kTLS
+				return _client_socket->SendFile(file_range);
+			}
+
+			auto data = file_range.Read();
+
+			if (data == nullptr)
+			{
+				logte("Could not read file: %s", file_range.ToString().CStr());
+				return false;
+			}
+
+			return Send(data);
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -56,7 +56,10 @@ namespace http
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
 			bool AppendString(const ov::String &string);
+			// The file is sent using sendfile() if possible (plain HTTP/1.1 with content-length),
+			// otherwise it is read into the memory when the response is sent
 			bool AppendFile(const ov::String &filename);
+			bool AppendFileRange(const ov::FileRange &file_range);
 
 			int32_t Response();
 
@@ -78,6 +81,8 @@ namespace http
 			
 			// Get Response Data List
 			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
+			// Get Response File List (These files are sent after the data list)
+			const std::vector<ov::FileRange> &GetResponseFileList() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -90,12 +95,26 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
-			
+			// Send the data at once using scatter-gather I/O
+			bool Send(const std::vector<std::shared_ptr<const ov::Data>> &data_list);
+			// Send the file range using sendfile() (The range is read into the memory if TLS is used without kTLS)
+			bool SendFile(const ov::FileRange &file_range);
+
+			// Whether SendPayload() can send the items of GetResponseFileList() using SendFile()
+			virtual bool IsSendfileAvailable() const
+			{
+				return false;
+			}
+
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
 
 			ov::String GetEtag();
+			void UpdateResponseHash(const std::shared_ptr<const ov::Data> &data);
+
+			// Read the files of _response_file_list, and move them to _response_data_list
+			bool LoadResponseFileList();
 
 			std::shared_ptr<ov::ClientSocket> _client_socket;
 			std::shared_ptr<ov::TlsServerData> _tls_data;
@@ -122,6 +141,8 @@ namespace http
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
 			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::vector<ov::FileRange> _response_file_list;
+			// Includes the length of _response_file_list
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
@@ -242,6 +242,8 @@ namespace http
 			}
 
 			_interceptor_list.push_back(interceptor);
+			_interceptor_routing_table.Build(_interceptor_list);
+
 			return true;
 		}
 
@@ -250,6 +252,27 @@ namespace http
 			// Find interceptor for the request
 			std::shared_lock<std::shared_mutex> guard(_interceptor_list_mutex);
 
+			uint64_t candidates = 0;
+
+			if (_interceptor_routing_table.FindCandidates(exchange->GetRequest(), candidates))
+			{
+				// Check only the interceptors whose routes match the request (in the order of registration)
+				while (candidates != 0)
+				{
+					auto index = __builtin_ctzll(candidates);
+					candidates &= (candidates - 1);
+
+					auto &interceptor = _interceptor_list[index];
+
+					if (interceptor->IsInterceptorForRequest(exchange))
+					{
+						return interceptor;
+					}
+				}
+
+				return nullptr;
+			}
+
 			for (auto &interceptor : _interceptor_list)
 			{
 				if (interceptor->IsInterceptorForRequest(exchange))
@@ -280,6 +303,8 @@ namespace http
 			}
 
 			_interceptor_list.erase(item);
+			_interceptor_routing_table.Build(_interceptor_list);
+
 			return true;
 		}
 
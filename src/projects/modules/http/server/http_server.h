@@ -15,6 +15,7 @@
 #include "../http_error.h"
 #include "http_connection.h"
 #include "http_default_interceptor.h"
+#include "http_interceptor_routing_table.h"
 
 #define HTTP_SERVER_USE_DEFAULT_COUNT PHYSICAL_PORT_USE_DEFAULT_COUNT
 
@@ -88,6 +89,8 @@ namespace http
 
 			std::shared_mutex _interceptor_list_mutex;
 			std::vector<std::shared_ptr<RequestInterceptor>> _interceptor_list;
+			// Rebuilt whenever _interceptor_list is changed
+			InterceptorRoutingTable _interceptor_routing_table;
 			std::vector<std::shared_ptr<ocst::VirtualHost>> _virtual_host_list;
 
 		private:
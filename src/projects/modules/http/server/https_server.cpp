@@ -21,6 +21,10 @@
 // Fastest suite only, which is still considered `secure`.
 #define HTTP_FAST_NOT_VERY_SECURE "AES128-SHA"
 
+// All HttpsServer instances share the same session id context, because the session is looked up
+// with the context of the first certificate (before SNI switches the context)
+#define HTTPS_SESSION_ID_CONTEXT "OvenMediaEngine/HttpsServer"
+
 namespace http
 {
 	namespace svr
@@ -51,6 +55,17 @@ namespace http
 				return error;
 			}
 
+			if (IsKernelTlsEnabled())
+			{
+				tls_context->SetKernelTlsEnabled(true);
+			}
+
+			if (tls_context->EnableSessionCache(HTTPS_SESSION_ID_CONTEXT) == false)
+			{
+				// Not fatal: the client will perform a full handshake every time
+				logtw("Could not enable the TLS session cache for host: %s", certificate->ToString().CStr());
+			}
+
 			std::lock_guard lock_guard(_https_certificate_map_mutex);
 
 			logtd("Append the certificate for host: %s", certificate->ToString().CStr());
@@ -122,6 +137,17 @@ namespace http
 				return remote->Send(data, length) ? length : -1L;
 			});
 
+			if (IsKernelTlsEnabled())
+			{
+				tls_data->SetKernelTlsCallbacks(
+					[remote](const void *crypto_info) -> bool {
+						return remote->EnableKernelTlsTx(crypto_info);
+					},
+					[remote](uint8_t record_type, const void *data, size_t length) -> ssize_t {
+						return remote->SendKernelTlsRecord(record_type, data, length);
+					});
+			}
+
 			client->SetTlsData(tls_data);
 		}
 
@@ -175,6 +201,13 @@ namespace http
 			}
 		}
 
+		bool HttpsServer::IsKernelTlsEnabled() const
+		{
+			auto module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
+
+			return module_config.GetKTLS().IsEnabled();
+		}
+
 		bool HttpsServer::HandleSniCallback(ov::TlsContext *tls_context, SSL *ssl, const ov::String &server_name)
 		{
 			std::shared_ptr<HttpsCertificate> https_certificate;
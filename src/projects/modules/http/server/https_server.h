@@ -52,6 +52,9 @@ namespace http
 			void OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data) override;
 
 		protected:
+			// <Modules><KTLS><Enable>true</Enable></KTLS></Modules>
+			bool IsKernelTlsEnabled() const;
+
 			bool HandleSniCallback(ov::TlsContext *tls_context, SSL *ssl, const ov::String &server_name);
 
 		protected:
@@ -46,6 +46,12 @@ namespace http
 				return true;
 			}
 
+			std::vector<InterceptorRoute> Interceptor::GetRoutes() const
+			{
+				// WebSocket can be opened with GET (HTTP/1.1) or CONNECT (HTTP/2)
+				return {{Method::All, "", true}};
+			}
+
 			bool Interceptor::OnRequestPrepared(const std::shared_ptr<HttpExchange> &exchange)
 			{
 				auto websocket_session = std::dynamic_pointer_cast<WebSocketSession>(exchange);
@@ -38,6 +38,7 @@ namespace http
 				// Implementation of HttpRequestInterceptorInterface
 				//--------------------------------------------------------------------
 				bool IsInterceptorForRequest(const std::shared_ptr<const HttpExchange> &client) override;
+				std::vector<InterceptorRoute> GetRoutes() const override;
 
 				// If these handler return false, the connection will be disconnected
 				bool OnRequestPrepared(const std::shared_ptr<HttpExchange> &exchange) override;
@@ -239,13 +239,11 @@ bool IcePort::Close()
 
 ov::String IcePort::GenerateUfrag()
 {
-	std::shared_lock<std::shared_mutex> lock(_ice_sessions_with_ufrag_lock);
-
 	while (true)
 	{
 		ov::String ufrag = ov::Random::GenerateString(6);
 
-		if (_ice_sessions_with_ufrag.find(ufrag) == _ice_sessions_with_ufrag.end())
+		if (_ice_sessions_with_ufrag.Contains(ufrag) == false)
 		{
 			logtd("Generated ufrag: %s", ufrag.CStr());
 
@@ -256,77 +254,32 @@ ov::String IcePort::GenerateUfrag()
 
 bool IcePort::AddIceSession(session_id_t session_id, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item == _ice_seesions_with_id.end())
-	{
-		_ice_seesions_with_id.emplace(session_id, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_id.Insert(session_id, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::String &local_ufrag, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item == _ice_sessions_with_ufrag.end())
-	{
-		_ice_sessions_with_ufrag.emplace(local_ufrag, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_ufrag.Insert(local_ufrag, ice_session);
 }
 
 bool IcePort::AddIceSession(const ov::SocketAddressPair &address_pair, const std::shared_ptr<IceSession> &ice_session)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(address_pair);
-	if (item == _ice_sessions_with_address_pair.end())
-	{
-		_ice_sessions_with_address_pair.emplace(address_pair, ice_session);
-		return true;
-	}
-
-	return false;
+	return _ice_sessions_with_address_pair.Insert(address_pair.Pack(), ice_session);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(session_id_t session_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_seesions_with_id.find(session_id);
-	if (item != _ice_seesions_with_id.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_id.Find(session_id).value_or(nullptr);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::String &local_ufrag)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-	auto item = _ice_sessions_with_ufrag.find(local_ufrag);
-	if (item != _ice_sessions_with_ufrag.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_ufrag.Find(local_ufrag).value_or(nullptr);
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSession(const ov::SocketAddressPair &socket_address_pair)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-	auto item = _ice_sessions_with_address_pair.find(socket_address_pair);
-	if (item != _ice_sessions_with_address_pair.end())
-	{
-		return item->second;
-	}
-
-	return nullptr;
+	return _ice_sessions_with_address_pair.Find(socket_address_pair.Pack()).value_or(nullptr);
 }
 
 session_id_t IcePort::IssueUniqueSessionId()
@@ -397,29 +350,20 @@ bool IcePort::RemoveSession(session_id_t session_id)
 	size_t ice_sessions_with_address_pair_size = 0;
 
 	// Remove from _ice_sessions_with_id
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-		_ice_seesions_with_id.erase(session_id);
-		ice_sessions_with_id_size = _ice_seesions_with_id.size();
-	}
+	_ice_sessions_with_id.Erase(session_id);
+	ice_sessions_with_id_size = _ice_sessions_with_id.Size();
 
 	// Remove from _ice_sessions_with_ufrag
-	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_ufrag_lock);
-		_ice_sessions_with_ufrag.erase(ice_session->GetLocalUfrag());
-		ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.size();
-	}
+	_ice_sessions_with_ufrag.Erase(ice_session->GetLocalUfrag());
+	ice_sessions_with_ufrag_size = _ice_sessions_with_ufrag.Size();
 
 	// Remove from _ice_sessions_with_address_pair if it exists
+	auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
+	if (connected_candidate_pair != nullptr)
 	{
-		std::lock_guard<std::shared_mutex> lock_guard(_ice_sessions_with_address_pair_lock);
-		auto connected_candidate_pair = ice_session->GetConnectedCandidatePair();
-		if (connected_candidate_pair != nullptr)
-		{
-			_ice_sessions_with_address_pair.erase(connected_candidate_pair->GetAddressPair());
-		}
-		ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.size();
+		_ice_sessions_with_address_pair.Erase(connected_candidate_pair->GetAddressPair().Pack());
 	}
+	ice_sessions_with_address_pair_size = _ice_sessions_with_address_pair.Size();
 
 	{
 		// Close only TCP (TURN)
@@ -440,78 +384,46 @@ bool IcePort::RemoveSession(session_id_t session_id)
 
 bool IcePort::StoreIceSessionWithTransactionId(const std::shared_ptr<IceSession> &ice_session, const ov::String &transaction_id)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_binding_requests_with_transaction_id_lock);
-	auto item = _binding_requests_with_transaction_id.find(transaction_id);
-	if (item != _binding_requests_with_transaction_id.end())
+	if (_binding_requests_with_transaction_id.Insert(transaction_id, std::make_shared<BindingRequestInfo>(transaction_id, ice_session)) == false)
 	{
 		logte("Duplicated transaction_id: %s", transaction_id.CStr());
 		return false;
 	}
 
-	_binding_requests_with_transaction_id.emplace(transaction_id, BindingRequestInfo(transaction_id, ice_session));
-
 	return true;
 }
 
 std::shared_ptr<IceSession> IcePort::FindIceSessionWithTransactionId(const ov::String &transaction_id)
 {
-	std::shared_lock<std::shared_mutex> lock_guard(_binding_requests_with_transaction_id_lock);
-	auto item = _binding_requests_with_transaction_id.find(transaction_id);
-	if (item == _binding_requests_with_transaction_id.end())
+	auto binding_request = _binding_requests_with_transaction_id.Find(transaction_id).value_or(nullptr);
+	if (binding_request == nullptr)
 	{
 		return nullptr;
 	}
 
-	return item->second._ice_session;
+	return binding_request->_ice_session;
 }
 
 bool IcePort::RemoveTransaction(const ov::String &transaction_id)
 {
-	std::lock_guard<std::shared_mutex> lock_guard(_binding_requests_with_transaction_id_lock);
-	auto item = _binding_requests_with_transaction_id.find(transaction_id);
-	if (item == _binding_requests_with_transaction_id.end())
-	{
-		return false;
-	}
-
-	_binding_requests_with_transaction_id.erase(item);
-
-	return true;
+	return _binding_requests_with_transaction_id.Erase(transaction_id);
 }
 
 void IcePort::CheckTimedOut()
 {
 	// Remove expired transction items
-	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
-
-		for (auto it = _binding_requests_with_transaction_id.begin(); it != _binding_requests_with_transaction_id.end();)
-		{
-			if (it->second.IsExpired())
-			{
-				it = _binding_requests_with_transaction_id.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-	}
+	_binding_requests_with_transaction_id.EraseIf([](const ov::String &transaction_id, const std::shared_ptr<BindingRequestInfo> &binding_request) -> bool {
+		return binding_request->IsExpired();
+	});
 
 	// Collect terminated sessions for thread safety
 	std::vector<std::shared_ptr<IceSession>> terminated_session_list;
-	{
-		std::shared_lock<std::shared_mutex> lock_guard(_ice_sessions_with_id_lock);
-
-		for (const auto &item : _ice_seesions_with_id)
+	_ice_sessions_with_id.ForEach([&](const session_id_t &session_id, const std::shared_ptr<IceSession> &session) {
+		if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
 		{
-			auto session = item.second;
-			if (session->IsExpired() || session->GetState() == IceConnectionState::Disconnecting)
-			{
-				terminated_session_list.push_back(session);
-			}
+			terminated_session_list.push_back(session);
 		}
-	}
+	});
 
 	// Remove terminated sessions and notify
 	for (auto &terminated_session : terminated_session_list)
@@ -658,6 +570,44 @@ void IcePort::OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote, cons
 	OnPacketReceived(remote, address_pair, gate_info, data);
 }
 
+void IcePort::OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const std::vector<ov::Datagram> &datagrams, size_t count)
+{
+	// Most datagrams of a recvmmsg() batch are RTP/RTCP packets from the same few peers,
+	// so the session found for the previous datagram is reused while the address pair is the same.
+	std::shared_ptr<IceSession> ice_session;
+	const ov::SocketAddressPair *session_address_pair = nullptr;
+
+	for (size_t index = 0; index < count; index++)
+	{
+		auto &datagram = datagrams[index];
+
+		GateInfo gate_info;
+		gate_info.packet_type = IcePacketIdentifier::FindPacketType(datagram.data);
+
+		switch (gate_info.packet_type)
+		{
+			case IcePacketIdentifier::PacketType::RTP_RTCP:
+			case IcePacketIdentifier::PacketType::DTLS:
+				if ((session_address_pair == nullptr) || (*session_address_pair != datagram.address_pair))
+				{
+					ice_session = FindIceSession(datagram.address_pair);
+					session_address_pair = &(datagram.address_pair);
+				}
+
+				DeliverApplicationPacket(ice_session, datagram.address_pair, gate_info, datagram.data);
+				break;
+
+			default:
+				// STUN/TURN messages can add or change the session of an address pair, so look it up again after them
+				ice_session = nullptr;
+				session_address_pair = nullptr;
+
+				OnPacketReceived(remote, datagram.address_pair, gate_info, datagram.data);
+				break;
+		}
+	}
+}
+
 void IcePort::OnPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
 {
 	logtd("OnPacketReceived %s (%s)", gate_info.ToString().CStr(), address_pair.ToString().CStr());
@@ -684,7 +634,12 @@ void IcePort::OnApplicationPacketReceived(const std::shared_ptr<ov::Socket> &rem
 										  GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
 {
 	// TODO(Getroot) : After adding the local address parameter to this function, I need to modify the line below
-	auto ice_session = FindIceSession(address_pair);
+	DeliverApplicationPacket(FindIceSession(address_pair), address_pair, gate_info, data);
+}
+
+void IcePort::DeliverApplicationPacket(const std::shared_ptr<IceSession> &ice_session, const ov::SocketAddressPair &address_pair,
+									   GateInfo &gate_info, const std::shared_ptr<const ov::Data> &data)
+{
 	if (ice_session == nullptr)
 	{
 		logtw("Could not find agent(%s) information. Dropping... [%s]", address_pair.ToString().CStr(), gate_info.ToString().CStr());
@@ -1028,10 +983,8 @@ bool IcePort::SendStunBindingRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	// Store binding request transction
 	{
-		std::lock_guard<std::shared_mutex> brt_lock(_binding_requests_with_transaction_id_lock);
-
 		ov::String transaction_id_key((char *)(&transaction_id[0]), OV_STUN_TRANSACTION_ID_LENGTH);
-		_binding_requests_with_transaction_id.emplace(transaction_id_key, BindingRequestInfo(transaction_id_key, ice_session));
+		_binding_requests_with_transaction_id.Insert(transaction_id_key, std::make_shared<BindingRequestInfo>(transaction_id_key, ice_session));
 
 		logtd("Send Binding Request to(%s) id(%s)", address_pair.ToString().CStr(), transaction_id_key.CStr());
 	}
@@ -1058,7 +1011,7 @@ bool IcePort::OnReceivedStunBindingResponse(const std::shared_ptr<ov::Socket> &r
 	// Erase ended transction item
 	RemoveTransaction(transaction_id_key);
 
-	logtd("Receive stun binding response from %s, table size(%d)", address_pair.ToString().CStr(), _binding_requests_with_transaction_id.size());
+	logtd("Receive stun binding response from %s, table size(%zu)", address_pair.ToString().CStr(), _binding_requests_with_transaction_id.Size());
 
 	if (message.CheckIntegrity(ice_session->GetLocalSdp()->GetIcePwd()) == false)
 	{
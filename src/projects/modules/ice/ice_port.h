@@ -73,6 +73,7 @@ protected:
 	void OnConnected(const std::shared_ptr<ov::Socket> &remote) override;
 	void OnDataReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddress &address, const std::shared_ptr<const ov::Data> &data) override;
 	void OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, const std::shared_ptr<const ov::Data> &data) override;
+	void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const std::vector<ov::Datagram> &datagrams, size_t count) override;
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
@@ -167,6 +168,9 @@ private:
 									 GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
 	void OnApplicationPacketReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair,
 									 GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
+	// Deliver an application packet to the session that has already been found by the address pair
+	void DeliverApplicationPacket(const std::shared_ptr<IceSession> &ice_session, const ov::SocketAddressPair &address_pair,
+								  GateInfo &packet_info, const std::shared_ptr<const ov::Data> &data);
 
 	bool SendStunMessage(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, GateInfo &packet_info, StunMessage &message, const std::shared_ptr<const ov::Data> &integrity_key = nullptr);
 	bool SendStunBindingRequest(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, GateInfo &packet_info, const std::shared_ptr<IceSession> &info);
@@ -205,26 +209,25 @@ private:
 	std::vector<std::shared_ptr<PhysicalPort>> _physical_port_list;
 	std::recursive_mutex _physical_port_list_mutex;
 
+	// The tables below are looked up for every incoming packet, so they are lock-free for readers
+	// (see ov::ShardedHashMap)
+
 	// Mapping table containing related information until STUN binding.
 	// Once binding is complete, there is no need because it can be found by destination ip & port.
 	// key: offer ufrag
-	std::shared_mutex _ice_sessions_with_ufrag_lock;
-	std::map<const ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
+	ov::ShardedHashMap<ov::String, std::shared_ptr<IceSession>> _ice_sessions_with_ufrag;
 	
 	// Find IceSession with connected CandidatePair, used when receiving TURN channel data and application data
 	// key: SocketAddressPair
-	std::shared_mutex _ice_sessions_with_address_pair_lock;
-	std::map<ov::SocketAddressPair, std::shared_ptr<IceSession>> _ice_sessions_with_address_pair;
+	ov::ShardedHashMap<ov::SocketAddressPair::PackedKey, std::shared_ptr<IceSession>, ov::SocketAddressPair::PackedKeyHash> _ice_sessions_with_address_pair;
 	
 	// Find IceSession with peer's session id, used for sending application data 
-	std::shared_mutex _ice_sessions_with_id_lock;
-	std::map<session_id_t, std::shared_ptr<IceSession>> _ice_seesions_with_id;
+	ov::ShardedHashMap<session_id_t, std::shared_ptr<IceSession>> _ice_sessions_with_id;
 
 	// Insert item when send stun binding request
 	// Remove item when receive stun binding response or timed out
 	// Request Transaction ID : Session
-	std::shared_mutex _binding_requests_with_transaction_id_lock;
-	std::map<ov::String, BindingRequestInfo> _binding_requests_with_transaction_id;
+	ov::ShardedHashMap<ov::String, std::shared_ptr<BindingRequestInfo>> _binding_requests_with_transaction_id;
 	
 	// Demultiplexer for data input through TCP
 	// remote's ID : Demultiplexer
@@ -8,6 +8,7 @@
 //==============================================================================
 #include "application.h"
 #include "common.h"
+#include "metrics.h"
 namespace serdes
 {
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics)
@@ -95,4 +96,148 @@ namespace serdes
 
 		return value;
 	}
+
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats)
+	{
+		Json::Value value;
+
+		// 0 means the blocks larger than ov::MemoryPool::MaxBlockSize
+		SetInt64(value, "blockSize", stats.block_size);
+		SetInt64(value, "allocationCount", stats.allocation_count);
+		SetInt64(value, "reuseCount", stats.reuse_count);
+		SetInt64(value, "systemAllocationCount", stats.system_allocation_count);
+		SetInt64(value, "inUseCount", stats.in_use_count);
+		SetInt64(value, "cachedCount", stats.cached_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromTlsSessionStats(const ov::TlsSessionCache::Stats &stats)
+	{
+		Json::Value value;
+
+		Json::Value &cache = value["sessionCache"];
+		SetInt64(cache, "hitCount", stats.hit_count);
+		SetInt64(cache, "missCount", stats.miss_count);
+		SetInt64(cache, "storedCount", stats.stored_count);
+		SetInt64(cache, "evictedCount", stats.evicted_count);
+		SetInt64(cache, "cachedCount", stats.cached_session_count);
+
+		Json::Value &ticket = value["sessionTicket"];
+		SetInt64(ticket, "issuedCount", stats.ticket_issued_count);
+		SetInt64(ticket, "resumedCount", stats.ticket_resumed_count);
+		SetInt64(ticket, "renewedCount", stats.ticket_renewed_count);
+		SetInt64(ticket, "rejectedCount", stats.ticket_rejected_count);
+		SetInt64(ticket, "keyRotationCount", stats.ticket_key_rotation_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromKernelTlsStats(const ov::TlsServerData::KernelTlsStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "offloadedCount", stats.offloaded_count);
+		SetInt64(value, "fallbackCount", stats.fallback_count);
+
+		return value;
+	}
+
+	Json::Value JsonFromDatagramBatchStats(const ov::DatagramSocket::BatchStats &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "datagramCount", stats.datagram_count);
+		SetInt64(value, "syscallCount", stats.syscall_count);
+		SetFloat(value, "datagramsPerSyscall", (stats.syscall_count > 0) ? (static_cast<double>(stats.datagram_count) / stats.syscall_count) : 0.0);
+		SetInt64(value, "gsoMessageCount", stats.gso_message_count);
+		SetInt64(value, "gsoSegmentCount", stats.gso_segment_count);
+		SetBool(value, "gsoAvailable", stats.gso_available);
+
+		return value;
+	}
+
+	Json::Value JsonFromMediaRouteWorkerPoolStats(const MediaRouteWorkerPool::PoolStats &stats)
+	{
+		Json::Value value;
+
+		SetString(value, "name", stats.name, Optional::False);
+		SetString(value, "owner", stats.owner, Optional::False);
+
+		Json::Value &workers = value["workers"];
+		workers = Json::Value(Json::ValueType::arrayValue);
+
+		for (auto &worker_stats : stats.workers)
+		{
+			Json::Value worker;
+
+			SetInt(worker, "id", worker_stats.worker_id);
+			SetInt64(worker, "processedCount", worker_stats.processed_count);
+			SetInt64(worker, "stealCount", worker_stats.steal_count);
+			SetInt64(worker, "busyTimeUs", worker_stats.busy_time_us);
+			SetFloat(worker, "utilization", worker_stats.utilization);
+
+			workers.append(worker);
+		}
+
+		return value;
+	}
+
+	Json::Value JsonFromTranscodeFilterLadderStats(const TranscodeFilterLadderStats &stats)
+	{
+		Json::Value value;
+
+		SetString(value, "app", stats.app_name, Optional::False);
+		SetString(value, "stream", stats.stream_name, Optional::False);
+		SetInt64(value, "inputTrackId", stats.input_track_id);
+
+		Json::Value &rungs = value["rungs"];
+		rungs = Json::Value(Json::ValueType::arrayValue);
+
+		for (auto &rung_stats : stats.rungs)
+		{
+			Json::Value rung;
+
+			SetInt64(rung, "filterId", rung_stats.filter_id);
+			SetInt64(rung, "outputTrackId", rung_stats.output_track_id);
+			SetInt(rung, "width", rung_stats.width);
+			SetInt(rung, "height", rung_stats.height);
+			SetInt64(rung, "frameCount", rung_stats.frame_count);
+			SetFloat(rung, "averageLatencyUs", rung_stats.average_latency_us);
+			SetInt64(rung, "maxLatencyUs", rung_stats.max_latency_us);
+
+			rungs.append(rung);
+		}
+
+		return value;
+	}
+
+	Json::Value JsonFromTranscodeSchedulerStageStats(const TranscodeScheduler::StageStats &stats)
+	{
+		Json::Value value;
+
+		SetString(value, "stage", TranscodeScheduler::StringFromStage(stats.stage), Optional::False);
+		SetInt(value, "workerCount", stats.worker_count);
+		SetInt(value, "taskCount", stats.task_count);
+		SetInt64(value, "queuedCount", stats.queued_count);
+		SetInt64(value, "peakQueuedCount", stats.peak_queued_count);
+		SetInt64(value, "processedCount", stats.processed_count);
+		SetInt64(value, "heldCount", stats.held_count);
+		SetFloat(value, "utilization", stats.utilization);
+
+		return value;
+	}
+
+	Json::Value JsonFromFanOutStats(const pub::FanOutStats::Snapshot &stats)
+	{
+		Json::Value value;
+
+		SetInt64(value, "packetCount", stats.packet_count);
+		SetInt64(value, "deliveryCount", stats.delivery_count);
+		SetFloat(value, "busyTimeUsPerDelivery", stats.GetBusyTimeUsPerDelivery());
+		SetInt64(value, "latencyP50Us", stats.GetLatencyPercentileUs(0.5));
+		SetInt64(value, "latencyP99Us", stats.GetLatencyPercentileUs(0.99));
+
+		return value;
+	}
 }  // namespace serdes
\ No newline at end of file
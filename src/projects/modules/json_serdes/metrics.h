@@ -8,11 +8,23 @@
 //==============================================================================
 #pragma once
 
+#include <base/publisher/fan_out_stats.h>
+#include <mediarouter/mediarouter_worker_pool.h>
 #include <monitoring/monitoring.h>
+#include <transcoder/transcoder_filter_ladder_stats.h>
+#include <transcoder/transcoder_scheduler.h>
 
 namespace serdes
 {
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromMemoryPoolStats(const ov::MemoryPool::Stats &stats);
+	Json::Value JsonFromTlsSessionStats(const ov::TlsSessionCache::Stats &stats);
+	Json::Value JsonFromKernelTlsStats(const ov::TlsServerData::KernelTlsStats &stats);
+	Json::Value JsonFromDatagramBatchStats(const ov::DatagramSocket::BatchStats &stats);
+	Json::Value JsonFromMediaRouteWorkerPoolStats(const MediaRouteWorkerPool::PoolStats &stats);
+	Json::Value JsonFromTranscodeFilterLadderStats(const TranscodeFilterLadderStats &stats);
+	Json::Value JsonFromTranscodeSchedulerStageStats(const TranscodeScheduler::StageStats &stats);
+	Json::Value JsonFromFanOutStats(const pub::FanOutStats::Snapshot &stats);
 }  // namespace serdes
\ No newline at end of file
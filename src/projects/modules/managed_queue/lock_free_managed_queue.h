@@ -0,0 +1,812 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <monitoring/monitoring.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "base/info/managed_queue.h"
+#include "base/ovlibrary/ovlibrary.h"
+#include "managed_queue.h"
+
+// Minimum number of pre-allocated slots of the lock-free queue
+#define LOCK_FREE_MANAGED_QUEUE_MIN_CAPACITY 1024
+// When the capacity is not specified, it is derived from the threshold (threshold * N)
+#define LOCK_FREE_MANAGED_QUEUE_CAPACITY_MULTIPLIER 4
+#define LOCK_FREE_MANAGED_QUEUE_CACHE_LINE_SIZE 64
+
+namespace ov
+{
+	// Bounded ring buffer with pre-allocated slots (based on Dmitry Vyukov's bounded queue)
+	//
+	// - Producers never take a lock in the normal path. With MULTI_PRODUCER, the slot is reserved using CAS,
+	//   otherwise (SPSC) the enqueue position is advanced with a plain store.
+	// - There must be only one consumer (Dequeue/Front/GetBufferedTimeMs/Clear) at a time, and the consumer side takes no lock.
+	//   The consumer may move to another thread (e.g. a stream stolen by another MediaRouter worker)
+	//   as long as the hand-off itself is synchronized.
+	// - _wait_mutex/_condition are only used when the consumer is sleeping on an empty queue or
+	//   a producer is waiting for space (SetExceedWaitEnable), so there is no futex call while the queue is busy.
+	// - Like the locked queue, an item is never dropped because the queue is long. When the ring buffer is full,
+	//   the item is spilled to an overflow lane (protected by a mutex) and every following item goes there too until
+	//   the consumer drains it, so the order of each producer is kept. The ring is sized to hold several times the threshold,
+	//   so the overflow lane is only used when the consumer is already far behind.
+	//   Only when SetExceedWaitEnable(true) is set, the producer waits up to the timeout of Enqueue() and drops the item on timeout.
+	// - _count is reserved before the item is published and released after it is popped,
+	//   so it may be larger than the number of items for a moment, but never smaller.
+	// - Urgent items can't be inserted at the front of a ring buffer, so they are kept in a separate lane
+	//   that the consumer checks first. Urgent items are rare (control messages), so the lane is protected by a mutex.
+	//
+	// Metrics, threshold, URN and monitoring registration behave the same as the locked ManagedQueue.
+	template <typename T, bool MULTI_PRODUCER>
+	class LockFreeManagedQueue : public info::ManagedQueue
+	{
+	private:
+		const char *LOG_TAG = "ManagedQueue";
+
+		using Clock = std::chrono::high_resolution_clock;
+
+		struct Slot
+		{
+			std::atomic<size_t> sequence;
+			Clock::time_point start;
+			std::optional<T> data;
+		};
+
+		struct LaneItem
+		{
+			T data;
+			Clock::time_point start;
+		};
+
+	public:
+		LockFreeManagedQueue()
+			: LockFreeManagedQueue(nullptr) {}
+
+		LockFreeManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC, size_t capacity = 0)
+			: info::ManagedQueue(threshold),
+			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
+			  _log_interval(log_interval_in_msec)
+		{
+			if (capacity == 0)
+			{
+				capacity = std::max<size_t>(threshold * LOCK_FREE_MANAGED_QUEUE_CAPACITY_MULTIPLIER, LOCK_FREE_MANAGED_QUEUE_MIN_CAPACITY);
+			}
+
+			// Capacity must be a power of 2 to use a mask instead of a modulo
+			size_t aligned_capacity = 1;
+			while (aligned_capacity < capacity)
+			{
+				aligned_capacity <<= 1;
+			}
+
+			_mask = aligned_capacity - 1;
+			_slots = std::vector<Slot>(aligned_capacity);
+			for (size_t index = 0; index < aligned_capacity; index++)
+			{
+				_slots[index].sequence.store(index, std::memory_order_relaxed);
+			}
+
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			// Register to the server metrics
+			// If the Unique id is duplicated or memory allocation failed, retry
+			while (true)
+			{
+				SetId(IssueUniqueQueueId());
+
+				if (MonitorInstance->GetServerMetrics()->OnQueueCreated(*this) == true)
+				{
+					break;
+				}
+			}
+		}
+
+		~LockFreeManagedQueue()
+		{
+			Clear();
+
+			// Unregister to the server metrics
+			MonitorInstance->GetServerMetrics()->OnQueueDeleted(*this);
+		}
+
+		void SetUrn(std::shared_ptr<info::ManagedQueue::URN> urn)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
+		}
+
+		size_t GetCapacity() const
+		{
+			return _mask + 1;
+		}
+
+		// Urgent item will be delivered before the items in the ring buffer
+		void Enqueue(const T &item, bool urgent = false, int timeout = Infinite)
+		{
+			T value = item;
+			EnqueueInternal(std::move(value), urgent, timeout);
+		}
+
+		// Urgent item will be delivered before the items in the ring buffer
+		void Enqueue(T &&item, bool urgent = false, int timeout = Infinite)
+		{
+			EnqueueInternal(std::move(item), urgent, timeout);
+		}
+
+		// Must be called by the consumer
+		std::optional<T> Front(int timeout = Infinite)
+		{
+			std::optional<T> value;
+
+			WaitFor(timeout, [&]() -> bool {
+				value = PeekInternal();
+				return value.has_value();
+			});
+
+			return value;
+		}
+
+		// How long the first message has been buffered
+		// Must be called by the consumer
+		int32_t GetBufferedTimeMs()
+		{
+			return GetBufferedTimeMsInternal();
+		}
+
+		// Must be called by the consumer
+		std::optional<T> Dequeue(int timeout = Infinite)
+		{
+			if (_stop)
+			{
+				return {};	// Stop is requested
+			}
+
+			std::optional<T> value;
+
+			if (_buffering_delay == 0)
+			{
+				WaitFor(timeout, [&]() -> bool {
+					value = DequeueInternal();
+					return value.has_value();
+				});
+			}
+			else
+			{
+				Clock::time_point expire = (timeout == Infinite) ? Clock::time_point::max() : Clock::now() + std::chrono::milliseconds(timeout);
+
+				while (_stop == false)
+				{
+					int32_t buffered_time = GetBufferedTimeMs();
+
+					if ((_count.load(std::memory_order_acquire) > 0) && (buffered_time >= _buffering_delay))
+					{
+						value = DequeueInternal();
+						break;
+					}
+
+					auto now = Clock::now();
+					if (now >= expire)
+					{
+						break;
+					}
+
+					// Sleep until the front item reaches the buffering delay, or until a new item comes in
+					auto wake_up = (_count.load(std::memory_order_acquire) > 0) ? std::min(now + std::chrono::milliseconds(_buffering_delay - buffered_time), expire) : expire;
+					int wait_timeout = Infinite;
+
+					if (wake_up != Clock::time_point::max())
+					{
+						auto remained = std::chrono::duration_cast<std::chrono::milliseconds>(wake_up - now).count();
+						wait_timeout = static_cast<int>(std::clamp<int64_t>(remained, 1, _buffering_delay));
+					}
+
+					WaitFor(wait_timeout, [&]() -> bool {
+						return (_count.load(std::memory_order_acquire) > 0) && (GetBufferedTimeMs() >= _buffering_delay);
+					});
+				}
+			}
+
+			if (value.has_value() == false)
+			{
+				return {};	// timed out / Stop is requested
+			}
+
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (_producer_waiting.load(std::memory_order_relaxed) > 0)
+			{
+				auto lock_guard = std::lock_guard(_wait_mutex);
+				_condition.notify_all();
+			}
+
+			UpdateMetrics();
+
+			return value;
+		}
+
+		bool IsEmpty() const
+		{
+			return (_count.load(std::memory_order_acquire) == 0);
+		}
+
+		// Cleared all items in the queue
+		// Must be called by the consumer, or after the consumer is stopped
+		void Clear()
+		{
+			while (PopInternal().has_value())
+			{
+			}
+
+			ClearMetrics();
+		}
+
+		size_t Size() const
+		{
+			return _count.load(std::memory_order_acquire);
+		}
+
+		void Stop()
+		{
+			_stop = true;
+
+			ClearMetrics();
+
+			auto lock_guard = std::lock_guard(_wait_mutex);
+			_condition.notify_all();
+		}
+
+		bool IsStopped() const
+		{
+			return _stop;
+		}
+
+		// Message skipping is deactivated in the locked queue (SKIP_MESSAGE_ENABLED), kept for the interface compatibility
+		void SetSkipMessageEnable(bool enable)
+		{
+			_skip_message_enabled = enable;
+		}
+
+		void SetExceedWaitEnable(bool enable)
+		{
+			_exceed_threshold_and_wait_enabled = enable;
+		}
+
+		bool IsExceedWaitEnable()
+		{
+			return _exceed_threshold_and_wait_enabled;
+		}
+
+		// Buffer keeps items for a certain amount of time
+		void SetBufferingDelay(int delay_ms)
+		{
+			_buffering_delay = delay_ms;
+		}
+
+	private:
+		// Wait until the condition is met, the timeout expires or Stop() is called.
+		// The condition is checked first without any lock, so the mutex is only used when the consumer needs to sleep.
+		template <typename Tcondition>
+		bool WaitFor(int timeout, Tcondition condition)
+		{
+			if (_stop)
+			{
+				return false;
+			}
+
+			if (condition())
+			{
+				return true;
+			}
+
+			if (timeout == 0)
+			{
+				return false;
+			}
+
+			std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			auto unique_lock = std::unique_lock(_wait_mutex);
+
+			_consumer_waiting.store(true, std::memory_order_seq_cst);
+			// Pairs with the fence in NotifyConsumer() so that either the producer sees _consumer_waiting, or the consumer sees the item
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto result = _condition.wait_until(unique_lock, expire, [&]() -> bool {
+				return _stop || condition();
+			});
+
+			_consumer_waiting.store(false, std::memory_order_relaxed);
+
+			return result && (_stop == false);
+		}
+
+		void NotifyConsumer()
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (_consumer_waiting.load(std::memory_order_relaxed))
+			{
+				auto lock_guard = std::lock_guard(_wait_mutex);
+				_condition.notify_all();
+			}
+		}
+
+		// Reserve a slot and publish the item. Returns false if the ring buffer is full.
+		bool TryPush(T &value)
+		{
+			size_t position = _enqueue_position.load(std::memory_order_relaxed);
+			Slot *slot = nullptr;
+
+			while (true)
+			{
+				slot = &_slots[position & _mask];
+				size_t sequence = slot->sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+				if (diff == 0)
+				{
+					if constexpr (MULTI_PRODUCER)
+					{
+						if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else
+					{
+						_enqueue_position.store(position + 1, std::memory_order_relaxed);
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Full
+					return false;
+				}
+				else
+				{
+					position = _enqueue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			slot->data.emplace(std::move(value));
+			slot->start = Clock::now();
+			slot->sequence.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		void EnqueueInternal(T &&value, bool urgent, int timeout)
+		{
+			// Update statistics of input message count
+			_input_count.fetch_add(1, std::memory_order_relaxed);
+
+			if (urgent)
+			{
+				auto size = ReserveCount();
+
+				{
+					auto lock_guard = std::lock_guard(_urgent_mutex);
+					_urgent_items.push_back({std::move(value), Clock::now()});
+					_urgent_count.fetch_add(1, std::memory_order_release);
+				}
+
+				OnPushed(size, true);
+				return;
+			}
+
+			// Wait until the queue size is less than threshold
+			if (_exceed_threshold_and_wait_enabled && (_threshold > 0) && (_count.load(std::memory_order_acquire) >= _threshold))
+			{
+				if (WaitForSpace(timeout, [this]() -> bool { return _count.load(std::memory_order_acquire) < _threshold; }) == false)
+				{
+					loge(LOG_TAG, "[%s] queue is full. q.size(%zu), q.threshold(%zu)", ToString().CStr(), Size(), _threshold);
+					_drop_count.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+			}
+
+			// The count must be reserved before the slot is published, otherwise the consumer may pop the item
+			// and decrease the count before it is increased
+			auto size = ReserveCount();
+
+			// Once an item is spilled, the following items must also be spilled until the consumer drains the overflow lane
+			if ((_overflow_count.load(std::memory_order_acquire) > 0) || (TryPush(value) == false))
+			{
+				PushOverflow(std::move(value));
+			}
+
+			OnPushed(size, false);
+		}
+
+		void PushOverflow(T &&value)
+		{
+			bool first_spill = false;
+
+			{
+				auto lock_guard = std::lock_guard(_overflow_mutex);
+				_overflow_items.push_back({std::move(value), Clock::now()});
+				first_spill = (_overflow_count.fetch_add(1, std::memory_order_release) == 0);
+			}
+
+			if (first_spill)
+			{
+				auto current = ov::Time::GetTimestampInMs();
+				auto last_log_time = _last_full_log_time.load(std::memory_order_relaxed);
+				if ((current - last_log_time > _log_interval) && _last_full_log_time.compare_exchange_strong(last_log_time, current))
+				{
+					logw(LOG_TAG, "[%u] %s ring buffer is full, items are kept in the overflow lane. capacity: %zu, threshold: %zu, size: %zu", GetId(), ToString().CStr(), GetCapacity(), _threshold, Size());
+				}
+			}
+		}
+
+		template <typename Tcondition>
+		bool WaitForSpace(int timeout, Tcondition condition)
+		{
+			std::chrono::system_clock::time_point expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			auto unique_lock = std::unique_lock(_wait_mutex);
+
+			_producer_waiting.fetch_add(1, std::memory_order_seq_cst);
+			auto result = _condition.wait_until(unique_lock, expire, [&]() -> bool {
+				return _stop || condition();
+			});
+			_producer_waiting.fetch_sub(1, std::memory_order_relaxed);
+
+			return result && (_stop == false);
+		}
+
+		// Returns the number of items including the reserved one
+		size_t ReserveCount()
+		{
+			return _count.fetch_add(1, std::memory_order_acq_rel) + 1;
+		}
+
+		void OnPushed(size_t size, bool urgent)
+		{
+			// Update the peak statistics
+			size_t peak = _peak_count.load(std::memory_order_relaxed);
+			while ((peak < size) && (_peak_count.compare_exchange_weak(peak, size, std::memory_order_relaxed) == false))
+			{
+			}
+
+			// If the buffering delay is set, the consumer wakes up by itself when the front item reaches the delay,
+			// so it only needs to be notified when the queue becomes non-empty or an urgent item comes in.
+			if ((_buffering_delay == 0) || urgent || (size == 1))
+			{
+				NotifyConsumer();
+			}
+
+			UpdateMetrics();
+		}
+
+		std::optional<T> PeekInternal()
+		{
+			if (_urgent_count.load(std::memory_order_acquire) > 0)
+			{
+				auto urgent_lock_guard = std::lock_guard(_urgent_mutex);
+				if (_urgent_items.empty() == false)
+				{
+					return _urgent_items.front().data;
+				}
+			}
+
+			auto &slot = _slots[_dequeue_position & _mask];
+			if (slot.sequence.load(std::memory_order_acquire) == (_dequeue_position + 1))
+			{
+				return *slot.data;
+			}
+
+			if (_overflow_count.load(std::memory_order_acquire) > 0)
+			{
+				auto overflow_lock_guard = std::lock_guard(_overflow_mutex);
+				if (_overflow_items.empty() == false)
+				{
+					return _overflow_items.front().data;
+				}
+			}
+
+			return {};
+		}
+
+		std::optional<T> DequeueInternal()
+		{
+			auto value = PopInternal();
+
+			if (value.has_value())
+			{
+				// Update statistics of output message count
+				_output_count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			return value;
+		}
+
+		// Must be called by the consumer
+		std::optional<T> PopInternal()
+		{
+			Clock::time_point start;
+			std::optional<T> value;
+
+			if (_urgent_count.load(std::memory_order_acquire) > 0)
+			{
+				auto urgent_lock_guard = std::lock_guard(_urgent_mutex);
+				if (_urgent_items.empty() == false)
+				{
+					value = std::move(_urgent_items.front().data);
+					start = _urgent_items.front().start;
+					_urgent_items.pop_front();
+					_urgent_count.fetch_sub(1, std::memory_order_release);
+				}
+			}
+
+			if (value.has_value() == false)
+			{
+				auto &slot = _slots[_dequeue_position & _mask];
+				if (slot.sequence.load(std::memory_order_acquire) == (_dequeue_position + 1))
+				{
+					value = std::move(slot.data);
+					start = slot.start;
+					slot.data.reset();
+
+					// Release the slot for the producer of the next lap
+					slot.sequence.store(_dequeue_position + _mask + 1, std::memory_order_release);
+					_dequeue_position++;
+				}
+			}
+
+			// The overflow lane only has items that were pushed after the ring buffer became full,
+			// so it is drained after the ring buffer
+			if ((value.has_value() == false) && (_overflow_count.load(std::memory_order_acquire) > 0))
+			{
+				auto overflow_lock_guard = std::lock_guard(_overflow_mutex);
+				if (_overflow_items.empty() == false)
+				{
+					value = std::move(_overflow_items.front().data);
+					start = _overflow_items.front().start;
+					_overflow_items.pop_front();
+					_overflow_count.fetch_sub(1, std::memory_order_release);
+				}
+			}
+
+			if (value.has_value() == false)
+			{
+				return {};
+			}
+
+			_count.fetch_sub(1, std::memory_order_acq_rel);
+
+			// Update statistics of waiting time (microseconds)
+			auto current = Clock::now();
+			_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - start).count() * 0.1;
+
+			return value;
+		}
+
+		// Must be called by the consumer
+		int32_t GetBufferedTimeMsInternal()
+		{
+			if (_urgent_count.load(std::memory_order_acquire) > 0)
+			{
+				return ov::Infinite;
+			}
+
+			Clock::time_point start;
+
+			auto &slot = _slots[_dequeue_position & _mask];
+			if (slot.sequence.load(std::memory_order_acquire) == (_dequeue_position + 1))
+			{
+				start = slot.start;
+			}
+			else if (_overflow_count.load(std::memory_order_acquire) > 0)
+			{
+				auto overflow_lock_guard = std::lock_guard(_overflow_mutex);
+				if (_overflow_items.empty())
+				{
+					return 0;
+				}
+
+				start = _overflow_items.front().start;
+			}
+			else
+			{
+				return 0;
+			}
+
+			auto current = Clock::now();
+			return std::chrono::duration_cast<std::chrono::milliseconds>(current - start).count();
+		}
+
+	protected:
+		// Update statistical metrics and send data to monitoring module.
+		// Both producers and the consumer call this, but only one of them updates the metrics per interval.
+		void UpdateMetrics()
+		{
+			auto current = ov::Time::GetTimestampInMs();
+
+			if (current < _next_metrics_update_time.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			if (_metrics_updating.test_and_set(std::memory_order_acquire))
+			{
+				return;
+			}
+
+			if (_timer.IsStart() == false)
+			{
+				_timer.Start();
+			}
+
+			if (_timer.IsElapsed(_stats_metric_interval))
+			{
+				int elapsed_time = _timer.Elapsed();
+				_timer.Update();
+
+				_size = _count.load(std::memory_order_acquire);
+				_peak = _peak_count.load(std::memory_order_relaxed);
+				_input_message_count = _input_count.load(std::memory_order_relaxed);
+				_output_message_count = _output_count.load(std::memory_order_relaxed);
+				_drop_message_count = _drop_count.load(std::memory_order_relaxed);
+
+				// Update statistics of message per second
+				_input_message_per_second = (double)(_input_message_count - _last_input_message_count) * (1000.0 / (double)elapsed_time);
+				_output_message_per_second = (double)(_output_message_count - _last_output_message_count) * (1000.0 / (double)elapsed_time);
+				_last_input_message_count = _input_message_count;
+				_last_output_message_count = _output_message_count;
+
+				int adjusted_size = _size;
+
+				if (_buffering_delay > 0)
+				{
+					// excluding the estimated intended buffer size
+					int intended_buffer_size = (double)_input_message_per_second * ((double)_buffering_delay / 1000.0);
+					adjusted_size -= intended_buffer_size;
+
+					if (adjusted_size < 0)
+					{
+						adjusted_size = 0;
+					}
+				}
+
+				if ((_threshold > 0) && ((size_t)adjusted_size >= _threshold))
+				{
+					_threshold_exceeded_time_in_us += _stats_metric_interval;
+
+					// Logging
+					_last_logging_time += _stats_metric_interval;
+					if ((_last_logging_time >= _log_interval) && (_last_logged_peak < _peak))
+					{
+						_last_logging_time = 0;
+
+						auto shared_lock = std::shared_lock(_name_mutex);
+						logw(LOG_TAG, "[%u] %s has exceeded the threshold and increased peak. size: %zu, threshold: %zu, peak: %zu", GetId(), _urn->ToString().CStr(), _size, _threshold, _peak);
+
+						_last_logged_peak = _peak;
+					}
+				}
+				else
+				{
+					_threshold_exceeded_time_in_us = 0;
+				}
+
+				MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+
+				_next_metrics_update_time.store(current + _stats_metric_interval, std::memory_order_relaxed);
+			}
+
+			_metrics_updating.clear(std::memory_order_release);
+		}
+
+		void ClearMetrics()
+		{
+			while (_metrics_updating.test_and_set(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			_peak_count = 0;
+			_input_count = 0;
+			_output_count = 0;
+
+			_size = _count.load(std::memory_order_acquire);
+			_peak = 0;
+			_input_message_per_second = 0;
+			_output_message_per_second = 0;
+			_input_message_count = 0;
+			_last_input_message_count = 0;
+			_output_message_count = 0;
+			_last_output_message_count = 0;
+			_threshold_exceeded_time_in_us = 0;
+
+			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+
+			_metrics_updating.clear(std::memory_order_release);
+		}
+
+	private:
+		StopWatch _timer;
+
+		int _stats_metric_interval = 0;
+
+		int _log_interval = 0;
+		int64_t _last_logging_time = 0;
+
+		// Use to print logs when the peak value of the queue is increased.
+		size_t _last_logged_peak = 0;
+
+		// Pre-allocated slots of the ring buffer
+		std::vector<Slot> _slots;
+		size_t _mask = 0;
+
+		// Producer side (kept in a separate cache line from the consumer side to avoid false sharing)
+		alignas(LOCK_FREE_MANAGED_QUEUE_CACHE_LINE_SIZE) std::atomic<size_t> _enqueue_position = 0;
+		// Consumer side
+		alignas(LOCK_FREE_MANAGED_QUEUE_CACHE_LINE_SIZE) size_t _dequeue_position = 0;
+
+		alignas(LOCK_FREE_MANAGED_QUEUE_CACHE_LINE_SIZE) std::atomic<size_t> _count = 0;
+		std::atomic<size_t> _peak_count = 0;
+		std::atomic<int64_t> _input_count = 0;
+		std::atomic<int64_t> _output_count = 0;
+		std::atomic<uint64_t> _drop_count = 0;
+		std::atomic<int64_t> _last_full_log_time = 0;
+
+		std::atomic<int64_t> _next_metrics_update_time = 0;
+		std::atomic_flag _metrics_updating = ATOMIC_FLAG_INIT;
+
+		// Separated lane for the urgent items
+		std::mutex _urgent_mutex;
+		std::deque<LaneItem> _urgent_items;
+		std::atomic<size_t> _urgent_count = 0;
+
+		// Items pushed while the ring buffer is full (or while the lane is not empty)
+		std::mutex _overflow_mutex;
+		std::deque<LaneItem> _overflow_items;
+		std::atomic<size_t> _overflow_count = 0;
+
+		// Only used to sleep/wake up when the queue is empty (consumer) or over the threshold (producers)
+		std::mutex _wait_mutex;
+		std::condition_variable _condition;
+		std::atomic<bool> _consumer_waiting = false;
+		std::atomic<int> _producer_waiting = 0;
+
+		// Stop flag
+		std::atomic<bool> _stop = false;
+
+		bool _skip_message_enabled = false;
+
+		// Prevent exceed threshold. If true, the queue will not exceed the threshold
+		// Wait until the queue falls below the threshold
+		bool _exceed_threshold_and_wait_enabled = false;
+
+		// Delay
+		int _buffering_delay = 0;
+	};
+
+	template <typename T>
+	class ManagedQueue<T, ManagedQueueType::Mpsc> : public LockFreeManagedQueue<T, true>
+	{
+	public:
+		using LockFreeManagedQueue<T, true>::LockFreeManagedQueue;
+	};
+
+	template <typename T>
+	class ManagedQueue<T, ManagedQueueType::Spsc> : public LockFreeManagedQueue<T, false>
+	{
+	public:
+		using LockFreeManagedQueue<T, false>::LockFreeManagedQueue;
+	};
+}  // namespace ov
@@ -30,7 +30,18 @@
 
 namespace ov
 {
-	template <typename T>
+	enum class ManagedQueueType : uint8_t
+	{
+		// Linked list protected by a mutex (unbounded, supports Back())
+		Locked,
+		// Lock-free bounded ring buffer with multiple producers and a single consumer
+		Mpsc,
+		// Lock-free bounded ring buffer with a single producer and a single consumer
+		Spsc
+	};
+
+	// The lock-free variants are implemented in lock_free_managed_queue.h
+	template <typename T, ManagedQueueType QUEUE_TYPE = ManagedQueueType::Locked>
 	class ManagedQueue : public info::ManagedQueue
 	{
 	private:
@@ -647,4 +658,6 @@ namespace ov
 		int _buffering_delay = 0;
 	};
 
-}  // namespace ov
\ No newline at end of file
+}  // namespace ov
+
+#include "lock_free_managed_queue.h"
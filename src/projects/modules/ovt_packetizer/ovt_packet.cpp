@@ -180,6 +180,22 @@ const std::shared_ptr<ov::Data>& OvtPacket::GetData() const
 	return _data;
 }
 
+std::shared_ptr<ov::Data> OvtPacket::MakeHeader(uint32_t session_id) const
+{
+	auto header = std::make_shared<ov::Data>(_buffer, OVT_FIXED_HEADER_SIZE);
+
+	ByteWriter<uint32_t>::WriteBigEndian(header->GetWritableDataAs<uint8_t>() + 12, session_id);
+
+	return header;
+}
+
+std::shared_ptr<const ov::Data> OvtPacket::GetPayloadData() const
+{
+	std::shared_ptr<const ov::Data> data = _data;
+
+	return data->Subdata(OVT_FIXED_HEADER_SIZE, _payload_length);
+}
+
 void OvtPacket::SetMarker(bool marker_bit)
 {
 	_marker = marker_bit;
@@ -189,6 +189,11 @@ public:
 	const uint8_t* GetBuffer() const;
 	const std::shared_ptr<ov::Data>& GetData() const;
 
+	// Used to send the same packet to multiple sessions without copying the payload:
+	// each session sends its own header (with its session id) followed by the shared payload
+	std::shared_ptr<ov::Data> MakeHeader(uint32_t session_id) const;
+	std::shared_ptr<const ov::Data> GetPayloadData() const;
+
 private:
 	void 		SetPayloadLength(size_t payload_length);
 
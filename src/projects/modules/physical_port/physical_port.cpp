@@ -191,7 +191,7 @@ bool PhysicalPort::CreateDatagramSocket(
 				}
 				else if (socket->Prepare(
 							 address,
-							 std::bind(&PhysicalPort::OnDatagram, this,
+							 std::bind(&PhysicalPort::OnDatagrams, this,
 									   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)))
 				{
 					_type = type;
@@ -283,12 +283,14 @@ void PhysicalPort::OnClientData(const std::shared_ptr<ov::ClientSocket> &client,
 	}
 }
 
-void PhysicalPort::OnDatagram(const std::shared_ptr<ov::DatagramSocket> &client, const ov::SocketAddressPair &address_pair, const std::shared_ptr<ov::Data> &data)
+void PhysicalPort::OnDatagrams(const std::shared_ptr<ov::DatagramSocket> &client, const std::vector<ov::Datagram> &datagrams, size_t count)
 {
+	const std::shared_ptr<ov::Socket> remote = client;
+
 	// Notify observers
 	for (auto &observer : _observer_list)
 	{
-		observer->OnDatagramReceived(client, address_pair, data);
+		observer->OnDatagramsReceived(remote, datagrams, count);
 	}
 }
 
@@ -48,6 +48,16 @@ public:
 	// Called when the packet is received (Only used when UDP)
 	virtual void OnDatagramReceived(const std::shared_ptr<ov::Socket> &remote, const ov::SocketAddressPair &address_pair, const std::shared_ptr<const ov::Data> &data) {}
 
+	// Called when multiple packets are received at once using recvmmsg() (Only used when UDP)
+	// Only the first <count> items of <datagrams> are valid
+	virtual void OnDatagramsReceived(const std::shared_ptr<ov::Socket> &remote, const std::vector<ov::Datagram> &datagrams, size_t count)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			OnDatagramReceived(remote, datagrams[index].address_pair, datagrams[index].data);
+		}
+	}
+
 	// Called when the client is disconnected
 	virtual void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) {}
 
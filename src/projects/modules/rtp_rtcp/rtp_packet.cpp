@@ -68,6 +68,62 @@ RtpPacket::~RtpPacket()
 
 }
 
+bool RtpPacket::CopyFrom(const RtpPacket &src)
+{
+	if (src._data == nullptr)
+	{
+		return false;
+	}
+
+	auto length = src._data->GetLength();
+
+	if (_data == nullptr)
+	{
+		_data = std::make_shared<ov::Data>(std::max<size_t>(RTP_DEFAULT_MAX_PACKET_SIZE, length));
+	}
+
+	// If the previous buffer is still referenced (e.g. queued in the socket), ov::Data detaches it here (copy-on-write)
+	if (_data->SetLength(length) == false)
+	{
+		return false;
+	}
+
+	_buffer = _data->GetWritableDataAs<uint8_t>();
+	::memcpy(_buffer, src._data->GetData(), length);
+
+	_marker = src._marker;
+	_payload_type = src._payload_type;
+	_origin_payload_type = src._origin_payload_type;
+	_is_fec = src._is_fec;
+	_ssrc = src._ssrc;
+	_payload_offset = src._payload_offset;
+	_payload_size = src._payload_size;
+	_padding_size = src._padding_size;
+	_has_padding = src._has_padding;
+	_has_extension = src._has_extension;
+	_cc = src._cc;
+	_sequence_number = src._sequence_number;
+	_timestamp = src._timestamp;
+	_extension_size = src._extension_size;
+	// std::map reuses its nodes on copy assignment, and ov::Data is assigned as copy-on-write
+	_extensions = src._extensions;
+	_extension_buffer_offset = src._extension_buffer_offset;
+	_extension_type = src._extension_type;
+
+	// Extra Data
+	_track_id = src._track_id;
+	_ntp_timestamp = src._ntp_timestamp;
+	_is_keyframe = src._is_keyframe;
+	_is_first_packet_of_frame = src._is_first_packet_of_frame;
+	_is_video_packet = src._is_video_packet;
+	_rtsp_channel = src._rtsp_channel;
+	_created_time = std::chrono::system_clock::now();
+
+	_is_available = true;
+
+	return true;
+}
+
 ov::String RtpPacket::Dump()
 {
 	if(_is_available == false)
@@ -43,6 +43,10 @@ public:
 	RtpPacket(const RtpPacket &src);
 	virtual ~RtpPacket();
 
+	// Copy src into this packet, reusing the buffer this packet already has.
+	// Used to modify the packet per session (sequence number, extensions, SRTP) without allocating a new packet each time
+	bool		CopyFrom(const RtpPacket &src);
+
 	// Parse from Data
 	bool		Parse(const std::shared_ptr<const ov::Data> &data);
 
@@ -14,6 +14,12 @@
 class WhipInterceptor : public http::svr::DefaultInterceptor
 {
 protected:
+	std::vector<http::svr::InterceptorRoute> GetRoutes() const override
+	{
+		return {
+			{http::Method::Post | http::Method::Delete | http::Method::Patch | http::Method::Options}};
+	}
+
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &exchange) override
 	{
 		auto request = exchange->GetRequest();
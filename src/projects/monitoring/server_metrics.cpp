@@ -213,4 +213,24 @@ namespace mon
 
 		return _queues[queue_info.GetId()];
 	}
+
+	std::vector<ov::MemoryPool::Stats> ServerMetrics::GetMemoryPoolStatsList() const
+	{
+		return ov::MemoryPool::GetInstance()->GetStats();
+	}
+
+	ov::TlsSessionCache::Stats ServerMetrics::GetTlsSessionStats() const
+	{
+		return ov::TlsSessionCache::GetInstance()->GetStats();
+	}
+
+	ov::TlsServerData::KernelTlsStats ServerMetrics::GetKernelTlsStats() const
+	{
+		return ov::TlsServerData::GetKernelTlsStats();
+	}
+
+	ov::DatagramSocket::BatchStats ServerMetrics::GetDatagramBatchStats() const
+	{
+		return ov::DatagramSocket::GetBatchStats();
+	}
 }  // namespace mon
\ No newline at end of file
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <base/ovcrypto/ovcrypto.h>
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
 #include "base/info/host.h"
 #include "base/info/managed_queue.h"
 #include "host_metrics.h"
@@ -45,5 +47,22 @@ namespace mon
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+	// Memory pool metrics
+	public:
+		// Stats of ov::MemoryPool for each size class (used by ov::Data and MediaPacket)
+		std::vector<ov::MemoryPool::Stats> GetMemoryPoolStatsList() const;
+
+	// TLS session metrics
+	public:
+		// Stats of the TLS session cache shared by all HTTPS servers
+		ov::TlsSessionCache::Stats GetTlsSessionStats() const;
+		// Stats of the kTLS TX offloading of all HTTPS connections
+		ov::TlsServerData::KernelTlsStats GetKernelTlsStats() const;
+
+	// Socket metrics
+	public:
+		// Stats of the UDP egress batches (sendmmsg/UDP_SEGMENT)
+		ov::DatagramSocket::BatchStats GetDatagramBatchStats() const;
 	};
 }
\ No newline at end of file
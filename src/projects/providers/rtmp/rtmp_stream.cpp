@@ -1704,8 +1704,8 @@ namespace pvd
 				return true;
 			}
 
-			auto data = std::make_shared<ov::Data>(flv_video.Payload(), flv_video.PayloadLength());
-			auto video_frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto data = ov::AllocateShared<ov::Data>(flv_video.Payload(), flv_video.PayloadLength());
+			auto video_frame = ov::AllocateShared<MediaPacket>(GetMsid(),
 															 cmn::MediaType::Video,
 															 RTMP_VIDEO_TRACK_ID,
 															 data,
@@ -1865,7 +1865,7 @@ namespace pvd
 				return false;
 			}
 
-			auto data = std::make_shared<ov::Data>(flv_audio.Payload(), flv_audio.PayloadLength());
+			auto data = ov::AllocateShared<ov::Data>(flv_audio.Payload(), flv_audio.PayloadLength());
 
 			cmn::PacketType packet_type = cmn::PacketType::Unknown;
 
@@ -1891,7 +1891,7 @@ namespace pvd
 				AdjustTimestamp(pts, dts);
 			}
 
-			auto frame = std::make_shared<MediaPacket>(GetMsid(),
+			auto frame = ov::AllocateShared<MediaPacket>(GetMsid(),
 													   cmn::MediaType::Audio,
 													   RTMP_AUDIO_TRACK_ID,
 													   data,
@@ -583,7 +583,7 @@ namespace pvd
 		logtd("Payload Type(%d) Timestamp(%u) PTS(%u) Time scale(%f) Adjust Timestamp(%f)",
 			  first_rtp_packet->PayloadType(), first_rtp_packet->Timestamp(), adjusted_timestamp, track->GetTimeBase().GetExpr(), static_cast<double>(adjusted_timestamp) * track->GetTimeBase().GetExpr());
 
-		auto frame = std::make_shared<MediaPacket>(GetMsid(),
+		auto frame = ov::AllocateShared<MediaPacket>(GetMsid(),
 												   track->GetMediaType(),
 												   track->GetId(),
 												   bitstream,
@@ -637,7 +637,7 @@ namespace pvd
 		// This may not work since almost WebRTC browser sends SRS/PPS in-band
 		if (_sent_sequence_header == false && track->GetCodecId() == cmn::MediaCodecId::H264 && _h264_extradata_nalu != nullptr)
 		{
-			auto sps_pps_packet = std::make_shared<MediaPacket>(GetMsid(),	
+			auto sps_pps_packet = ov::AllocateShared<MediaPacket>(GetMsid(),	
 																track->GetMediaType(), 
 																track->GetId(), 
 																_h264_extradata_nalu,
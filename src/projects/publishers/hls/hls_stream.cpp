@@ -608,21 +608,9 @@ bool HlsStream::CreatePackagers()
 			packager->AddSink(mpegts::PackagerSink::GetSharedPtr());
 
 			//////////////////////////////////
-			// Create Packetizer
+			// Collect tracks for Packetizer
 			//////////////////////////////////
-			auto packetizer = std::make_shared<mpegts::Packetizer>();
-			if (packetizer == nullptr)
-			{
-				logte("Failed to create packager");
-				return false;
-			}
-
-			{
-				std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-				_packetizers.emplace(variant_name, packetizer);
-			}
-
-			packetizer->AddSink(packager);
+			std::vector<std::shared_ptr<const MediaTrack>> packetizer_tracks;
 
 			if (video_variant_name.IsEmpty() == false)
 			{
@@ -637,13 +625,7 @@ bool HlsStream::CreatePackagers()
 					}
 					else
 					{
-						packetizer->AddTrack(track);
-
-						// Add to track packetizers
-						{
-							std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-							_track_packetizers[track->GetId()].emplace_back(packetizer);
-						}
+						packetizer_tracks.push_back(track);
 
 						media_playlist->AddMediaTrackInfo(track);
 					}
@@ -652,13 +634,7 @@ bool HlsStream::CreatePackagers()
 				{
 					for (auto track : video_track_group->GetTracks())
 					{
-						packetizer->AddTrack(track);
-
-						// Add to track packetizers
-						{
-							std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-							_track_packetizers[track->GetId()].emplace_back(packetizer);
-						}
+						packetizer_tracks.push_back(track);
 
 						media_playlist->AddMediaTrackInfo(track);
 
@@ -682,13 +658,7 @@ bool HlsStream::CreatePackagers()
 					}
 					else
 					{
-						packetizer->AddTrack(track);
-
-						// Add to track packetizers
-						{
-							std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-							_track_packetizers[track->GetId()].emplace_back(packetizer);
-						}
+						packetizer_tracks.push_back(track);
 
 						media_playlist->AddMediaTrackInfo(track);
 					}
@@ -697,13 +667,7 @@ bool HlsStream::CreatePackagers()
 				{
 					for (auto track : audio_track_group->GetTracks())
 					{
-						packetizer->AddTrack(track);
-
-						// Add to track packetizers
-						{
-							std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-							_track_packetizers[track->GetId()].emplace_back(packetizer);
-						}
+						packetizer_tracks.push_back(track);
 
 						media_playlist->AddMediaTrackInfo(track);
 					}
@@ -713,17 +677,31 @@ bool HlsStream::CreatePackagers()
 			auto data_track = GetFirstTrackByType(cmn::MediaType::Data);
 			if (data_track != nullptr)
 			{
-				packetizer->AddTrack(data_track);
+				packetizer_tracks.push_back(data_track);
+			}
+
+			//////////////////////////////////
+			// Subscribe Packetizer
+			//////////////////////////////////
+			// The packetizer is shared with the other publishers that send the same tracks (such as SRT)
+			auto packetizer = mpegts::PacketizerService::GetInstance()->Subscribe(*this, packetizer_tracks, packager);
+			if (packetizer == nullptr)
+			{
+				logte("Failed to create packetizer");
+				return false;
+			}
+
+			{
+				std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
+				_packetizers.emplace(variant_name, packetizer);
 
-				// Add to track packetizers
+				for (const auto &track : packetizer_tracks)
 				{
-					std::lock_guard<std::shared_mutex> lock(_packetizers_guard);
-					_track_packetizers[data_track->GetId()].emplace_back(packetizer);
+					_track_packetizers[track->GetId()].emplace_back(packetizer);
 				}
 			}
 
 			master_playlist->AddMediaPlaylist(media_playlist);
-			packetizer->Start();
 		}
 	}
 
@@ -759,7 +737,7 @@ ov::String HlsStream::GetSegmentName(const ov::String &variant_name, uint32_t nu
 	return ov::String::FormatString("seg_%s_%u_hls.ts", variant_name.CStr(), number);
 }
 
-std::shared_ptr<mpegts::Packetizer> HlsStream::GetPacketizer(const ov::String &variant_name)
+std::shared_ptr<mpegts::PacketizerSubscription> HlsStream::GetPacketizer(const ov::String &variant_name)
 {
 	std::shared_lock<std::shared_mutex> lock(_packetizers_guard);
 
@@ -10,7 +10,7 @@
 
 #include <base/common_types.h>
 #include <base/publisher/stream.h>
-#include <modules/containers/mpegts/mpegts_packetizer.h>
+#include <modules/containers/mpegts/mpegts_packetizer_service.h>
 #include <modules/containers/mpegts/mpegts_packager.h>
 #include <monitoring/monitoring.h>
 
@@ -73,7 +73,7 @@ private:
 	ov::String GetMediaPlaylistName(const ov::String &variant_name) const;
 	ov::String GetSegmentName(const ov::String &variant_name, uint32_t number) const;
 
-	std::shared_ptr<mpegts::Packetizer> GetPacketizer(const ov::String &variant_name);
+	std::shared_ptr<mpegts::PacketizerSubscription> GetPacketizer(const ov::String &variant_name);
 	std::shared_ptr<mpegts::Packager> GetPackager(const ov::String &variant_name);
 	std::shared_ptr<HlsMediaPlaylist> GetMediaPlaylist(const ov::String &variant_name);
 	std::shared_ptr<HlsMasterPlaylist> GetMasterPlaylist(const ov::String &playlist_name);
@@ -97,10 +97,10 @@ private:
 	// default querystring value
 	bool _default_option_rewind = true;
 
-	// packetizer id : Packetizer
-	std::map<ov::String, std::shared_ptr<mpegts::Packetizer>> _packetizers;
+	// packetizer id : Packetizer (can be shared with the other publishers)
+	std::map<ov::String, std::shared_ptr<mpegts::PacketizerSubscription>> _packetizers;
 	// All packetizers for each track
-	std::map<uint32_t, std::vector<std::shared_ptr<mpegts::Packetizer>>> _track_packetizers;
+	std::map<uint32_t, std::vector<std::shared_ptr<mpegts::PacketizerSubscription>>> _track_packetizers;
 	std::shared_mutex _packetizers_guard;
 
 	std::map<ov::String, std::shared_ptr<mpegts::Packager>> _packagers;
@@ -10,7 +10,6 @@
 #include "llhls_chunklist.h"
 #include "llhls_private.h"
 #include <base/ovcrypto/base_64.h>
-#include <base/ovlibrary/zip.h>
 
 LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, 
 							uint32_t segment_count, uint32_t target_duration, double part_target_duration, 
@@ -57,7 +56,7 @@ void LLHlsChunklist::SetEndList()
 {
 	_end_list = true;
 
-	UpdateCacheForDefaultChunklist();
+	InvalidatePlaylistCache(true);
 }
 
 void LLHlsChunklist::SaveOldSegmentInfo(bool enable)
@@ -95,6 +94,9 @@ bool LLHlsChunklist::CreateSegmentInfo(const SegmentInfo &info)
 	// Create segment
 	auto segment = std::make_shared<SegmentInfo>(info);
 	_segments.emplace(segment->GetSequence(), segment);
+	lock.unlock();
+
+	InvalidatePlaylistCache(false);
 
 	return true;
 }
@@ -126,7 +128,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 
 	segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
 
-	UpdateCacheForDefaultChunklist();
+	InvalidatePlaylistCache(true);
 
 	return true;
 }
@@ -152,25 +154,131 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 	SaveOldSegmentInfo(old_segment);
 
 	_segments.erase(segment_sequence);
+	lock.unlock();
+
+	InvalidatePlaylistCache(false);
 
 	return true;
 }
 
-void LLHlsChunklist::UpdateCacheForDefaultChunklist()
+void LLHlsChunklist::InvalidatePlaylistCache(bool render_default_playlist)
+{
+	// The default playlist is rendered under the lock, so an older rendering of a concurrent update can't replace it
+	std::lock_guard<std::mutex> lock(_cached_playlists_guard);
+
+	_cached_playlists.fill(nullptr);
+
+	if (render_default_playlist)
+	{
+		// no skip, no legacy, all segments
+		auto rendered = RenderPlaylist(false, false, true);
+
+		if (rendered != nullptr)
+		{
+			auto default_playlist = std::make_shared<CachedPlaylist>();
+			default_playlist->msn = _last_segment_sequence;
+			default_playlist->part = _last_partial_segment_sequence;
+			default_playlist->rendered = rendered;
+			default_playlist->gzip_data = ov::Zip::CompressGzip(rendered->data);
+
+			_cached_playlists[GetPlaylistCacheIndex(false, false, true)] = default_playlist;
+		}
+	}
+}
+
+std::shared_ptr<LLHlsChunklist::CachedPlaylist> LLHlsChunklist::GetCachedPlaylist(bool skip, bool legacy, bool rewind) const
+{
+	std::lock_guard<std::mutex> lock(_cached_playlists_guard);
+
+	int64_t msn = _last_segment_sequence;
+	int64_t part = _last_partial_segment_sequence;
+
+	auto &cached_playlist = _cached_playlists[GetPlaylistCacheIndex(skip, legacy, rewind)];
+	if ((cached_playlist == nullptr) || (cached_playlist->msn != msn) || (cached_playlist->part != part))
+	{
+		// A playlist rendered before the chunklist advanced must not be served for the new MSN/part
+		cached_playlist = std::make_shared<CachedPlaylist>();
+		cached_playlist->msn = msn;
+		cached_playlist->part = part;
+	}
+
+	return cached_playlist;
+}
+
+std::shared_ptr<const LLHlsChunklist::RenderedPlaylist> LLHlsChunklist::RenderPlaylist(bool skip, bool legacy, bool rewind) const
+{
+	auto rendered = std::make_shared<RenderedPlaylist>();
+
+	auto data = MakeChunklist("", skip, legacy, rewind, false, 0, &rendered->query_string_offsets).ToData(false);
+	if (data->GetLength() == 0)
+	{
+		// Not ready yet - do not cache the empty playlist
+		return nullptr;
+	}
+
+	rendered->data = data;
+
+	return rendered;
+}
+
+std::shared_ptr<const LLHlsChunklist::RenderedPlaylist> LLHlsChunklist::GetRenderedPlaylist(CachedPlaylist &cached_playlist, bool skip, bool legacy, bool rewind) const
+{
+	std::lock_guard<std::mutex> lock(cached_playlist.mutex);
+
+	if (cached_playlist.rendered == nullptr)
+	{
+		cached_playlist.rendered = RenderPlaylist(skip, legacy, rewind);
+	}
+
+	return cached_playlist.rendered;
+}
+
+std::shared_ptr<const ov::Data> LLHlsChunklist::InsertQueryString(const RenderedPlaylist &rendered, const ov::String &query_string)
 {
-	// no query string, no skip, no legacy, all segments
-	ov::String chunklist = MakeChunklist("", false, false, true);
+	if (query_string.IsEmpty() || rendered.query_string_offsets.empty())
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		return rendered.data;
 	}
 
+	auto source = rendered.data->GetDataAs<uint8_t>();
+	auto source_length = rendered.data->GetLength();
+
+	auto data = std::make_shared<ov::Data>(source_length + (rendered.query_string_offsets.size() * (query_string.GetLength() + 1)));
+	size_t position = 0;
+
+	for (auto offset : rendered.query_string_offsets)
+	{
+		data->Append(source + position, offset - position);
+		data->Append("?", 1);
+		data->Append(query_string.CStr(), query_string.GetLength());
+
+		position = offset;
+	}
+
+	data->Append(source + position, source_length - position);
+
+	return data;
+}
+
+std::shared_ptr<const std::vector<ov::Zip::DeflatePiece>> LLHlsChunklist::CompressPieces(const RenderedPlaylist &rendered)
+{
+	auto source = rendered.data->GetDataAs<uint8_t>();
+	auto source_length = rendered.data->GetLength();
+
+	auto pieces = std::make_shared<std::vector<ov::Zip::DeflatePiece>>();
+	pieces->reserve(rendered.query_string_offsets.size() + 1);
+
+	size_t position = 0;
+
+	for (auto offset : rendered.query_string_offsets)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		pieces->push_back(ov::Zip::CompressDeflatePiece(source + position, offset - position));
+		position = offset;
 	}
+
+	pieces->push_back(ov::Zip::CompressDeflatePiece(source + position, source_length - position));
+
+	return pieces;
 }
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
@@ -276,7 +384,62 @@ ov::String LLHlsChunklist::MakeExtXKey() const
 	return xkey;
 }
 
-ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number) const
+static void AppendQueryString(ov::String &playlist, const ov::String &query_string, std::vector<size_t> *query_string_offsets)
+{
+	if (query_string_offsets != nullptr)
+	{
+		query_string_offsets->push_back(playlist.GetLength());
+	}
+
+	if (query_string.IsEmpty() == false)
+	{
+		playlist.AppendFormat("?%s", query_string.CStr());
+	}
+}
+
+uint32_t LLHlsChunklist::GetSkippableSegmentCount(const std::shared_ptr<SegmentInfo> &first_segment) const
+{
+	auto first = _segments.find(first_segment->GetSequence());
+	if (first == _segments.end())
+	{
+		return 0;
+	}
+
+	// The duration of the last segment is the sum of its partial segments while it is being made
+	double playlist_duration = 0.0;
+	for (auto it = first; it != _segments.end(); it++)
+	{
+		playlist_duration += it->second->GetDuration();
+	}
+
+	auto last_sequence = _segments.rbegin()->first;
+
+	// Segments that end at least CAN-SKIP-UNTIL before the end of the playlist can be skipped
+	uint32_t skippable_count = 0;
+	double end_time = 0.0;
+	for (auto it = first; it != _segments.end(); it++)
+	{
+		auto &segment = it->second;
+
+		// Segments with partial segments are never skipped
+		if ((segment->IsCompleted() == false) || (segment->GetPartialSegmentsCount() == 0) || (segment->GetSequence() > last_sequence - 3))
+		{
+			break;
+		}
+
+		end_time += segment->GetDuration();
+		if (playlist_duration - end_time < GetSkipBoundary())
+		{
+			break;
+		}
+
+		skippable_count++;
+	}
+
+	return skippable_count;
+}
+
+ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod, uint32_t vod_start_segment_number, std::vector<size_t> *query_string_offsets) const
 {
 	std::shared_lock<std::shared_mutex> segment_lock(_segments_guard);
 	uint8_t version = 6;
@@ -296,7 +459,11 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		legacy = true;
 	}
 
-	// TODO(Getroot) : Implement _HLS_skip=YES (skip = true)
+	if (legacy == true)
+	{
+		// Delta updates are only for Low-Latency HLS live playlists
+		skip = false;
+	}
 
 	ov::String playlist(20480);
 
@@ -311,27 +478,6 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 	{
 		version = 6;
 	}
-	playlist.AppendFormat("#EXT-X-VERSION:%d\n", version);
-	// Note that in protocol version 6, the semantics of the EXT-
-	// X-TARGETDURATION tag changed slightly.  In protocol version 5 and
-	// earlier it indicated the maximum segment duration; in protocol
-	// version 6 and later it indicates the the maximum segment duration
-	// rounded to the nearest integer number of seconds.
-	auto target_duration = static_cast<uint32_t>(std::round(_target_duration));
-	playlist.AppendFormat("#EXT-X-TARGETDURATION:%u\n", target_duration);
-
-	// Low Latency Mode
-	if (legacy == false)
-	{
-		// X-SERVER-CONTROL
-		playlist.AppendFormat("#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=%f\n", _part_hold_back);
-		playlist.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", _part_target_duration);
-	}
-	else
-	{
-		// X-PLAYLIST-TYPE
-		// playlist.AppendFormat("#EXT-X-SERVER-CONTROL:HOLD-BACK=%u\n", target_duration * 3);
-	}
 
 	std::shared_ptr<LLHlsChunklist::SegmentInfo> first_segment = nullptr;
 	auto last_segment = _segments.rbegin()->second;
@@ -374,12 +520,43 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		first_segment = it->second;
 	}
 
-	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? first_segment->GetSequence() : 0);
-	playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
-	if (query_string.IsEmpty() == false)
+	uint32_t skipped_segment_count = (skip == true) ? GetSkippableSegmentCount(first_segment) : 0;
+	if (skipped_segment_count > 0)
 	{
-		playlist.AppendFormat("?%s", query_string.CStr());
+		// EXT-X-SKIP requires protocol version 9
+		version = 9;
+	}
+
+	playlist.AppendFormat("#EXT-X-VERSION:%d\n", version);
+	// Note that in protocol version 6, the semantics of the EXT-
+	// X-TARGETDURATION tag changed slightly.  In protocol version 5 and
+	// earlier it indicated the maximum segment duration; in protocol
+	// version 6 and later it indicates the the maximum segment duration
+	// rounded to the nearest integer number of seconds.
+	auto target_duration = static_cast<uint32_t>(std::round(_target_duration));
+	playlist.AppendFormat("#EXT-X-TARGETDURATION:%u\n", target_duration);
+
+	// Low Latency Mode
+	if (legacy == false)
+	{
+		// X-SERVER-CONTROL
+		playlist.AppendFormat("#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=%f", _part_hold_back);
+		if (vod == false)
+		{
+			playlist.AppendFormat(",CAN-SKIP-UNTIL=%lf", GetSkipBoundary());
+		}
+		playlist.Append("\n");
+		playlist.AppendFormat("#EXT-X-PART-INF:PART-TARGET=%lf\n", _part_target_duration);
+	}
+	else
+	{
+		// X-PLAYLIST-TYPE
+		// playlist.AppendFormat("#EXT-X-SERVER-CONTROL:HOLD-BACK=%u\n", target_duration * 3);
 	}
+
+	playlist.AppendFormat("#EXT-X-MEDIA-SEQUENCE:%u\n", vod == false ? first_segment->GetSequence() : 0);
+	playlist.AppendFormat("#EXT-X-MAP:URI=\"%s", _map_uri.CStr());
+	AppendQueryString(playlist, query_string, query_string_offsets);
 	playlist.AppendFormat("\"\n");
 
 	// CENC
@@ -388,6 +565,11 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		playlist.AppendFormat("%s\n", MakeExtXKey().CStr());
 	}
 
+	if (skipped_segment_count > 0)
+	{
+		playlist.AppendFormat("#EXT-X-SKIP:SKIPPED-SEGMENTS=%u\n", skipped_segment_count);
+	}
+
 	if (vod == true)
 	{
 		for (auto &[number, segment] : _old_segments)
@@ -401,16 +583,13 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			playlist.AppendFormat("#EXT-X-PROGRAM-DATE-TIME:%s\n", ov::Converter::ToISO8601String(tp).CStr());
 			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
 			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			AppendQueryString(playlist, query_string, query_string_offsets);
 			playlist.Append("\n");
 		}
 	}
 
-	// from first_segment to last_segment
-	for (auto it = _segments.find(first_segment->GetSequence()) ; it != _segments.end(); it ++)
+	// from first_segment to last_segment (after the skipped segments)
+	for (auto it = std::next(_segments.find(first_segment->GetSequence()), skipped_segment_count); it != _segments.end(); it++)
 	{
 		auto number = it->first;
 		auto segment = it->second;
@@ -444,10 +623,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 				{
 					playlist.AppendFormat("#EXT-X-PART:DURATION=%lf,URI=\"%s",
 										partial_segment->GetDuration(), partial_segment->GetUrl().CStr());
-					if (query_string.IsEmpty() == false)
-					{
-						playlist.AppendFormat("?%s", query_string.CStr());
-					}
+					AppendQueryString(playlist, query_string, query_string_offsets);
 					playlist.AppendFormat("\"");
 					if (_track->GetMediaType() == cmn::MediaType::Audio || (_track->GetMediaType() == cmn::MediaType::Video && partial_segment->IsIndependent() == true))
 					{
@@ -462,10 +638,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 						partial_segment == segment->GetPartialSegments().back())
 					{
 						playlist.AppendFormat("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"%s", partial_segment->GetNextUrl().CStr());
-						if (query_string.IsEmpty() == false)
-						{
-							playlist.AppendFormat("?%s", query_string.CStr());
-						}
+						AppendQueryString(playlist, query_string, query_string_offsets);
 						playlist.AppendFormat("\"\n");
 					}
 				}
@@ -479,10 +652,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 		{
 			playlist.AppendFormat("#EXTINF:%lf,\n", segment->GetDuration());
 			playlist.AppendFormat("%s", segment->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			AppendQueryString(playlist, query_string, query_string_offsets);
 			playlist.Append("\n");
 		}
 	}
@@ -509,10 +679,7 @@ ov::String LLHlsChunklist::MakeChunklist(const ov::String &query_string, bool sk
 			}
 
 			playlist.AppendFormat("#EXT-X-RENDITION-REPORT:URI=\"%s", rendition->GetUrl().CStr());
-			if (query_string.IsEmpty() == false)
-			{
-				playlist.AppendFormat("?%s", query_string.CStr());
-			}
+			AppendQueryString(playlist, query_string, query_string_offsets);
 			playlist.AppendFormat("\"");
 
 			// LAST-MSN, LAST-PART
@@ -555,23 +722,79 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if (vod == false && vod_start_segment_number == 0)
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		auto data = ToData(query_string, skip, legacy, rewind);
+		return ov::String(data->GetDataAs<char>(), data->GetLength());
 	}
 
 	return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
 }
 
+std::shared_ptr<const ov::Data> LLHlsChunklist::ToData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
+{
+	auto cached_playlist = GetCachedPlaylist(skip, legacy, rewind);
+
+	auto rendered = GetRenderedPlaylist(*cached_playlist, skip, legacy, rewind);
+	if (rendered == nullptr)
+	{
+		return std::make_shared<ov::Data>();
+	}
+
+	return InsertQueryString(*rendered, query_string);
+}
+
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr && rewind == true)
+	auto cached_playlist = GetCachedPlaylist(skip, legacy, rewind);
+
+	auto rendered = GetRenderedPlaylist(*cached_playlist, skip, legacy, rewind);
+	if (rendered == nullptr)
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		return ov::Zip::CompressGzip(std::make_shared<ov::Data>());
+	}
+
+	if (query_string.IsEmpty() || rendered->query_string_offsets.empty())
+	{
+		std::lock_guard<std::mutex> lock(cached_playlist->mutex);
+
+		if (cached_playlist->gzip_data == nullptr)
+		{
+			cached_playlist->gzip_data = ov::Zip::CompressGzip(rendered->data);
+		}
+
+		return cached_playlist->gzip_data;
+	}
+
+	std::shared_ptr<const std::vector<ov::Zip::DeflatePiece>> gzip_pieces;
+	{
+		std::lock_guard<std::mutex> lock(cached_playlist->mutex);
+
+		if (cached_playlist->gzip_pieces == nullptr)
+		{
+			cached_playlist->gzip_pieces = CompressPieces(*rendered);
+		}
+
+		gzip_pieces = cached_playlist->gzip_pieces;
+	}
+
+	// Only the query string is compressed for each request, and it is spliced between the cached pieces
+	ov::String insert = "?";
+	insert.Append(query_string);
+	auto insert_piece = ov::Zip::CompressDeflatePiece(insert.CStr(), insert.GetLength());
+
+	std::vector<const ov::Zip::DeflatePiece *> pieces;
+	pieces.reserve((gzip_pieces->size() * 2) - 1);
+
+	for (size_t index = 0; index < gzip_pieces->size(); index++)
+	{
+		if (index > 0)
+		{
+			pieces.push_back(&insert_piece);
+		}
+
+		pieces.push_back(&gzip_pieces->at(index));
 	}
 
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy, rewind).ToData(false));
+	return ov::Zip::JoinGzip(pieces);
 }
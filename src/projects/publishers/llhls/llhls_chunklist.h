@@ -9,6 +9,7 @@
 #pragma once
 
 #include <base/ovlibrary/ovlibrary.h>
+#include <base/ovlibrary/zip.h>
 #include <base/info/media_track.h>
 #include <base/mediarouter/media_buffer.h>
 #include <modules/marker/marker_box.h>
@@ -236,6 +237,10 @@ public:
 	bool RemoveSegmentInfo(uint32_t segment_sequence);
 
 	ov::String ToString(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// Returns the playlist rendered for the current MSN/part.
+	// The playlist is rendered once per update without the query string and shared by all requests with the same parameters
+	// (including the blocked requests that are released by the update). The query string of the request is inserted when it is served.
+	std::shared_ptr<const ov::Data> ToData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const;
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const;
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
@@ -244,11 +249,37 @@ public:
 	void SetEndList();
 
 private:
+	// Playlist rendered without the query string
+	struct RenderedPlaylist
+	{
+		std::shared_ptr<const ov::Data> data;
+		// Offsets in data where "?<query string>" of the request is inserted (after each URI)
+		std::vector<size_t> query_string_offsets;
+	};
+
+	struct CachedPlaylist
+	{
+		// MSN/part of the chunklist when this entry was created
+		int64_t msn = -1;
+		int64_t part = -1;
+
+		// Locked while rendering, so the requests waiting for the same playlist use the result of the first request
+		std::mutex mutex;
+
+		std::shared_ptr<const RenderedPlaylist> rendered;
+		// Only for the requests without the query string
+		std::shared_ptr<const ov::Data> gzip_data;
+		// The rendered playlist split at query_string_offsets and compressed piece by piece,
+		// so only the query string is compressed for each request
+		std::shared_ptr<const std::vector<ov::Zip::DeflatePiece>> gzip_pieces;
+	};
+
 	std::shared_ptr<SegmentInfo> GetLastSegmentInfo() const;
 
 	bool SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info);
 
-	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// If query_string_offsets is not nullptr, the offsets where the query string is appended are stored
+	ov::String MakeChunklist(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0, std::vector<size_t> *query_string_offsets = nullptr) const;
 
 	ov::String MakeExtXKey() const;
 
@@ -284,15 +315,33 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
-
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
+	// Rendered playlists for the current MSN/part - cleared whenever the chunklist advances,
+	// and an entry created for another MSN/part is replaced when it is looked up
+	// Indexed by GetPlaylistCacheIndex(skip, legacy, rewind)
+	mutable std::array<std::shared_ptr<CachedPlaylist>, 8> _cached_playlists;
+	mutable std::mutex _cached_playlists_guard;
 
 	bmff::CencProperty _cenc_property;
 
 	bool _end_list = false;
 
-	void UpdateCacheForDefaultChunklist();
+	static size_t GetPlaylistCacheIndex(bool skip, bool legacy, bool rewind)
+	{
+		return (skip ? 1 : 0) | (legacy ? 2 : 0) | (rewind ? 4 : 0);
+	}
+	std::shared_ptr<CachedPlaylist> GetCachedPlaylist(bool skip, bool legacy, bool rewind) const;
+	// Renders the playlist into the cache if it is not rendered yet. Returns nullptr if the playlist is not ready.
+	std::shared_ptr<const RenderedPlaylist> GetRenderedPlaylist(CachedPlaylist &cached_playlist, bool skip, bool legacy, bool rewind) const;
+	std::shared_ptr<const RenderedPlaylist> RenderPlaylist(bool skip, bool legacy, bool rewind) const;
+	static std::shared_ptr<const ov::Data> InsertQueryString(const RenderedPlaylist &rendered, const ov::String &query_string);
+	static std::shared_ptr<const std::vector<ov::Zip::DeflatePiece>> CompressPieces(const RenderedPlaylist &rendered);
+	// Number of the segments from first_segment that can be replaced with EXT-X-SKIP (_segments_guard must be locked)
+	uint32_t GetSkippableSegmentCount(const std::shared_ptr<SegmentInfo> &first_segment) const;
+	double GetSkipBoundary() const
+	{
+		// CAN-SKIP-UNTIL must be at least six times the target duration
+		return _target_duration * 6.0;
+	}
+	// Evict the cached playlists, and render the default playlist (no query string, no skip, low-latency, all segments) in advance if needed
+	void InvalidatePlaylistCache(bool render_default_playlist);
 };
\ No newline at end of file
@@ -15,6 +15,15 @@
 class LLHlsHttpInterceptor : public http::svr::DefaultInterceptor
 {
 protected:
+	std::vector<http::svr::InterceptorRoute> GetRoutes() const override
+	{
+		auto method = http::Method::Get | http::Method::Head | http::Method::Options;
+
+		return {
+			{method, ".m3u8"},
+			{method, "_llhls.m4s"}};
+	}
+
 	bool IsInterceptorForRequest(const std::shared_ptr<const http::svr::HttpExchange> &exchange) override
 	{
 		auto request = exchange->GetRequest();
@@ -592,9 +592,6 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
 	{
 		// Hold
-		//TODO(Getroot): EXT-X-SKIP is under debugging
-
-		skip = false;
 		AddPendingRequest(exchange, RequestType::Chunklist, file_name, track_id, msn, part, skip, legacy, rewind);
 		return ;
 	}
@@ -704,7 +701,19 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		if (segment->IsFileBacked())
+		{
+			// The DVR segment is sent from the file using sendfile() without loading it into the memory
+			response->AppendFileRange(segment->GetFileRange());
+		}
+		else
+		{
+			// The chunks are sent using scatter-gather I/O without merging them
+			for (const auto &data : segment->GetDataList())
+			{
+				response->AppendData(data);
+			}
+		}
 	}
 	else
 	{
@@ -857,7 +857,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const ov::Data>> LLHlsStr
 		return {RequestResult::Success, chunklist->ToGzipData(query_string, skip, legacy, rewind)};
 	}
 
-	return {RequestResult::Success, chunklist->ToString(query_string, skip, legacy, rewind).ToData(false)};
+	return {RequestResult::Success, chunklist->ToData(query_string, skip, legacy, rewind)};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetInitializationSegment(const int32_t &track_id) const
@@ -872,7 +872,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, storage->GetInitializationSection()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
+std::tuple<LLHlsStream::RequestResult, std::shared_ptr<const bmff::FMP4Segment>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
 {
 	auto storage = GetStorage(track_id);
 	if (storage == nullptr)
@@ -888,7 +888,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 		return {RequestResult::NotFound, nullptr};
 	}
 
-	return {RequestResult::Success, segment->GetData()};
+	return {RequestResult::Success, segment};
 }
 
 std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
@@ -83,11 +83,8 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
-	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
-	copy_packet->SetSessionId(GetId());
-
-	_connector->Send(copy_packet->GetData());
+	// The packet is shared by all sessions, so only the header is made for this session (with OVT Session ID)
+	_connector->Send({session_packet->MakeHeader(GetId()), session_packet->GetPayloadData()});
 }
 
 const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
@@ -36,13 +36,12 @@ namespace pub
 		  _playlist_info(playlist_info),
 		  _sink(sink)
 	{
-		_packetizer = std::make_shared<mpegts::Packetizer>();
 	}
 
 	void SrtPlaylist::AddTrack(const std::shared_ptr<MediaTrack> &track)
 	{
 		// Duplicated tracks will be ignored by the packetizer
-		_packetizer->AddTrack(track);
+		_tracks.push_back(track);
 
 		_track_info_map.emplace(track->GetId(), track);
 	}
@@ -54,14 +53,16 @@ namespace pub
 
 	bool SrtPlaylist::Start()
 	{
-		_packetizer->AddSink(GetSharedPtrAs<mpegts::PacketizerSink>());
+		_packetizer = mpegts::PacketizerService::GetInstance()->Subscribe(*_stream_info, _tracks, GetSharedPtrAs<mpegts::PacketizerSink>());
 
-		return _packetizer->Start();
+		return _packetizer != nullptr;
 	}
 
 	bool SrtPlaylist::Stop()
 	{
-		return _packetizer->Stop();
+		_packetizer = nullptr;
+
+		return true;
 	}
 
 	void SrtPlaylist::EnqueuePacket(const std::shared_ptr<MediaPacket> &media_packet)
@@ -82,70 +83,59 @@ namespace pub
 			track_info.first_key_frame_received = media_packet->IsKeyFrame();
 		}
 
-		if (track_info.first_key_frame_received)
+		if (track_info.first_key_frame_received && (_packetizer != nullptr))
 		{
 			_packetizer->AppendFrame(media_packet);
 		}
 	}
 
-	void SrtPlaylist::SendData(const std::vector<std::shared_ptr<mpegts::Packet>> &packets)
+	void SrtPlaylist::SendData(const std::shared_ptr<const ov::Data> &data)
 	{
-		if (_sink == nullptr)
+		if ((_sink == nullptr) || (data == nullptr))
 		{
 			return;
 		}
 
 		auto self = GetSharedPtrAs<SrtPlaylist>();
 
-		for (auto &packet : packets)
+		auto buffer = data->GetDataAs<uint8_t>();
+		auto remained = data->GetLength();
+
+		// SRT_LIVE_DEF_PLSIZE is a multiple of TS packet size (7 * 188), so the TS packets are not split
+		while (remained > 0)
 		{
 			auto size = _data_to_send->GetLength();
-			const auto &data = packet->GetData();
 
 			// Broadcast if the data size exceeds the SRT's payload length
-			if ((size + data->GetLength()) > SRT_LIVE_DEF_PLSIZE)
+			if (size >= SRT_LIVE_DEF_PLSIZE)
 			{
 				_sink->OnSrtPlaylistData(self, _data_to_send);
-				_data_to_send = data->Clone();
-			}
-			else
-			{
-				_data_to_send->Append(packet->GetData());
+				_data_to_send = std::make_shared<ov::Data>(SRT_LIVE_DEF_PLSIZE);
+				size = 0;
 			}
-		}
-	}
 
-	void SrtPlaylist::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets)
-	{
-		std::shared_ptr<ov::Data> psi_data = std::make_shared<ov::Data>();
+			auto bytes_to_append = std::min<size_t>(SRT_LIVE_DEF_PLSIZE - size, remained);
 
-		// Concatenate PSI packets
-		for (const auto &packet : psi_packets)
-		{
-			psi_data->Append(packet->GetData());
+			_data_to_send->Append(buffer, bytes_to_append);
+
+			buffer += bytes_to_append;
+			remained -= bytes_to_append;
 		}
+	}
 
-		logap("OnPsi - %zu packets (total %zu bytes)", psi_packets.size(), psi_data->GetLength());
+	void SrtPlaylist::OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data)
+	{
+		logap("OnPsi - %zu bytes", psi_data->GetLength());
 
-		_psi_data = std::move(psi_data);
+		_psi_data = psi_data;
 
-		SendData(psi_packets);
+		SendData(psi_data);
 	}
 
-	void SrtPlaylist::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets)
+	void SrtPlaylist::OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data)
 	{
-#if DEBUG
-		// Since adding up the total packet size is costly, it is calculated only in debug mode
-		size_t total_packet_size = 0;
-
-		for (const auto &packet : pes_packets)
-		{
-			total_packet_size += packet->GetData()->GetLength();
-		}
-
-		logap("OnFrame - %zu packets (total %zu bytes)", pes_packets.size(), total_packet_size);
-#endif	// DEBUG
+		logap("OnFrame - %zu packets (total %zu bytes)", frame_data->GetLength() / mpegts::MPEGTS_MIN_PACKET_SIZE, frame_data->GetLength());
 
-		SendData(pes_packets);
+		SendData(frame_data);
 	}
 }  // namespace pub
@@ -13,7 +13,7 @@
 #include <base/info/stream.h>
 #include <base/mediarouter/media_buffer.h>
 #include <base/ovlibrary/ovlibrary.h>
-#include <modules/containers/mpegts/mpegts_packetizer.h>
+#include <modules/containers/mpegts/mpegts_packetizer_service.h>
 
 namespace pub
 {
@@ -66,11 +66,11 @@ namespace pub
 		//--------------------------------------------------------------------
 		// Implementation of mpegts::PacketizerSink
 		//--------------------------------------------------------------------
-		// Do not need to lock _packetizer_mutex inside OnPsi() because it will be called only once when the packetizer starts
-		void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::vector<std::shared_ptr<mpegts::Packet>> &psi_packets) override;
+		// Do not need to lock _packetizer_mutex inside OnPsi() because it will be called only once when the playlist subscribes the packetizer
+		void OnPsi(const std::vector<std::shared_ptr<const MediaTrack>> &tracks, const std::shared_ptr<const ov::Data> &psi_data) override;
 		// Do not need to lock _packetizer_mutex inside OnFrame() because it's called after acquiring the lock in EnqueuePacket()
 		// (It's called in the thread that calls EnqueuePacket())
-		void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::vector<std::shared_ptr<mpegts::Packet>> &pes_packets) override;
+		void OnFrame(const std::shared_ptr<const MediaPacket> &media_packet, const std::shared_ptr<const ov::Data> &frame_data) override;
 		//--------------------------------------------------------------------
 
 		const std::shared_ptr<const ov::Data> &GetPsiData() const
@@ -92,15 +92,18 @@ namespace pub
 		};
 
 	private:
-		void SendData(const std::vector<std::shared_ptr<mpegts::Packet>> &packets);
+		// Split the TS packets by SRT_LIVE_DEF_PLSIZE
+		void SendData(const std::shared_ptr<const ov::Data> &data);
 
 	private:
 		std::shared_ptr<const info::Stream> _stream_info;
 		std::shared_ptr<const info::Playlist> _playlist_info;
 
 		std::unordered_map<int32_t, TrackInfo> _track_info_map;
+		std::vector<std::shared_ptr<const MediaTrack>> _tracks;
 
-		std::shared_ptr<mpegts::Packetizer> _packetizer;
+		// The packetizer can be shared with the other publishers (such as HLS)
+		std::shared_ptr<mpegts::PacketizerSubscription> _packetizer;
 
 		std::shared_ptr<SrtPlaylistSink> _sink;
 
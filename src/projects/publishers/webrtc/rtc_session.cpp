@@ -603,7 +603,19 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 	}
 
 	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+	// The payload of the original packet is shared by all sessions, so it is copied into the buffer of this session
+	// which is reused for every packet instead of allocating a new RtpPacket per packet and per session.
+	if (_outgoing_rtp_packet == nullptr)
+	{
+		_outgoing_rtp_packet = std::make_shared<RtpPacket>();
+	}
+
+	if (_outgoing_rtp_packet->CopyFrom(*session_packet) == false)
+	{
+		return;
+	}
+
+	auto &copy_packet = _outgoing_rtp_packet;
 
 	if (copy_packet->IsVideoPacket())
 	{
@@ -161,6 +161,9 @@ private:
 	uint16_t _audio_rtp_sequence_number = 0;
 	uint16_t _wide_sequence_number = 0;
 
+	// Reused for every outgoing RTP packet of this session (SendOutgoingData is called from one StreamWorker)
+	std::shared_ptr<RtpPacket> _outgoing_rtp_packet;
+
 	bool _video_enabled = true;
 	bool _audio_enabled = true;
 
@@ -23,17 +23,13 @@ public:
 		return AV_CODEC_ID_AAC;
 	}
 
-	std::shared_ptr<const MediaPacket> _cur_pkt = nullptr;
-	size_t _pkt_offset = 0;
-	std::shared_ptr<const ov::Data> _cur_data = nullptr;
-
 	int64_t _first_pkt_pts = INT64_MIN;
 	int64_t _last_pkt_pts = INT64_MIN;
 	int64_t _last_pkt_duration = 0;
 
-	bool InitCodec();
+	bool InitCodec() override;
 
-	void CodecThread() override;
+	void DecodePacket(std::shared_ptr<const MediaPacket> buffer) override;
 
 protected:
 };
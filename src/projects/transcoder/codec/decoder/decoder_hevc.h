@@ -24,9 +24,9 @@ public:
         return AV_CODEC_ID_H265;
     }
 
-	bool InitCodec();
+	bool InitCodec() override;
 	void UninitCodec();
 	bool ReinitCodecIfNeed();
 
-    void CodecThread() override;
+    void DecodePacket(std::shared_ptr<const MediaPacket> buffer) override;
 };
@@ -23,7 +23,7 @@ public:
 		return AV_CODEC_ID_HEVC;
 	}
 
-	bool InitCodec();
+	bool InitCodec() override;
 
-	void CodecThread() override;
+	void DecodePacket(std::shared_ptr<const MediaPacket> buffer) override;
 };
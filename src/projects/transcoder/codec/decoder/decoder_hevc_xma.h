@@ -24,11 +24,11 @@ public:
 		return AV_CODEC_ID_H265;
 	}
 
-	bool InitCodec();
+	bool InitCodec() override;
 	void UninitCodec();
 	bool ReinitCodecIfNeed();
 
-	void CodecThread() override;
+	void DecodePacket(std::shared_ptr<const MediaPacket> buffer) override;
 
 private:
 	[[maybe_unused]]
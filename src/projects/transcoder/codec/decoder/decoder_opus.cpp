@@ -46,138 +46,102 @@ bool DecoderOPUS::InitCodec()
 	return true;
 }
 
-void DecoderOPUS::CodecThread()
+void DecoderOPUS::DecodePacket(std::shared_ptr<const MediaPacket> buffer)
 {
-	// Initialize the codec and notify the main thread.
-	if(_codec_init_event.Submit(InitCodec()) == false)
+	auto packet_data = buffer->GetData();
+	if ((packet_data == nullptr) || (packet_data->GetLength() == 0))
 	{
 		return;
 	}
-	
-	bool no_data_to_encode = false;
 
-	while (!_kill_flag)
+	size_t offset = 0;
+
+	while ((offset < packet_data->GetLength()) && !_kill_flag)
 	{
 		/////////////////////////////////////////////////////////////////////
 		// Sending a packet to decoder
 		/////////////////////////////////////////////////////////////////////
-		if (_cur_pkt == nullptr && (_input_buffer.IsEmpty() == false || no_data_to_encode == true))
+		_pkt->size = 0;
+
+		int32_t parsed_size = ::av_parser_parse2(
+			_parser,
+			_context,
+			&_pkt->data, &_pkt->size,
+			packet_data->GetDataAs<uint8_t>() + offset,
+			static_cast<int32_t>(packet_data->GetLength() - offset),
+			buffer->GetPts(), buffer->GetPts(),
+			0);
+
+		// Failed to parsing
+		if (parsed_size <= 0)
+		{
+			logte("Error while parsing\n");
+			break;
+		}
+
+		OV_ASSERT(packet_data->GetLength() >= (size_t)parsed_size, "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", packet_data->GetLength(), parsed_size);
+		offset += parsed_size;
+
+		if (_pkt->size > 0)
 		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
+			_pkt->pts = _parser->pts;
+			_pkt->dts = _parser->dts;
+			_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
+			if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
 			{
-				continue;
+				_pkt->duration = _pkt->pts - _parser->last_pts;
 			}
-
-			no_data_to_encode = false;
-			_cur_pkt = std::move(obj.value());
-			if (_cur_pkt != nullptr)
+			else
 			{
-				_cur_data = _cur_pkt->GetData();
-				_pkt_offset = 0;
+				_pkt->duration = 0;
 			}
 
-			if ((_cur_data == nullptr) || (_cur_data->GetLength() == 0))
+			int ret = ::avcodec_send_packet(_context, _pkt);
+			if (ret == AVERROR(EAGAIN))
 			{
-				continue;
 			}
-		}
-
-		if (_cur_data != nullptr)
-		{
-			if (_pkt_offset < _cur_data->GetLength())
+			else if (ret == AVERROR_EOF)
 			{
-				_pkt->size = 0;
-
-				int32_t parsed_size = ::av_parser_parse2(
-					_parser,
-					_context,
-					&_pkt->data, &_pkt->size,
-					_cur_data->GetDataAs<uint8_t>() + _pkt_offset,
-					static_cast<int32_t>(_cur_data->GetLength() - _pkt_offset),
-					_cur_pkt->GetPts(), _cur_pkt->GetPts(),
-					0);
-
-				// Failed to parsing
-				if (parsed_size <= 0)
-				{
-					logte("Error while parsing\n");
-					_cur_data = nullptr;
-				}
-				else
-				{
-					OV_ASSERT(_cur_data->GetLength() >= (size_t)parsed_size, "Current data size MUST greater than parsed_size, but data size: %ld, parsed_size: %ld", _cur_data->GetLength(), parsed_size);
-					_pkt_offset += parsed_size;
-				}
-
-				if (_pkt->size > 0)
-				{
-					_pkt->pts = _parser->pts;
-					_pkt->dts = _parser->dts;
-					_pkt->flags = (_parser->key_frame == 1) ? AV_PKT_FLAG_KEY : 0;
-					if (_pkt->pts != AV_NOPTS_VALUE && _parser->last_pts != AV_NOPTS_VALUE)
-					{
-						_pkt->duration = _pkt->pts - _parser->last_pts;
-					}
-					else
-					{
-						_pkt->duration = 0;
-					}
-
-					int ret = ::avcodec_send_packet(_context, _pkt);
-					if (ret == AVERROR(EAGAIN))
-					{
-					}
-					else if (ret == AVERROR_EOF)
-					{
-						logte("Error sending a packet for decoding : AVERROR_EOF");
-					}
-					else if (ret < 0)
-					{
-						_cur_data = nullptr;
-						char err_msg[1024];
-						av_strerror(ret, err_msg, sizeof(err_msg));
-						logte("An error occurred while sending a packet for decoding. %s ", err_msg);
-					}
-
-					// Save first pakcet's PTS
-					if(_first_pkt_pts == INT64_MIN)
-					{
-						_first_pkt_pts = _pkt->pts;
-					}						
-				}
+				logte("Error sending a packet for decoding : AVERROR_EOF");
+			}
+			else if (ret < 0)
+			{
+				// The rest of the packet is dropped
+				offset = packet_data->GetLength();
+				char err_msg[1024];
+				av_strerror(ret, err_msg, sizeof(err_msg));
+				logte("An error occurred while sending a packet for decoding. %s ", err_msg);
 			}
 
-			if (_cur_data == nullptr || _cur_data->GetLength() <= _pkt_offset)
+			// Save first pakcet's PTS
+			if(_first_pkt_pts == INT64_MIN)
 			{
-				_cur_pkt = nullptr;
-				_cur_data = nullptr;
-				_pkt_offset = 0;
+				_first_pkt_pts = _pkt->pts;
 			}
 		}
 
 		/////////////////////////////////////////////////////////////////////
-		// Receive a frame from decoder
+		// Receive frames from decoder
 		/////////////////////////////////////////////////////////////////////
-		// Check the decoded frame is available
-		int ret = ::avcodec_receive_frame(_context, _frame);
-		if (ret == AVERROR(EAGAIN))
-		{
-			no_data_to_encode = true;
-			continue;
-		}
-		else if (ret == AVERROR_EOF)
-		{
-			logte("Error receiving a packet for decoding : AVERROR_EOF");
-			continue;
-		}
-		else if (ret < 0)
-		{
-			logte("Error receiving a packet for decoding : %d", ret);
-			continue;
-		}
-		else
+		while (!_kill_flag)
 		{
+			// Check the decoded frame is available
+			int ret = ::avcodec_receive_frame(_context, _frame);
+			if (ret == AVERROR(EAGAIN))
+			{
+				break;
+			}
+			else if (ret == AVERROR_EOF)
+			{
+				logte("Error receiving a packet for decoding : AVERROR_EOF");
+				break;
+			}
+			else if (ret < 0)
+			{
+				logte("Error receiving a packet for decoding : %d", ret);
+				break;
+			}
+
 			bool need_to_change_notify = false;
 
 			// Update codec informations if needed
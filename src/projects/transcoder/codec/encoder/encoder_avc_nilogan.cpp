@@ -150,25 +150,5 @@ bool EncoderAVCxNILOGAN::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	try
-	{
-		_kill_flag = false;
-
-		_codec_thread = std::thread(&EncoderAVCxNILOGAN::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("ENC-%sni-t%d", avcodec_get_name(GetCodecID()), _track->GetId()).CStr());
-
-		// Initialize the codec and wait for completion.
-		if(_codec_init_event.Get() == false)
-		{
-			_kill_flag = true;
-			return false;
-		}
-	}
-	catch (const std::system_error &e)
-	{
-		_kill_flag = true;
-		return false;
-	}
-
-	return true;
+	return StartCodec(ov::String::FormatString("ENC-%sni-t%d", avcodec_get_name(GetCodecID()), _track->GetId()));
 }
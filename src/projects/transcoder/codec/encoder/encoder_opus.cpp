@@ -120,129 +120,99 @@ bool EncoderOPUS::Configure(std::shared_ptr<MediaTrack> context)
 		return false;
 	}
 
-	try
-	{
-		_kill_flag = false;
+	return StartCodec(ov::String::FormatString("ENC-%s-t%d", avcodec_get_name(GetCodecID()), _track->GetId()));
+}
 
-		_codec_thread = std::thread(&EncoderOPUS::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("ENC-%s-t%d", avcodec_get_name(GetCodecID()), _track->GetId()).CStr());
-		
-		// Initialize the codec and wait for completion.
-		if(_codec_init_event.Get() == false)
-		{
-			_kill_flag = true;
-			return false;
-		}
-	}
-	catch (const std::system_error &e)
+bool EncoderOPUS::PrepareCodec()
+{
+	if (InitCodec() == false)
 	{
-		_kill_flag = true;
 		return false;
 	}
 
+	// Reference : https://opus-codec.org/docs/opus_api-1.1.3/group__opus__encoder.html#gad2d6bf6a9ffb6674879d7605ed073e25
+	// Number of samples per channel in the input signal. This must be an Opus frame size for the encoder's sampling rate.
+	// For example, at 48 kHz the permitted values are 120, 240, 480, 960, 1920, and 2880. Passing in a duration of less than 10 ms (480 samples at 48 kHz)
+
+	_bytes_to_encode = _frame_size * GetRefTrack()->GetChannel().GetCounts() * GetRefTrack()->GetSample().GetSampleSize();
+
 	return true;
 }
 
-void EncoderOPUS::CodecThread()
+bool EncoderOPUS::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
 {
-	// Initialize the codec and notify the main thread.
-	if(_codec_init_event.Submit(InitCodec()) == false)
+	OV_ASSERT2(media_frame != nullptr);
+
+	// const MediaFrame *frame = media_frame.get();
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
+	if (!av_frame)
 	{
-		return;
+		logte("Could not allocate the frame data");
+		return false;
 	}
-	
-	// Reference : https://opus-codec.org/docs/opus_api-1.1.3/group__opus__encoder.html#gad2d6bf6a9ffb6674879d7605ed073e25
-	// Number of samples per channel in the input signal. This must be an Opus frame size for the encoder's sampling rate.
-	// For example, at 48 kHz the permitted values are 120, 240, 480, 960, 1920, and 2880. Passing in a duration of less than 10 ms (480 samples at 48 kHz)
 
-	const unsigned int bytes_to_encode = _frame_size * GetRefTrack()->GetChannel().GetCounts() * GetRefTrack()->GetSample().GetSampleSize();
+	// Store frame informations
+	_format = media_frame->GetFormat<cmn::AudioSample::Format>();
 
-	while (!_kill_flag)
+	// Update current pts if the first PTS or PTS goes over frame_size.
+	if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
 	{
-		// If there is no data to encode, the data is fetched from the queue.
-		if (_buffer->GetLength() < bytes_to_encode)
-		{
-			auto obj = _input_buffer.Dequeue();
-			if (obj.has_value() == false)
-				continue;
-
-			auto media_frame = std::move(obj.value());
-			OV_ASSERT2(media_frame != nullptr);
-
-			// const MediaFrame *frame = media_frame.get();
-			auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Audio, media_frame);
-			if (!av_frame)
-			{
-				logte("Could not allocate the frame data");
-				break;
-			}
+		_current_pts = media_frame->GetPts();
+	}
 
-			// Store frame informations
-			_format = media_frame->GetFormat<cmn::AudioSample::Format>();
+	// Append frame data into the buffer
+	if (media_frame->GetChannelCount() == 1)
+	{
+		// Just copy data into buffer
+		_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+	}
+	else if (media_frame->GetChannelCount() >= 2)
+	{
+		// Currently, OME's OPUS encoder supports up to 2 channels
+		switch (_format)
+		{
+			case cmn::AudioSample::Format::S16P:
+			case cmn::AudioSample::Format::FltP: {
+				// Need to interleave if sample type is planar
+				off_t current_offset = _buffer->GetLength();
 
-			// Update current pts if the first PTS or PTS goes over frame_size.
-			if (_current_pts == -1 || abs(_current_pts - media_frame->GetPts()) > _frame_size)
-			{
-				_current_pts = media_frame->GetPts();
-			}
+				// Reserve extra spaces
+				// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
+				auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
+				_buffer->SetLength(current_offset + total_bytes);
 
-			// Append frame data into the buffer
-			if (media_frame->GetChannelCount() == 1)
-			{
-				// Just copy data into buffer
-				_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-			}
-			else if (media_frame->GetChannelCount() >= 2)
-			{
-				// Currently, OME's OPUS encoder supports up to 2 channels
-				switch (_format)
+				if (_format == cmn::AudioSample::Format::S16P)
 				{
-					case cmn::AudioSample::Format::S16P:
-					case cmn::AudioSample::Format::FltP: {
-						// Need to interleave if sample type is planar
-						off_t current_offset = _buffer->GetLength();
-
-						// Reserve extra spaces
-						// size_t total_bytes = av_frame->linesize[0] + av_frame->linesize[1];
-						auto total_bytes = static_cast<uint32_t>(media_frame->GetBytesPerSample() * media_frame->GetNbSamples()) * media_frame->GetChannelCount();
-						_buffer->SetLength(current_offset + total_bytes);
-
-						if (_format == cmn::AudioSample::Format::S16P)
-						{
-							// S16P
-							ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::S16;
-						}
-						else
-						{
-							// FltP
-							ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
-							_format = cmn::AudioSample::Format::Flt;
-						}
-						break;
-					}
-
-					case cmn::AudioSample::Format::S16:
-					case cmn::AudioSample::Format::Flt:
-						// Do not need to interleave if sample type is non-planar
-						_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
-						break;
-
-					default:
-						logte("Not supported format: %d", _format);
-						break;
+					// S16P
+					ov::Interleave<int16_t>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+					_format = cmn::AudioSample::Format::S16;
 				}
+				else
+				{
+					// FltP
+					ov::Interleave<float>(_buffer->GetWritableDataAs<uint8_t>() + current_offset, av_frame->data[0], av_frame->data[1], media_frame->GetNbSamples());
+					_format = cmn::AudioSample::Format::Flt;
+				}
+				break;
 			}
-		}
 
-		if (_buffer->GetLength() < bytes_to_encode)
-		{
-			// There is no data to encode
-			// logte("There is no data to encode");
-			continue;
+			case cmn::AudioSample::Format::S16:
+			case cmn::AudioSample::Format::Flt:
+				// Do not need to interleave if sample type is non-planar
+				_buffer->Append(av_frame->data[0], av_frame->linesize[0]);
+				break;
+
+			default:
+				logte("Not supported format: %d", _format);
+				break;
 		}
+	}
+
+	// Encode all complete frames in the buffer
+	while ((_buffer->GetLength() >= _bytes_to_encode) && !_kill_flag)
+	{
 		OV_ASSERT2(_current_pts >= 0);
-		OV_ASSERT2(_buffer->GetLength() >= bytes_to_encode);
+		OV_ASSERT2(_buffer->GetLength() >= _bytes_to_encode);
 
 		// "1275 * 3 + 7" formula is used in opusenc.c:813
 		// or, use the formula in "AudioEncoderOpusImpl::SufficientOutputBufferSize()" of the native code.
@@ -264,26 +234,26 @@ void EncoderOPUS::CodecThread()
 				break;
 
 			default:
-				continue;
+				return true;
 		}
 
 		if (encoded_bytes < 0)
 		{
 			logte("An error occurred while encode data %zu bytes. error:%d", _buffer->GetLength(), encoded_bytes);
-			continue;
+			return true;
 		}
 
 		encoded->SetLength(static_cast<size_t>(encoded_bytes));
 
 		// Data is encoded successfully
-		// dequeue <bytes_to_encoded> bytes
+		// dequeue <_bytes_to_encoded> bytes
 		auto buffer = _buffer->GetWritableDataAs<uint8_t>();
-		::memmove(buffer, buffer + bytes_to_encode, _buffer->GetLength() - bytes_to_encode);
-		_buffer->SetLength(_buffer->GetLength() - bytes_to_encode);
+		::memmove(buffer, buffer + _bytes_to_encode, _buffer->GetLength() - _bytes_to_encode);
+		_buffer->SetLength(_buffer->GetLength() - _bytes_to_encode);
 
 		int64_t duration = _frame_size;
 
-		auto packet_buffer = std::make_shared<MediaPacket>(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
+		auto packet_buffer = ov::AllocateShared<MediaPacket>(0, cmn::MediaType::Audio, 0, encoded, _current_pts, _current_pts, duration, MediaPacketFlag::Key);
 		packet_buffer->SetBitstreamFormat(cmn::BitstreamFormat::OPUS);
 		packet_buffer->SetPacketType(cmn::PacketType::RAW);
 
@@ -291,4 +261,6 @@ void EncoderOPUS::CodecThread()
 
 		Complete(std::move(packet_buffer));
 	}
+
+	return true;
 }
@@ -43,7 +43,8 @@ public:
 
 	// void SendBuffer(std::shared_ptr<const MediaFrame> frame) override;
 
-	void CodecThread() override;
+	bool PrepareCodec() override;
+	bool EncodeFrame(std::shared_ptr<const MediaFrame> media_frame) override;
 
 private:
 	bool SetCodecParams() override;
@@ -54,6 +55,8 @@ protected:
 	cmn::AudioSample::Format _format;
 	int64_t _current_pts;
 	uint32_t _frame_size = 0;
+	// Bytes of a frame of _frame_size samples
+	uint32_t _bytes_to_encode = 0;
 
 	OpusEncoder *_encoder;
 };
@@ -17,6 +17,7 @@
 
 #include "../codec/codec_base.h"
 #include "../transcoder_context.h"
+#include "../transcoder_scheduler.h"
 
 #include <base/info/application.h>
 #include <base/info/media_track.h>
@@ -94,6 +95,8 @@ public:
 		{
 			_input_buffer.Enqueue(std::move(buffer));
 
+			_worker.Notify();
+
 			return true;
 		}
 
@@ -127,7 +130,8 @@ protected:
 
 	std::atomic<State> _state = State::CREATED;
 
-	ov::ManagedQueue<std::shared_ptr<MediaFrame>> _input_buffer;
+	// Decoder threads (or scheduler workers) push, the filter thread pops
+	ov::ManagedQueue<std::shared_ptr<MediaFrame>, ov::ManagedQueueType::Mpsc> _input_buffer;
 
 	AVFrame *_frame = nullptr;
 
@@ -148,14 +152,12 @@ protected:
 	const AVFilter *_buffersrc = nullptr;
 	const AVFilter *_buffersink = nullptr;
 
-	ov::Future _codec_init_event;
-
 	// resolution of the input video frame
 	std::shared_ptr<MediaTrack> _input_track;
 	std::shared_ptr<MediaTrack> _output_track;
 
 	bool _kill_flag = false;
-	std::thread _thread_work;
+	TranscodeStageWorker _worker;
 
 	CompleteHandler _complete_handler;
 
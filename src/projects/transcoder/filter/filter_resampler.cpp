@@ -190,26 +190,36 @@ bool FilterResampler::Start()
 {
 	_source_id = ov::Random::GenerateInt32();
 
-	try
-	{
-		_kill_flag = false;
+	_kill_flag = false;
 
-		_thread_work = std::thread(&FilterResampler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), ov::String::FormatString("FLT-rsmp-t%u", _output_track->GetId()).CStr());
-		if (_codec_init_event.Get() == false)
+	auto thread_name = ov::String::FormatString("FLT-rsmp-t%u", _output_track->GetId());
+	auto init_handler = [this]() -> bool {
+		if (Configure(_input_track, _output_track) == false)
 		{
-			_kill_flag = false;
-
 			return false;
-		}		
-	}
-	catch (const std::system_error &e)
+		}
+
+		SetState(State::STARTED);
+
+		return true;
+	};
+	auto process_handler = [this](int timeout_ms) -> bool {
+		auto obj = _input_buffer.Dequeue(timeout_ms);
+		if (obj.has_value() == false)
+		{
+			return true;
+		}
+
+		return ProcessFrame(std::move(obj.value()));
+	};
+
+	if (_worker.Start(TranscodeScheduler::Stage::Filter, thread_name, true, init_handler, process_handler) == false)
 	{
 		_kill_flag = true;
 
 		SetState(State::ERROR);
 
-		logte("Failed to start resample filter thread.");
+		logte("Failed to start resample filter.");
 
 		return false;
 	}
@@ -223,99 +233,79 @@ void FilterResampler::Stop()
 
 	_input_buffer.Stop();
 
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
+	_worker.Stop();
 
-		logtd("filter resampler thread has ended");
-	}
+	logtd("filter resampler has ended");
 
 	SetState(State::STOPPED);
 }
 
-void FilterResampler::WorkerThread()
+bool FilterResampler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
 {
-	auto result = Configure(_input_track, _output_track);
-	if (_codec_init_event.Submit(result) == false)
+	int ret;
+
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
 	{
-		return;
+		logte("Could not allocate the frame data");
+
+		SetState(State::ERROR);
+
+		return false;
 	}
 
-	int ret;
+	// logtw("Resampled in frame. pts: %lld, linesize: %d, samples: %d", av_frame->pts, av_frame->linesize[0], av_frame->nb_samples);
+
+	ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d",
+			  _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
 
-	SetState(State::STARTED);
+		return true;
+	}
 
 	while (!_kill_flag)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
+		int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+
+		if (ret == AVERROR(EAGAIN))
 		{
-			continue;
+			break;
 		}
-
-		auto media_frame = std::move(obj.value());
-
-		auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+		else if (ret == AVERROR_EOF)
 		{
-			logte("Could not allocate the frame data");
+			logte("Error receiving filtered frame. error(EOF)");
 
 			SetState(State::ERROR);
 
 			break;
 		}
-
-		// logtw("Resampled in frame. pts: %lld, linesize: %d, samples: %d", av_frame->pts, av_frame->linesize[0], av_frame->nb_samples);
-
-		ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
-		if (ret < 0)
+		else if (ret < 0)
 		{
-			logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, layout: %d, channels: %d, format: %d, rq: %d",
-				  _frame->pts, _frame->linesize[0], _frame->sample_rate, _frame->channel_layout, _frame->channels, _frame->format, _input_buffer.Size());
+			logte("Error receiving filtered frame. error(%d)", ret);
 
-			continue;
-		}
+			SetState(State::ERROR);
 
-		while (!_kill_flag)
+			break;
+		}
+		else
 		{
-			int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
-
-			if (ret == AVERROR(EAGAIN))
+			// logti("Resampled out frame. pts: %lld, linesize: %d, samples : %d", _frame->pts, _frame->linesize[0], _frame->nb_samples);
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
 			{
-				break;
-			}
-			else if (ret == AVERROR_EOF)
-			{
-				logte("Error receiving filtered frame. error(EOF)");
-
-				SetState(State::ERROR);
-
-				break;
-			}
-			else if (ret < 0)
-			{
-				logte("Error receiving filtered frame. error(%d)", ret);
+				logte("Could not allocate the frame data");
 
-				SetState(State::ERROR);
-
-				break;
+				continue;
 			}
-			else
-			{
-				// logti("Resampled out frame. pts: %lld, linesize: %d, samples : %d", _frame->pts, _frame->linesize[0], _frame->nb_samples);
-				auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Audio, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					logte("Could not allocate the frame data");
-
-					continue;
-				}
 
-				output_frame->SetSourceId(_source_id);
+			output_frame->SetSourceId(_source_id);
 
-				Complete(std::move(output_frame));
-			}
+			Complete(std::move(output_frame));
 		}
 	}
+
+	return true;
 }
@@ -24,9 +24,10 @@ public:
 	bool Start() override;
 	void Stop() override;
 
-	void WorkerThread();
-
 private:
+	// Resamples a frame and outputs all frames available in the filter graph
+	bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame);
+
 	bool InitializeSourceFilter();
 	bool InitializeFilterDescription();
 	bool InitializeSinkFilter();
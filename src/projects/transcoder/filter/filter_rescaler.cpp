@@ -373,26 +373,46 @@ bool FilterRescaler::Start()
 {
 	_source_id = ov::Random::GenerateInt32();
 
-	try
-	{
-		_kill_flag = false;
+	_kill_flag = false;
 
-		_thread_work = std::thread(&FilterRescaler::WorkerThread, this);
-		pthread_setname_np(_thread_work.native_handle(), ov::String::FormatString("FLT-rscl-t%u", _output_track->GetId()).CStr());
-		
-		if (_codec_init_event.Get() == false)
+	auto thread_name = ov::String::FormatString("FLT-rscl-t%u", _output_track->GetId());
+	auto init_handler = [this]() -> bool {
+		if (Configure(_input_track, _output_track) == false)
 		{
-			_kill_flag = false;
-
 			return false;
-		}	
-	}
-	catch (const std::system_error &e)
+		}
+
+		SetState(State::STARTED);
+
+#if _SKIP_FRAMES_ENABLED
+		_skip_frames_last_check_time = ov::Time::GetTimestampInMs();
+		_skip_frames_last_changed_time = ov::Time::GetTimestampInMs();
+
+		// Set initial Skip Frames
+		_skip_frames = _output_track->GetSkipFramesByConfig();
+		_skip_frames_previous_queue_size = 0;
+#endif
+		_start_frame_syncronization = true;
+
+		return true;
+	};
+	auto process_handler = [this](int timeout_ms) -> bool {
+		auto obj = _input_buffer.Dequeue(timeout_ms);
+		if (obj.has_value() == false)
+		{
+			return true;
+		}
+
+		return ProcessFrame(std::move(obj.value()));
+	};
+
+	// The hardware scaler of XMA/NILOGAN must be used by the thread that created it
+	if (_worker.Start(TranscodeScheduler::Stage::Filter, thread_name, TranscodeScheduler::IsSchedulable(_output_track->GetCodecModuleId()), init_handler, process_handler) == false)
 	{
 		_kill_flag = true;
 		SetState(State::ERROR);
 
-		logte("Failed to start rescaling filter thread");
+		logte("Failed to start rescaling filter");
 
 		return false;
 	}
@@ -409,11 +429,7 @@ void FilterRescaler::Stop()
 
 	_input_buffer.Stop();
 
-	if (_thread_work.joinable())
-	{
-		_thread_work.join();
-		
-	}
+	_worker.Stop();
 
 	OV_SAFE_FUNC(_buffersrc_ctx, nullptr, ::avfilter_free, );
 	OV_SAFE_FUNC(_buffersink_ctx, nullptr, ::avfilter_free, );
@@ -457,11 +473,20 @@ bool FilterRescaler::PushProcess(std::shared_ptr<MediaFrame> media_frame)
 	if (_use_hwframe_transfer == true && av_frame->hw_frames_ctx != nullptr)
 	{
 		// GPU Memory -> Host Memory
-		alter_av_frame = ::av_frame_alloc();
+		// The host frame is taken from the pool, so the download does not allocate a new buffer per frame.
+		auto frames_ctx = reinterpret_cast<AVHWFramesContext *>(av_frame->hw_frames_ctx->data);
+		alter_av_frame = TranscodeFramePool::GetInstance()->AllocateVideoFrame(frames_ctx->sw_format, av_frame->width, av_frame->height);
+		if (alter_av_frame == nullptr)
+		{
+			alter_av_frame = ::av_frame_alloc();
+		}
+
 		if (::av_hwframe_transfer_data(alter_av_frame, av_frame, 0) < 0)
 		{
 			logte("Error transferring the data to system memory\n");
 
+			::av_frame_free(&alter_av_frame);
+
 			SetState(State::ERROR);
 
 			return false;
@@ -477,6 +502,11 @@ bool FilterRescaler::PushProcess(std::shared_ptr<MediaFrame> media_frame)
 	{
 		logte("An error occurred while feeding to filtergraph: format: %d, pts: %lld, linesize: %d, queue.size: %d", av_frame->format, av_frame->pts, av_frame->linesize[0], _input_buffer.Size());
 
+		if (alter_av_frame != nullptr)
+		{
+			av_frame_free(&alter_av_frame);
+		}
+
 		SetState(State::ERROR);
 
 		return false;
@@ -549,157 +579,117 @@ bool FilterRescaler::PopProcess(bool is_flush)
 		if (!PushProcess(frame)) { break; } \
 		if (!PopProcess()) { break; } 
 
-#define FLUSH_FILTER_ONCE() \
-		{ PushProcess(nullptr); PopProcess(true); }
-
-void FilterRescaler::WorkerThread()
+bool FilterRescaler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
 {
-	if(_codec_init_event.Submit(Configure(_input_track, _output_track)) == false)
-	{
-		return;
-	}
-
-	SetState(State::STARTED);
-
 #if _SKIP_FRAMES_ENABLED
-	auto skip_frames_last_check_time = ov::Time::GetTimestampInMs();
-	auto skip_frames_last_changed_time = ov::Time::GetTimestampInMs();
-	
-
-	// Set initial Skip Frames
-	int32_t skip_frames = _output_track->GetSkipFramesByConfig();
-	size_t  skip_frames_previous_queue_size = 0;
-#endif
-
-	// XMA devices expand the memory pool when processing the first frame filtering. 
-	// At this time, memory allocation failure occurs because it is not 'Thread safe'. 
-	// It is used for the purpose of preventing this.
-	bool start_frame_syncronization = true;
-
-	while (!_kill_flag)
+	// If the set value is greater than or equal to 0, the skip frame is automatically calculated.
+	// The skip frame is not less than the value set by the user.
+	if(_output_track->GetSkipFramesByConfig() >= 0)
 	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-		{
-			continue;
-		}
+		auto curr_time = ov::Time::GetTimestampInMs();
 
-		auto media_frame = std::move(obj.value());
+		// Periodically check the status of the queue
+		// If the queue exceeds an arbitrary threshold, increase the number of skip frames quickly
+		// If the queue is stable, slowly decrease the number of skip frames.
+		// If the queue exceeds the threshold, drop the frame.
+		auto elapsed_check_time = curr_time - _skip_frames_last_check_time;
+		auto elapsed_stable_time = curr_time - _skip_frames_last_changed_time;
 
-#if _SKIP_FRAMES_ENABLED 
-		// If the set value is greater than or equal to 0, the skip frame is automatically calculated.
-		// The skip frame is not less than the value set by the user.
-		if(_output_track->GetSkipFramesByConfig() >= 0)
+		if (elapsed_check_time > _SKIP_FRAMES_CHECK_INTERVAL)
 		{
-			auto curr_time = ov::Time::GetTimestampInMs();
+			_skip_frames_last_check_time = curr_time;
 
-			// Periodically check the status of the queue
-			// If the queue exceeds an arbitrary threshold, increase the number of skip frames quickly
-			// If the queue is stable, slowly decrease the number of skip frames.
-			// If the queue exceeds the threshold, drop the frame.
-			auto elapsed_check_time = curr_time - skip_frames_last_check_time;
-			auto elapsed_stable_time = curr_time - skip_frames_last_changed_time;
-
-			if (elapsed_check_time > _SKIP_FRAMES_CHECK_INTERVAL)
+			// The frame skip should not be more than 1 second.
+			if ((_skip_frames < _output_track->GetFrameRateByConfig()) &&		   // Maximum 1 second
+				(_input_buffer.GetSize() > (_input_buffer.GetThreshold() / 4)) &&  // 25% of the threshold == 0.5s
+				(_input_buffer.GetSize() >= _skip_frames_previous_queue_size))	   // The queue is growing
 			{
-				skip_frames_last_check_time = curr_time;
+				_skip_frames++;
+				_skip_frames_previous_queue_size = _input_buffer.GetSize();
+				_skip_frames_last_changed_time = curr_time;
 
-				// The frame skip should not be more than 1 second.
-				if ((skip_frames < _output_track->GetFrameRateByConfig()) &&		   // Maximum 1 second
-					(_input_buffer.GetSize() > (_input_buffer.GetThreshold() / 4)) &&  // 25% of the threshold == 0.5s
-					(_input_buffer.GetSize() >= skip_frames_previous_queue_size))	   // The queue is growing
+				logtw("Scaler is unstable. changing skip frames %d to %d", _skip_frames-1, _skip_frames);
+			}
+			// If the queue is stable, slowly decrease the number of skip frames.
+			else if ((_skip_frames > _output_track->GetSkipFramesByConfig()) &&
+					 (elapsed_stable_time > _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL) &&
+					 _input_buffer.GetSize() <= 1)
+			{
+				if (--_skip_frames < 0)
 				{
-					skip_frames++;
-					skip_frames_previous_queue_size = _input_buffer.GetSize();
-					skip_frames_last_changed_time = curr_time;
-
-					logtw("Scaler is unstable. changing skip frames %d to %d", skip_frames-1, skip_frames);
+					_skip_frames = 0;
 				}
-				// If the queue is stable, slowly decrease the number of skip frames.
-				else if ((skip_frames > _output_track->GetSkipFramesByConfig()) &&
-						 (elapsed_stable_time > _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL) &&
-						 _input_buffer.GetSize() <= 1)
-				{
-					if (--skip_frames < 0)
-					{
-						skip_frames = 0;
-					}
 
-					skip_frames_previous_queue_size = _input_buffer.GetSize();
-					skip_frames_last_changed_time = curr_time;
+				_skip_frames_previous_queue_size = _input_buffer.GetSize();
+				_skip_frames_last_changed_time = curr_time;
 
-					logtd("Scaler is stable. changing skip frames %d to %d", skip_frames+1, skip_frames);
-				}
-
-				_fps_filter.SetSkipFrames(skip_frames);
+				logtd("Scaler is stable. changing skip frames %d to %d", _skip_frames+1, _skip_frames);
 			}
-		}
 
-		// If the user does not set the output Framerate, use the recommend framerate
-		// Cases where the framerate changes dynamically, such as when using WebRTC, WHIP, or SRTP protocols, were considered.
-		// It is similar to maintaining the original frame rate.
-		if (_output_track->GetFrameRateByConfig() == 0.0f)
-		{
-			auto recommended_output_framerate = TranscoderStreamInternal::MeasurementToRecommendFramerate(_input_track->GetFrameRate());
-			if (_fps_filter.GetOutputFrameRate() != recommended_output_framerate)
-			{
-				logtd("Change output framerate. Input: %.2ffps, Output: %.2f -> %.2ffps", _input_track->GetFrameRate(), _fps_filter.GetOutputFrameRate(), recommended_output_framerate);
-				_fps_filter.SetOutputFrameRate(recommended_output_framerate);
-			}
+			_fps_filter.SetSkipFrames(_skip_frames);
 		}
+	}
 
-		// If the queue exceeds the threshold, drop the frame.
-		if (_input_buffer.IsThresholdExceeded())
+	// If the user does not set the output Framerate, use the recommend framerate
+	// Cases where the framerate changes dynamically, such as when using WebRTC, WHIP, or SRTP protocols, were considered.
+	// It is similar to maintaining the original frame rate.
+	if (_output_track->GetFrameRateByConfig() == 0.0f)
+	{
+		auto recommended_output_framerate = TranscoderStreamInternal::MeasurementToRecommendFramerate(_input_track->GetFrameRate());
+		if (_fps_filter.GetOutputFrameRate() != recommended_output_framerate)
 		{
-			media_frame = nullptr;;
+			logtd("Change output framerate. Input: %.2ffps, Output: %.2f -> %.2ffps", _input_track->GetFrameRate(), _fps_filter.GetOutputFrameRate(), recommended_output_framerate);
+			_fps_filter.SetOutputFrameRate(recommended_output_framerate);
 		}
+	}
 
-		// logti("buffer.size(%d), i/omps(%d/%d), threshold(%d), skip(%d/%d), stable(%d ms)",
-		// 	  _input_buffer.GetSize(),
-		// 	  _input_buffer.GetInputMessagePerSecond(), _input_buffer.GetOutputMessagePerSecond(), 
-		// 	  _input_buffer.GetThreshold(),
-		// 	  skip_frames, _output_track->GetSkipFramesByConfig(),
-		// 	  elapsed_stable_time);
-
-		if(media_frame != nullptr)
-		{
-			_fps_filter.Push(media_frame);
-		}
+	// If the queue exceeds the threshold, drop the frame.
+	if (_input_buffer.IsThresholdExceeded())
+	{
+		media_frame = nullptr;
+	}
 
-		while (auto frame = _fps_filter.Pop())
-		{
-			if (start_frame_syncronization)
-			{
-				std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
+	// logti("buffer.size(%d), i/omps(%d/%d), threshold(%d), skip(%d/%d), stable(%d ms)",
+	// 	  _input_buffer.GetSize(),
+	// 	  _input_buffer.GetInputMessagePerSecond(), _input_buffer.GetOutputMessagePerSecond(), 
+	// 	  _input_buffer.GetThreshold(),
+	// 	  _skip_frames, _output_track->GetSkipFramesByConfig(),
+	// 	  elapsed_stable_time);
 
-				DO_FILTER_ONCE(frame);
+	if(media_frame != nullptr)
+	{
+		_fps_filter.Push(media_frame);
+	}
 
-				start_frame_syncronization = false;
-			}
-			else
-			{
-				DO_FILTER_ONCE(frame);
-			}
-		}
-#else
-		if (start_frame_syncronization)
+	while (auto frame = _fps_filter.Pop())
+	{
+		if (_start_frame_syncronization)
 		{
 			std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
 
-			DO_FILTER_ONCE(media_frame);
+			DO_FILTER_ONCE(frame);
 
-			start_frame_syncronization = false;
+			_start_frame_syncronization = false;
 		}
 		else
 		{
-			DO_FILTER_ONCE(media_frame);
+			DO_FILTER_ONCE(frame);
 		}
-#endif
+	}
+#else
+	if (_start_frame_syncronization)
+	{
+		std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
+
+		_start_frame_syncronization = false;
 
+		return (PushProcess(media_frame) && PopProcess());
 	}
 
-	// Flush the filter
-	FLUSH_FILTER_ONCE();
+	return (PushProcess(media_frame) && PopProcess());
+#endif
+
+	return true;
 }
 
 bool FilterRescaler::SetHWContextToFilterIfNeed()
@@ -25,9 +25,10 @@ public:
 	bool Start() override;
 	void Stop() override;
 
-	void WorkerThread();
-
 private:
+	// Rescales a frame and outputs all frames available in the filter graph
+	bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame);
+
 	bool InitializeSourceFilter();
 	bool InitializeFilterDescription();
 	bool InitializeSinkFilter();	
@@ -39,4 +40,14 @@ private:
 
 	// Constant FrameRate & SkipFrame Filter
 	FilterFps _fps_filter;
+
+	int32_t _skip_frames = 0;
+	size_t _skip_frames_previous_queue_size = 0;
+	int64_t _skip_frames_last_check_time = 0;
+	int64_t _skip_frames_last_changed_time = 0;
+
+	// XMA devices expand the memory pool when processing the first frame filtering. 
+	// At this time, memory allocation failure occurs because it is not 'Thread safe'. 
+	// It is used for the purpose of preventing this.
+	bool _start_frame_syncronization = true;
 };
@@ -0,0 +1,564 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Created by Kwon Keuk Han
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#include "filter_rescaler_ladder.h"
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "../transcoder_gpu.h"
+#include "../transcoder_private.h"
+#include "../transcoder_stream_internal.h"
+
+#define DEFAULT_QUEUE_SIZE 120
+
+#define _SKIP_FRAMES_CHECK_INTERVAL 500 					// 500ms
+#define _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL 10000 	// 10s
+
+// Interval to report the latency of each rung
+#define _RUNG_STATS_REPORT_INTERVAL_MS (10 * 1000)
+
+FilterRescalerLadder::FilterRescalerLadder()
+{
+	_frame = ::av_frame_alloc();
+
+	_outputs = ::avfilter_inout_alloc();
+
+	_buffersrc = ::avfilter_get_by_name("buffer");
+	_buffersink = ::avfilter_get_by_name("buffersink");
+
+	_filter_graph = ::avfilter_graph_alloc();
+
+	_input_buffer.SetThreshold(DEFAULT_QUEUE_SIZE);
+
+	OV_ASSERT2(_frame != nullptr);
+	OV_ASSERT2(_outputs != nullptr);
+	OV_ASSERT2(_buffersrc != nullptr);
+	OV_ASSERT2(_buffersink != nullptr);
+	OV_ASSERT2(_filter_graph != nullptr);
+
+	// Same as FilterRescaler, but the thread pool is shared by all rungs
+	_filter_graph->nb_threads = 4;
+}
+
+FilterRescalerLadder::~FilterRescalerLadder()
+{
+}
+
+bool FilterRescalerLadder::IsSupported(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	if ((input_track == nullptr) || (output_track == nullptr) || (input_track == output_track))
+	{
+		return false;
+	}
+
+	if (input_track->GetMediaType() != cmn::MediaType::Video)
+	{
+		return false;
+	}
+
+	// The decoded frames must be in CPU memory
+	switch (input_track->GetCodecModuleId())
+	{
+		case cmn::MediaCodecModuleId::DEFAULT:
+		case cmn::MediaCodecModuleId::X264:
+		case cmn::MediaCodecModuleId::QSV:		// CPU memory using 'gpu_copy=on'
+		case cmn::MediaCodecModuleId::NILOGAN:	// CPU memory using 'out=sw'
+			break;
+		default:
+			return false;
+	}
+
+	// The encoder must take frames in CPU memory
+	switch (output_track->GetCodecModuleId())
+	{
+		case cmn::MediaCodecModuleId::DEFAULT:
+		case cmn::MediaCodecModuleId::BEAMR:
+		case cmn::MediaCodecModuleId::OPENH264:
+		case cmn::MediaCodecModuleId::X264:
+		case cmn::MediaCodecModuleId::QSV:
+		case cmn::MediaCodecModuleId::LIBVPX:
+		case cmn::MediaCodecModuleId::NILOGAN:
+			break;
+		default:
+			return false;
+	}
+
+	return true;
+}
+
+void FilterRescalerLadder::SetOutputTracks(const std::vector<std::shared_ptr<MediaTrack>> &output_tracks)
+{
+	_output_tracks = output_tracks;
+}
+
+void FilterRescalerLadder::SetRungCompleteHandler(RungCompleteHandler handler)
+{
+	_rung_complete_handler = std::move(handler);
+}
+
+bool FilterRescalerLadder::InitializeSourceFilter()
+{
+	std::vector<ov::String> src_params;
+
+	src_params.push_back(ov::String::FormatString("video_size=%dx%d", _input_track->GetWidth(), _input_track->GetHeight()));
+	src_params.push_back(ov::String::FormatString("pix_fmt=%s", ::av_get_pix_fmt_name((AVPixelFormat)_src_pixfmt)));
+	src_params.push_back(ov::String::FormatString("time_base=%s", _input_track->GetTimeBase().GetStringExpr().CStr()));
+	src_params.push_back(ov::String::FormatString("pixel_aspect=%d/%d", 1, 1));
+
+	_src_args = ov::String::Join(src_params, ":");
+
+	int ret = ::avfilter_graph_create_filter(&_buffersrc_ctx, _buffersrc, "in", _src_args, nullptr, _filter_graph);
+	if (ret < 0)
+	{
+		logte("Could not create video buffer source filter for ladder rescaling: %d", ret);
+		return false;
+	}
+
+	_outputs->name = ::av_strdup("in");
+	_outputs->filter_ctx = _buffersrc_ctx;
+	_outputs->pad_idx = 0;
+	_outputs->next = nullptr;
+
+	return true;
+}
+
+bool FilterRescalerLadder::InitializeSinkFilters()
+{
+	AVFilterInOut *last_input = nullptr;
+
+	for (size_t index = 0; index < _rungs.size(); index++)
+	{
+		auto &rung = _rungs[index];
+		auto name = ov::String::FormatString("out%zu", index);
+
+		int ret = ::avfilter_graph_create_filter(&rung.buffersink_ctx, _buffersink, name, nullptr, nullptr, _filter_graph);
+		if (ret < 0)
+		{
+			logte("Could not create video buffer sink filter for ladder rescaling: %d", ret);
+			return false;
+		}
+
+		auto input = ::avfilter_inout_alloc();
+		if (input == nullptr)
+		{
+			logte("Could not allocate filter inout for ladder rescaling");
+			return false;
+		}
+
+		input->name = ::av_strdup(name);
+		input->filter_ctx = rung.buffersink_ctx;
+		input->pad_idx = 0;
+		input->next = nullptr;
+
+		if (last_input == nullptr)
+		{
+			_inputs = input;
+		}
+		else
+		{
+			last_input->next = input;
+		}
+
+		last_input = input;
+	}
+
+	return true;
+}
+
+bool FilterRescalerLadder::InitializeFilterDescription()
+{
+	std::vector<ov::String> chains;
+	ov::String source = "in";
+
+	for (size_t index = 0; index < _rungs.size(); index++)
+	{
+		auto &output_track = _rungs[index].output_track;
+
+		auto scale = ov::String::FormatString("scale=%dx%d:flags=bilinear", output_track->GetWidth(), output_track->GetHeight());
+		auto branch = ov::String::FormatString("settb=%s,format=%s",
+											   output_track->GetTimeBase().GetStringExpr().CStr(),
+											   ::av_get_pix_fmt_name((AVPixelFormat)output_track->GetColorspace()));
+
+		if (index == (_rungs.size() - 1))
+		{
+			chains.push_back(ov::String::FormatString("[%s]%s,%s[out%zu]", source.CStr(), scale.CStr(), branch.CStr(), index));
+		}
+		else
+		{
+			// The next rung is scaled from the output of this rung
+			chains.push_back(ov::String::FormatString("[%s]%s,split=2[r%zu][c%zu]", source.CStr(), scale.CStr(), index, index));
+			chains.push_back(ov::String::FormatString("[r%zu]%s[out%zu]", index, branch.CStr(), index));
+
+			source = ov::String::FormatString("c%zu", index);
+		}
+	}
+
+	_filter_desc = ov::String::Join(chains, ";");
+
+	return true;
+}
+
+bool FilterRescalerLadder::Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track)
+{
+	SetState(State::CREATED);
+
+	if (_output_tracks.empty())
+	{
+		logte("No output tracks for ladder rescaling");
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	_input_track = input_track;
+	_src_width = _input_track->GetWidth();
+	_src_height = _input_track->GetHeight();
+	_src_pixfmt = _input_track->GetColorspace();
+
+	_rungs.clear();
+	for (size_t index = 0; index < _output_tracks.size(); index++)
+	{
+		Rung rung;
+
+		rung.output_index = index;
+		rung.output_track = _output_tracks[index];
+		rung.stats.width = rung.output_track->GetWidth();
+		rung.stats.height = rung.output_track->GetHeight();
+
+		_rungs.push_back(rung);
+	}
+
+	std::stable_sort(_rungs.begin(), _rungs.end(), [](const Rung &a, const Rung &b) {
+		return (static_cast<int64_t>(a.output_track->GetWidth()) * a.output_track->GetHeight()) >
+			   (static_cast<int64_t>(b.output_track->GetWidth()) * b.output_track->GetHeight());
+	});
+
+	_last_rung_stats.resize(_rungs.size());
+
+	// The largest rung represents the ladder
+	_output_track = _rungs[0].output_track;
+
+	// Initialize Constant Framerate & Skip Frames Filter (all rungs have the same framerate settings)
+	_fps_filter.SetInputTimebase(_input_track->GetTimeBase());
+	_fps_filter.SetInputFrameRate(_input_track->GetFrameRate());
+	_fps_filter.SetOutputFrameRate(_output_track->GetFrameRateByConfig() > 0 ? _output_track->GetFrameRateByConfig() : _output_track->GetEstimateFrameRate());
+	_fps_filter.SetSkipFrames(_output_track->GetSkipFramesByConfig() >= 0 ? _output_track->GetSkipFramesByConfig() : 0);
+
+	// Set the threshold of the input buffer to 2 seconds.
+	_input_buffer.SetThreshold(_input_track->GetFrameRate() * 2);
+
+	if ((InitializeFilterDescription() == false) ||
+		(InitializeSourceFilter() == false) ||
+		(InitializeSinkFilters() == false))
+	{
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	logti("Ladder rescaler parameters. track(#%u -> %zu rungs), desc(src:%s -> output:%s), fps(%.2f -> %.2f), skipFrames(%d)",
+		  _input_track->GetId(),
+		  _rungs.size(),
+		  _src_args.CStr(),
+		  _filter_desc.CStr(),
+		  _fps_filter.GetInputFrameRate(),
+		  _fps_filter.GetOutputFrameRate(),
+		  _fps_filter.GetSkipFrames());
+
+	if ((::avfilter_graph_parse_ptr(_filter_graph, _filter_desc, &_inputs, &_outputs, nullptr)) < 0)
+	{
+		logte("Could not parse filter string for ladder rescaling: %s", _filter_desc.CStr());
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	if (::avfilter_graph_config(_filter_graph, nullptr) < 0)
+	{
+		logte("Could not validate filter graph for ladder rescaling");
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool FilterRescalerLadder::Start()
+{
+	_source_id = ov::Random::GenerateInt32();
+
+	_kill_flag = false;
+
+	auto thread_name = ov::String::FormatString("FLT-ladr-t%u", _input_track->GetId());
+	auto init_handler = [this]() -> bool {
+		if (Configure(_input_track, _output_track) == false)
+		{
+			return false;
+		}
+
+		SetState(State::STARTED);
+
+		_skip_frames = std::max(_output_track->GetSkipFramesByConfig(), 0);
+		_skip_frames_last_check_time = ov::Time::GetTimestampInMs();
+		_skip_frames_last_changed_time = _skip_frames_last_check_time;
+		_last_report_time = std::chrono::steady_clock::now();
+
+		return true;
+	};
+	auto process_handler = [this](int timeout_ms) -> bool {
+		auto obj = _input_buffer.Dequeue(timeout_ms);
+		if (obj.has_value() == false)
+		{
+			return true;
+		}
+
+		ProcessFrame(std::move(obj.value()));
+
+		return true;
+	};
+
+	// Only software scaling is used, so the ladder can always run on the scheduler
+	if (_worker.Start(TranscodeScheduler::Stage::Filter, thread_name, true, init_handler, process_handler) == false)
+	{
+		_kill_flag = true;
+		SetState(State::ERROR);
+
+		logte("Failed to start ladder rescaling filter");
+
+		return false;
+	}
+
+	return true;
+}
+
+void FilterRescalerLadder::Stop()
+{
+	if (GetState() == State::STOPPED)
+		return;
+
+	_kill_flag = true;
+
+	_input_buffer.Stop();
+
+	_worker.Stop();
+
+	// The sink contexts are freed with the graph
+	for (auto &rung : _rungs)
+	{
+		rung.buffersink_ctx = nullptr;
+	}
+
+	OV_SAFE_FUNC(_inputs, nullptr, ::avfilter_inout_free, &);
+	OV_SAFE_FUNC(_outputs, nullptr, ::avfilter_inout_free, &);
+	OV_SAFE_FUNC(_frame, nullptr, ::av_frame_free, &);
+	OV_SAFE_FUNC(_filter_graph, nullptr, ::avfilter_graph_free, &);
+
+	_buffersrc_ctx = nullptr;
+	_buffersrc = nullptr;
+	_buffersink = nullptr;
+
+	_input_buffer.Clear();
+
+	_fps_filter.Clear();
+
+	SetState(State::STOPPED);
+
+	logtd("ladder rescale filter has ended");
+}
+
+bool FilterRescalerLadder::PushProcess(std::shared_ptr<MediaFrame> media_frame)
+{
+	if (media_frame == nullptr)
+	{
+		return false;
+	}
+
+	auto av_frame = ffmpeg::Conv::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the video frame data");
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	_push_time = std::chrono::steady_clock::now();
+
+	if (::av_buffersrc_write_frame(_buffersrc_ctx, av_frame))
+	{
+		logte("An error occurred while feeding to filtergraph: format: %d, pts: %lld, linesize: %d, queue.size: %d", av_frame->format, av_frame->pts, av_frame->linesize[0], _input_buffer.Size());
+
+		SetState(State::ERROR);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool FilterRescalerLadder::PopProcess(bool is_flush)
+{
+	// Rungs are drained from the largest, so the frame of a smaller rung is scaled after the frame it is scaled from
+	for (auto &rung : _rungs)
+	{
+		while (!_kill_flag || is_flush)
+		{
+			int ret = ::av_buffersink_get_frame(rung.buffersink_ctx, _frame);
+			if (ret == AVERROR(EAGAIN))
+			{
+				break;
+			}
+			else if (ret < 0)
+			{
+				if (is_flush)
+				{
+					break;
+				}
+
+				logte("Error receiving filtered frame of rung %dx%d. error(%d)", rung.stats.width, rung.stats.height, ret);
+				SetState(State::ERROR);
+
+				return false;
+			}
+
+			auto latency_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _push_time).count();
+			rung.stats.frame_count++;
+			rung.stats.total_latency_us += latency_us;
+			rung.stats.max_latency_us = std::max<int64_t>(rung.stats.max_latency_us, latency_us);
+
+			_frame->pict_type = AV_PICTURE_TYPE_NONE;
+			auto output_frame = ffmpeg::Conv::ToMediaFrame(cmn::MediaType::Video, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
+			{
+				continue;
+			}
+
+			// Convert duration to output track timebase
+			output_frame->SetDuration((int64_t)((double)output_frame->GetDuration() * _input_track->GetTimeBase().GetExpr() / rung.output_track->GetTimeBase().GetExpr()));
+			output_frame->SetSourceId(_source_id);
+
+			if ((_rung_complete_handler != nullptr) && (_kill_flag == false))
+			{
+				_rung_complete_handler(rung.output_index, std::move(output_frame));
+			}
+		}
+	}
+
+	return true;
+}
+
+void FilterRescalerLadder::UpdateSkipFrames()
+{
+	// Same policy as FilterRescaler: if the set value is greater than or equal to 0, the skip frame is automatically calculated.
+	if (_output_track->GetSkipFramesByConfig() < 0)
+	{
+		return;
+	}
+
+	auto curr_time = ov::Time::GetTimestampInMs();
+
+	if ((curr_time - _skip_frames_last_check_time) <= _SKIP_FRAMES_CHECK_INTERVAL)
+	{
+		return;
+	}
+
+	_skip_frames_last_check_time = curr_time;
+
+	if ((_skip_frames < _output_track->GetFrameRateByConfig()) &&
+		(_input_buffer.GetSize() > (_input_buffer.GetThreshold() / 4)) &&
+		(_input_buffer.GetSize() >= _skip_frames_previous_queue_size))
+	{
+		_skip_frames++;
+		_skip_frames_previous_queue_size = _input_buffer.GetSize();
+		_skip_frames_last_changed_time = curr_time;
+
+		logtw("Ladder scaler is unstable. changing skip frames %d to %d", _skip_frames - 1, _skip_frames);
+	}
+	else if ((_skip_frames > _output_track->GetSkipFramesByConfig()) &&
+			 ((curr_time - _skip_frames_last_changed_time) > _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL) &&
+			 (_input_buffer.GetSize() <= 1))
+	{
+		_skip_frames = std::max(_skip_frames - 1, 0);
+		_skip_frames_previous_queue_size = _input_buffer.GetSize();
+		_skip_frames_last_changed_time = curr_time;
+
+		logtd("Ladder scaler is stable. changing skip frames %d to %d", _skip_frames + 1, _skip_frames);
+	}
+
+	_fps_filter.SetSkipFrames(_skip_frames);
+}
+
+void FilterRescalerLadder::ReportRungStats()
+{
+	auto now = std::chrono::steady_clock::now();
+
+	if (std::chrono::duration_cast<std::chrono::milliseconds>(now - _last_report_time).count() < _RUNG_STATS_REPORT_INTERVAL_MS)
+	{
+		return;
+	}
+
+	_last_report_time = now;
+
+	std::lock_guard<std::mutex> lock(_rung_stats_mutex);
+
+	for (auto &rung : _rungs)
+	{
+		logtd("Ladder rung track(#%u) %dx%d: %llu frames, latency avg: %.0f us, max: %lld us",
+			  rung.output_track->GetId(), rung.stats.width, rung.stats.height,
+			  rung.stats.frame_count, rung.stats.GetAverageLatencyUs(), rung.stats.max_latency_us);
+
+		_last_rung_stats[rung.output_index] = rung.stats;
+
+		rung.stats.frame_count = 0;
+		rung.stats.total_latency_us = 0;
+		rung.stats.max_latency_us = 0;
+	}
+}
+
+std::vector<FilterRescalerLadder::RungStats> FilterRescalerLadder::GetRungStats()
+{
+	std::lock_guard<std::mutex> lock(_rung_stats_mutex);
+
+	return _last_rung_stats;
+}
+
+void FilterRescalerLadder::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
+{
+	UpdateSkipFrames();
+
+	// If the user does not set the output Framerate, use the recommend framerate
+	if (_output_track->GetFrameRateByConfig() == 0.0f)
+	{
+		auto recommended_output_framerate = TranscoderStreamInternal::MeasurementToRecommendFramerate(_input_track->GetFrameRate());
+		if (_fps_filter.GetOutputFrameRate() != recommended_output_framerate)
+		{
+			logtd("Change output framerate. Input: %.2ffps, Output: %.2f -> %.2ffps", _input_track->GetFrameRate(), _fps_filter.GetOutputFrameRate(), recommended_output_framerate);
+			_fps_filter.SetOutputFrameRate(recommended_output_framerate);
+		}
+	}
+
+	// If the queue exceeds the threshold, drop the frame.
+	if (_input_buffer.IsThresholdExceeded() == false)
+	{
+		_fps_filter.Push(media_frame);
+	}
+
+	while (auto frame = _fps_filter.Pop())
+	{
+		if ((PushProcess(frame) == false) || (PopProcess() == false))
+		{
+			break;
+		}
+	}
+
+	ReportRungStats();
+}
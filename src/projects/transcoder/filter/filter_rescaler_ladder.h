@@ -0,0 +1,111 @@
+//==============================================================================
+//
+//  Transcode
+//
+//  Created by Kwon Keuk Han
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include "../transcoder_context.h"
+#include "base/mediarouter/media_buffer.h"
+#include "base/mediarouter/media_type.h"
+#include "filter_base.h"
+#include "filter_fps.h"
+
+// Rescales a decoded frame to all renditions of an ABR ladder in a single filter graph.
+//
+// The rungs are sorted by resolution, and each rung is scaled from the next larger one
+// (e.g. 1080p -> 720p -> 480p -> 360p) instead of from the full-resolution frame:
+//
+//   [in] scale(720p), split [r0][c0]
+//   [r0] settb, format [out0]
+//   [c0] scale(480p), split [r1][c1]
+//   ...
+//
+// All rungs share one input queue, one filter task and the thread pool of the filter graph.
+// Only software scaling is supported (see IsSupported()), and all rungs must have the same framerate settings.
+class FilterRescalerLadder : public FilterBase
+{
+public:
+	typedef std::function<void(size_t rung_index, std::shared_ptr<MediaFrame>)> RungCompleteHandler;
+
+	struct RungStats
+	{
+		int32_t width = 0;
+		int32_t height = 0;
+		uint64_t frame_count = 0;
+		// Time from feeding a frame to the graph until the frame of this rung is output
+		int64_t total_latency_us = 0;
+		int64_t max_latency_us = 0;
+
+		double GetAverageLatencyUs() const
+		{
+			return (frame_count > 0) ? (static_cast<double>(total_latency_us) / frame_count) : 0.0;
+		}
+	};
+
+	FilterRescalerLadder();
+	~FilterRescalerLadder();
+
+	// Whether the output track can be a rung of the ladder
+	static bool IsSupported(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track);
+
+	// Must be called before Start(). The index of the output track is passed to RungCompleteHandler.
+	void SetOutputTracks(const std::vector<std::shared_ptr<MediaTrack>> &output_tracks);
+	void SetRungCompleteHandler(RungCompleteHandler handler);
+
+	bool Configure(const std::shared_ptr<MediaTrack> &input_track, const std::shared_ptr<MediaTrack> &output_track) override;
+	bool Start() override;
+	void Stop() override;
+
+	// Stats of the last report interval (indexed by the output track index)
+	std::vector<RungStats> GetRungStats();
+
+private:
+	struct Rung
+	{
+		// Index in the list passed to SetOutputTracks()
+		size_t output_index = 0;
+		std::shared_ptr<MediaTrack> output_track;
+		AVFilterContext *buffersink_ctx = nullptr;
+
+		RungStats stats;
+	};
+
+	bool InitializeSourceFilter();
+	bool InitializeFilterDescription();
+	bool InitializeSinkFilters();
+
+	// Rescales a frame to all rungs and outputs the frames available in the filter graph
+	void ProcessFrame(std::shared_ptr<MediaFrame> media_frame);
+	bool PushProcess(std::shared_ptr<MediaFrame> media_frame);
+	bool PopProcess(bool is_flush = false);
+
+	void UpdateSkipFrames();
+	void ReportRungStats();
+
+	std::vector<std::shared_ptr<MediaTrack>> _output_tracks;
+
+	// Sorted by resolution in descending order
+	std::vector<Rung> _rungs;
+
+	RungCompleteHandler _rung_complete_handler;
+
+	// Time when the last frame was fed to the graph
+	std::chrono::steady_clock::time_point _push_time;
+
+	std::mutex _rung_stats_mutex;
+	std::vector<RungStats> _last_rung_stats;
+	std::chrono::steady_clock::time_point _last_report_time;
+
+	// Constant FrameRate & SkipFrame Filter (shared by all rungs)
+	FilterFps _fps_filter;
+
+	int32_t _skip_frames = 0;
+	size_t _skip_frames_previous_queue_size = 0;
+	int64_t _skip_frames_last_check_time = 0;
+	int64_t _skip_frames_last_changed_time = 0;
+};
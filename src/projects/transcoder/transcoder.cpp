@@ -17,6 +17,7 @@
 #include "transcoder.h"
 #include "transcoder_gpu.h"
 #include "transcoder_private.h"
+#include "transcoder_scheduler.h"
 
 std::shared_ptr<Transcoder> Transcoder::Create(std::shared_ptr<MediaRouterInterface> router)
 {
@@ -42,6 +43,17 @@ bool Transcoder::Start()
 
 	TranscodeGPU::GetInstance()->Initialize();
 
+	auto scheduler_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscodeScheduler();
+	if (scheduler_config.IsEnabled())
+	{
+		// If the scheduler cannot be started, the decoders/filters/encoders run on dedicated threads
+		TranscodeScheduler::GetInstance()->Start(
+			std::max(scheduler_config.GetDecoderWorkerCount(), 0),
+			std::max(scheduler_config.GetFilterWorkerCount(), 0),
+			std::max(scheduler_config.GetEncoderWorkerCount(), 0),
+			scheduler_config.IsNumaAffinityEnabled());
+	}
+
 	return true;
 }
 
@@ -49,6 +61,8 @@ bool Transcoder::Stop()
 {
 	logtd("Transcoder has been stopped");
 
+	TranscodeScheduler::GetInstance()->Stop();
+
 	TranscodeGPU::GetInstance()->Uninitialize();
 
 	return true;
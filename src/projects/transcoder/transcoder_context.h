@@ -13,6 +13,7 @@
 #include <stdint.h>
 
 #include "base/mediarouter/media_type.h"
+#include "transcoder_frame_pool.h"
 extern "C"
 {
 #include <libavformat/avformat.h>
@@ -202,21 +203,17 @@ public:
 	}
 
 	// This function should only be called before filtering 
+	// deep_copy: false - The clone references the same data (reference counted), so it must not be written.
+	//            true - The data is copied to a buffer of TranscodeFramePool, so the clone is writable.
 	std::shared_ptr<MediaFrame> CloneFrame(bool deep_copy = false)
 	{
 		auto frame = std::make_shared<MediaFrame>();
 
 		if(_priv_data != nullptr)
 		{
-			// Create a new frame that references the same data as src
-			auto clone_priv_data = ::av_frame_clone(_priv_data);
+			auto clone_priv_data = (deep_copy == true) ? TranscodeFramePool::GetInstance()->CopyFrame(_priv_data) : ::av_frame_clone(_priv_data);
 			if (clone_priv_data != nullptr)
 			{
-				if (deep_copy == true)
-				{
-					::av_frame_make_writable(clone_priv_data);
-				}
-
 				frame->SetPrivData(clone_priv_data);
 			}
 		}
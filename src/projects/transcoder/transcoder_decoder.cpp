@@ -138,6 +138,7 @@ std::shared_ptr<std::vector<std::shared_ptr<CodecCandidate>>> TranscodeDecoder::
 		{                                                  \
 			break;                                         \
 		}                                                  \
+		track->SetCodecModuleId(candidate->GetModuleId()); \
 		track->SetCodecDeviceId(candidate->GetDeviceId()); \
 		if (decoder->Configure(track) == true)             \
 		{                                                  \
@@ -334,19 +335,22 @@ bool TranscodeDecoder::Configure(std::shared_ptr<MediaTrack> track)
 
 	_kill_flag = false;
 
-	try
-	{
-		_codec_thread = std::thread(&TranscodeDecoder::CodecThread, this);
-		pthread_setname_np(_codec_thread.native_handle(), ov::String::FormatString("DEC-%s-t%u", avcodec_get_name(GetCodecID()), _track->GetId()).CStr());
-
-		// Initialize the codec and wait for completion.
-		if (_codec_init_event.Get() == false)
+	auto thread_name = ov::String::FormatString("DEC-%s-t%u", avcodec_get_name(GetCodecID()), _track->GetId());
+	auto init_handler = [this]() -> bool {
+		return InitCodec();
+	};
+	auto process_handler = [this](int timeout_ms) -> bool {
+		auto obj = _input_buffer.Dequeue(timeout_ms);
+		if (obj.has_value())
 		{
-			_kill_flag = true;
-			return false;
+			DecodePacket(std::move(obj.value()));
 		}
-	}
-	catch (const std::system_error &e)
+
+		return true;
+	};
+
+	// Initialize the codec and wait for completion.
+	if (_worker.Start(TranscodeScheduler::Stage::Decoder, thread_name, TranscodeScheduler::IsSchedulable(_track->GetCodecModuleId()), init_handler, process_handler) == false)
 	{
 		_kill_flag = true;
 		return false;
@@ -361,17 +365,16 @@ void TranscodeDecoder::Stop()
 
 	_input_buffer.Stop();
 
-	if (_codec_thread.joinable())
-	{
-		_codec_thread.join();
+	_worker.Stop();
 
-		logtd(ov::String::FormatString("decoder %s thread has ended", avcodec_get_name(GetCodecID())).CStr());
-	}
+	logtd(ov::String::FormatString("decoder %s has ended", avcodec_get_name(GetCodecID())).CStr());
 }
 
 void TranscodeDecoder::SendBuffer(std::shared_ptr<const MediaPacket> packet)
 {
 	_input_buffer.Enqueue(std::move(packet));
+
+	_worker.Notify();
 }
 
 void TranscodeDecoder::SetCompleteHandler(CompleteHandler complete_handler)
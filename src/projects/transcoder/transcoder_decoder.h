@@ -10,6 +10,7 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_scheduler.h"
 
 class TranscodeDecoder : public TranscodeBase<MediaPacket, MediaFrame>
 {
@@ -32,7 +33,9 @@ public:
 	bool Configure(std::shared_ptr<MediaTrack> track) override;
 	void SendBuffer(std::shared_ptr<const MediaPacket> packet) override;
 
-	virtual void CodecThread() = 0;
+	virtual bool InitCodec() = 0;
+	// Decodes a packet from the input buffer, and calls Complete() for each decoded frame
+	virtual void DecodePacket(std::shared_ptr<const MediaPacket> packet) = 0;
 	virtual void Stop();
 
 protected:
@@ -46,15 +49,14 @@ protected:
 	AVCodecParserContext *_parser = nullptr;
 	AVCodecParameters *_codec_par = nullptr;
 
-	ov::Future _codec_init_event;
-
 	bool _change_format = false;
 
 	AVPacket *_pkt;
 	AVFrame *_frame;
 
 	bool _kill_flag = false;
-	std::thread _codec_thread;
+	// Runs DecodePacket() on TranscodeScheduler or on a dedicated thread
+	TranscodeStageWorker _worker;
 
 	CompleteHandler _complete_handler;
 };
@@ -8,6 +8,7 @@
 //==============================================================================
 #include "transcoder_encoder.h"
 
+#include <cinttypes>
 #include <utility>
 
 #include "codec/encoder/encoder_avc_x264.h"
@@ -160,6 +161,7 @@ std::shared_ptr<std::vector<std::shared_ptr<CodecCandidate>>> TranscodeEncoder::
 		{ \
 			break; \
 		} \
+		track->SetCodecModuleId(candidate->GetModuleId()); \
 		track->SetCodecDeviceId(candidate->GetDeviceId()); \
 		if (encoder->Configure(track) == true) \
 		{ \
@@ -343,7 +345,8 @@ bool TranscodeEncoder::Configure(std::shared_ptr<MediaTrack> output_track)
 
 	// This is used to prevent the from creating frames from rescaler/resampler filter. 
 	// Because of hardware resource limitations.
-	_input_buffer.SetExceedWaitEnable(true);
+	// A filter on a scheduler worker must not wait in the input buffer, so it is held by _backpressure instead.
+	_input_buffer.SetExceedWaitEnable(TranscodeScheduler::GetInstance()->IsRunning() == false);
 
 	// SkipMessage is enabled due to the high possibility of queue overflow due to insufficient video encoding performance.
 	// Users will not experience any inconvenience even if the video is intermittently missing.
@@ -374,6 +377,14 @@ void TranscodeEncoder::SendBuffer(std::shared_ptr<const MediaFrame> frame)
 	{
 		_input_buffer.Enqueue(std::move(frame));
 	}
+
+	_worker.Notify();
+
+	if (_input_buffer.IsExceedWaitEnable() == false)
+	{
+		// The frame is not dropped even if the input buffer is full - the filter is held until the encoder catches up
+		_backpressure.Hold(1000);
+	}
 }
 
 void TranscodeEncoder::SetCompleteHandler(CompleteHandler complete_handler)
@@ -394,12 +405,11 @@ void TranscodeEncoder::Stop()
 	_kill_flag = true;
 
 	_input_buffer.Stop();
+	_backpressure.Stop();
 
-	if (_codec_thread.joinable())
-	{
-		_codec_thread.join();
-		logtd(ov::String::FormatString("encoder %s thread has ended", avcodec_get_name(GetCodecID())).CStr());
-	}
+	_worker.Stop();
+
+	logtd(ov::String::FormatString("encoder %s has ended", avcodec_get_name(GetCodecID())).CStr());
 }
 
 bool TranscodeEncoder::InitCodecInteral()
@@ -528,12 +538,40 @@ bool TranscodeEncoder::PopProcess()
 	return true;
 }
 
-void TranscodeEncoder::CodecThread()
+bool TranscodeEncoder::StartCodec(const ov::String &thread_name)
+{
+	_kill_flag = false;
+
+	auto init_handler = [this]() -> bool {
+		return PrepareCodec();
+	};
+	auto process_handler = [this](int timeout_ms) -> bool {
+		auto obj = _input_buffer.Dequeue(timeout_ms);
+		if (obj.has_value() == false)
+		{
+			return true;
+		}
+
+		_backpressure.Release();
+
+		return EncodeFrame(std::move(obj.value()));
+	};
+
+	// Initialize the codec and wait for completion.
+	if (_worker.Start(TranscodeScheduler::Stage::Encoder, thread_name, TranscodeScheduler::IsSchedulable(GetRefTrack()->GetCodecModuleId()), init_handler, process_handler) == false)
+	{
+		_kill_flag = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool TranscodeEncoder::PrepareCodec()
 {
-	// Initialize the codec and notify the main thread.
-	if(_codec_init_event.Submit(InitCodecInteral()) == false)
+	if (InitCodecInteral() == false)
 	{
-		return;
+		return false;
 	}
 
 	// Initialize for force keyframe by time interval.
@@ -548,64 +586,58 @@ void TranscodeEncoder::CodecThread()
 		_accumulate_frame_duration = -1;
 	}
 
-	[[maybe_unused]] 
-	int32_t curr_source_id = 0;
-
-	while (!_kill_flag)
-	{
-		auto obj = _input_buffer.Dequeue();
-		if (obj.has_value() == false)
-			continue;
-
-		auto media_frame = std::move(obj.value());
+	return true;
+}
 
+bool TranscodeEncoder::EncodeFrame(std::shared_ptr<const MediaFrame> media_frame)
+{
 #ifdef HWACCELS_XMA_ENABLED
-		///////////////////////////////////////////////////
-		// Recreate the codec context if the source id is changed.
-		// Xilinx VCU does not support frame buffer sharing between xvbm multi sclaler filter.
-		///////////////////////////////////////////////////
-		if (GetSupportedFormat() == AV_PIX_FMT_XVBM_8)
+	///////////////////////////////////////////////////
+	// Recreate the codec context if the source id is changed.
+	// Xilinx VCU does not support frame buffer sharing between xvbm multi sclaler filter.
+	///////////////////////////////////////////////////
+	if (GetSupportedFormat() == AV_PIX_FMT_XVBM_8)
+	{
+		if (_last_source_id != media_frame->GetSourceId() && _last_source_id != 0)
 		{
-			if (curr_source_id != media_frame->GetSourceId() && curr_source_id != 0)
+			///////////////////////////////////////////////////
+			// Flush encoder
+			///////////////////////////////////////////////////
+			if (PushProcess(nullptr) == true)
 			{
-				///////////////////////////////////////////////////
-				// Flush encoder
-				///////////////////////////////////////////////////
-				if (PushProcess(nullptr) == true)
+				while (PopProcess() == true && !_kill_flag)
 				{
-					while (PopProcess() == true && !_kill_flag)
-					{
-					}
 				}
+			}
 
-				///////////////////////////////////////////////////
-				// Reinit codec
-				///////////////////////////////////////////////////
-				DeinitCodec();
+			///////////////////////////////////////////////////
+			// Reinit codec
+			///////////////////////////////////////////////////
+			DeinitCodec();
 
-				if (InitCodecInteral() == false)
-				{
-					break;
-				}
+			if (InitCodecInteral() == false)
+			{
+				return false;
 			}
-			curr_source_id = media_frame->GetSourceId();
 		}
+		_last_source_id = media_frame->GetSourceId();
+	}
 #endif
 
-		///////////////////////////////////////////////////
-		// Request frame encoding to codec
-		///////////////////////////////////////////////////
-		if(PushProcess(media_frame) == false)
-		{
-			break;
-		}
+	///////////////////////////////////////////////////
+	// Request frame encoding to codec
+	///////////////////////////////////////////////////
+	if(PushProcess(media_frame) == false)
+	{
+		return false;
+	}
 
-		///////////////////////////////////////////////////
-		// The encoded packet is taken from the codec.
-		///////////////////////////////////////////////////
-		while (PopProcess() == true && !_kill_flag)
-		{
-		}
+	///////////////////////////////////////////////////
+	// The encoded packet is taken from the codec.
+	///////////////////////////////////////////////////
+	while (PopProcess() == true && !_kill_flag)
+	{
 	}
-}
 
+	return true;
+}
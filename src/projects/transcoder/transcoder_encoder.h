@@ -10,6 +10,7 @@
 
 #include "base/info/stream.h"
 #include "codec/codec_base.h"
+#include "transcoder_scheduler.h"
 
 class TranscodeEncoder : public TranscodeBase<MediaFrame, MediaPacket>
 {
@@ -35,7 +36,13 @@ public:
 	virtual bool InitCodec() = 0;
 	virtual void DeinitCodec();
 	virtual bool SetCodecParams() = 0;	
-	virtual void CodecThread();
+
+	// Initializes the codec and starts to encode the input frames on TranscodeScheduler or on a dedicated thread
+	bool StartCodec(const ov::String &thread_name);
+	// Initializes the codec before the first frame
+	virtual bool PrepareCodec();
+	// Encodes a frame from the input buffer. Returns false if the codec can no longer be used
+	virtual bool EncodeFrame(std::shared_ptr<const MediaFrame> media_frame);
 
 	virtual void Stop();
 
@@ -56,8 +63,6 @@ protected:
 	AVCodecContext *_codec_context = nullptr;
 	AVCodecParameters *_codec_par = nullptr;
 
-	ov::Future _codec_init_event;
-
 	bool _change_format = false;
 
 	AVPacket *_packet = nullptr;
@@ -66,7 +71,16 @@ protected:
 	cmn::PacketType _packet_type = cmn::PacketType::Unknown;
 
 	bool _kill_flag = false;
-	std::thread _codec_thread;
+	// Runs EncodeFrame() on TranscodeScheduler or on a dedicated thread
+	TranscodeStageWorker _worker;
+
+	// Holds the filters while the input buffer is full (used when the scheduler is running)
+	TranscodeBackpressure _backpressure{[this]() -> bool {
+		return _input_buffer.GetSize() >= _input_buffer.GetThreshold();
+	}};
+
+	// Source id of the last frame (used to recreate the XMA codec)
+	int32_t _last_source_id = 0;
 
 	CompleteHandler _complete_handler;
 
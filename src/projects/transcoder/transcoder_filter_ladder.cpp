@@ -0,0 +1,265 @@
+#include "transcoder_filter_ladder.h"
+
+#include "transcoder_private.h"
+
+#define PTS_INCREMENT_LIMIT 15
+
+std::mutex TranscodeFilterLadder::_ladders_mutex;
+std::vector<TranscodeFilterLadder *> TranscodeFilterLadder::_ladders;
+
+TranscodeFilterLadder::TranscodeFilterLadder()
+	: _internal(nullptr)
+{
+}
+
+TranscodeFilterLadder::~TranscodeFilterLadder()
+{
+	std::lock_guard lock_guard(_ladders_mutex);
+	_ladders.erase(std::remove(_ladders.begin(), _ladders.end(), this), _ladders.end());
+}
+
+std::shared_ptr<TranscodeFilterLadder> TranscodeFilterLadder::Create(
+	const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+	const std::vector<Rung> &rungs,
+	CompleteHandler complete_handler)
+{
+	auto ladder = std::make_shared<TranscodeFilterLadder>();
+	ladder->SetCompleteHandler(complete_handler);
+	if (ladder->Configure(input_stream_info, input_track, rungs) == false)
+	{
+		return nullptr;
+	}
+	return ladder;
+}
+
+bool TranscodeFilterLadder::Configure(
+	const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+	const std::vector<Rung> &rungs)
+{
+	_input_stream_info = input_stream_info;
+	_input_track = input_track;
+	_rungs = rungs;
+
+	_timestamp_jump_threshold = (int64_t)_input_track->GetTimeBase().GetTimescale() * PTS_INCREMENT_LIMIT;
+
+	{
+		// Registered after the members above are set, since GetStats() reads them
+		std::lock_guard lock_guard(_ladders_mutex);
+
+		if (std::find(_ladders.begin(), _ladders.end(), this) == _ladders.end())
+		{
+			_ladders.push_back(this);
+		}
+	}
+
+	return CreateInternal();
+}
+
+bool TranscodeFilterLadder::CreateInternal()
+{
+	std::lock_guard<std::shared_mutex> lock(_mutex);
+
+	// If there is a previously created filter, remove it.
+	if (_internal != nullptr)
+	{
+		_internal->Stop();
+		_internal.reset();
+		_internal = nullptr;
+	}
+
+	std::vector<std::shared_ptr<MediaTrack>> output_tracks;
+	for (const auto &rung : _rungs)
+	{
+		output_tracks.push_back(rung.output_track);
+	}
+
+	_internal = std::make_shared<FilterRescalerLadder>();
+
+	auto urn = std::make_shared<info::ManagedQueue::URN>(
+		_input_stream_info->GetApplicationName(),
+		_input_stream_info->GetName(),
+		"trs",
+		"filter_ladder");
+	_internal->SetQueueUrn(urn);
+	_internal->SetRungCompleteHandler(bind(&TranscodeFilterLadder::OnComplete, this, std::placeholders::_1, std::placeholders::_2));
+	_internal->SetInputTrack(_input_track);
+	_internal->SetOutputTrack(output_tracks[0]);
+	_internal->SetOutputTracks(output_tracks);
+
+	return _internal->Start();
+}
+
+void TranscodeFilterLadder::Stop()
+{
+	std::lock_guard<std::shared_mutex> lock(_mutex);
+
+	if (_internal != nullptr)
+	{
+		_internal->Stop();
+		_internal.reset();
+		_internal = nullptr;
+	}
+}
+
+bool TranscodeFilterLadder::SendBuffer(std::shared_ptr<MediaFrame> buffer)
+{
+	if (IsNeedUpdate(buffer) == true)
+	{
+		if (CreateInternal() == false)
+		{
+			logte("Failed to regenerate ladder filter");
+			return false;
+		}
+
+		return true;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+	if (_internal == nullptr)
+	{
+		return false;
+	}
+
+	return _internal->SendBuffer(std::move(buffer));
+}
+
+bool TranscodeFilterLadder::IsNeedUpdate(std::shared_ptr<MediaFrame> buffer)
+{
+	// In case of pts/dts jumps
+	int64_t last_timestamp = _last_timestamp;
+	int64_t curr_timestamp = buffer->GetPts();
+	_last_timestamp = curr_timestamp;
+
+	// Check #1 - Abnormal timestamp
+	int64_t increment = abs(curr_timestamp - last_timestamp);
+	if (last_timestamp != -1LL && increment > _timestamp_jump_threshold)
+	{
+		logtw("Timestamp has changed abnormally.  %lld -> %lld", last_timestamp, buffer->GetPts());
+
+		return true;
+	}
+
+	// Check #2 - Resolution change
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	if (_internal == nullptr)
+	{
+		return false;
+	}
+
+	if (buffer->GetWidth() != (int32_t)_internal->GetInputWidth() ||
+		buffer->GetHeight() != (int32_t)_internal->GetInputHeight())
+	{
+		logti("Changed input resolution of %u track. (%dx%d -> %dx%d)", _input_track->GetId(), _internal->GetInputWidth(), _internal->GetInputHeight(), buffer->GetWidth(), buffer->GetHeight());
+
+		_input_track->SetWidth(buffer->GetWidth());
+		_input_track->SetHeight(buffer->GetHeight());
+
+		return true;
+	}
+
+	return false;
+}
+
+bool TranscodeFilterLadder::HasFilter(MediaTrackId filter_id) const
+{
+	for (const auto &rung : _rungs)
+	{
+		if (rung.filter_id == filter_id)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const std::vector<TranscodeFilterLadder::Rung> &TranscodeFilterLadder::GetRungs() const
+{
+	return _rungs;
+}
+
+std::shared_ptr<MediaTrack> &TranscodeFilterLadder::GetInputTrack()
+{
+	return _input_track;
+}
+
+std::vector<FilterRescalerLadder::RungStats> TranscodeFilterLadder::GetRungStats()
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	if (_internal == nullptr)
+	{
+		return {};
+	}
+
+	return _internal->GetRungStats();
+}
+
+TranscodeFilterLadderStats TranscodeFilterLadder::GetStats()
+{
+	TranscodeFilterLadderStats stats;
+
+	stats.app_name = _input_stream_info->GetApplicationName();
+	stats.stream_name = _input_stream_info->GetName();
+	stats.input_track_id = _input_track->GetId();
+
+	auto rung_stats_list = GetRungStats();
+
+	for (size_t index = 0; index < _rungs.size(); index++)
+	{
+		auto &rung = _rungs[index];
+		TranscodeFilterLadderStats::Rung rung_stats;
+
+		rung_stats.filter_id = rung.filter_id;
+		rung_stats.output_track_id = rung.output_track->GetId();
+
+		if (index < rung_stats_list.size())
+		{
+			auto &rung_stat = rung_stats_list[index];
+
+			rung_stats.width = rung_stat.width;
+			rung_stats.height = rung_stat.height;
+			rung_stats.frame_count = rung_stat.frame_count;
+			rung_stats.average_latency_us = rung_stat.GetAverageLatencyUs();
+			rung_stats.max_latency_us = rung_stat.max_latency_us;
+		}
+
+		stats.rungs.push_back(rung_stats);
+	}
+
+	return stats;
+}
+
+std::vector<TranscodeFilterLadderStats> TranscodeFilterLadderStats::GetAll()
+{
+	std::vector<TranscodeFilterLadderStats> stats_list;
+
+	// The ladder cannot be destroyed while the lock is held, because the destructor removes it from the list first
+	std::lock_guard lock_guard(TranscodeFilterLadder::_ladders_mutex);
+
+	for (auto ladder : TranscodeFilterLadder::_ladders)
+	{
+		auto stats = ladder->GetStats();
+
+		if (stats.rungs.empty() == false)
+		{
+			stats_list.push_back(std::move(stats));
+		}
+	}
+
+	return stats_list;
+}
+
+void TranscodeFilterLadder::SetCompleteHandler(CompleteHandler complete_handler)
+{
+	_complete_handler = std::move(complete_handler);
+}
+
+void TranscodeFilterLadder::OnComplete(size_t rung_index, std::shared_ptr<MediaFrame> frame)
+{
+	if ((_complete_handler != nullptr) && (rung_index < _rungs.size()))
+	{
+		_complete_handler(_rungs[rung_index].filter_id, frame);
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <base/mediarouter/media_buffer.h>
+#include <base/mediarouter/media_type.h>
+
+#include <stdint.h>
+
+#include "base/info/stream.h"
+#include "filter/filter_rescaler_ladder.h"
+#include "transcoder_context.h"
+#include "transcoder_filter_ladder_stats.h"
+
+// Video filters of one decoder that share a FilterRescalerLadder
+//
+// Each rung is identified by its filter id, like TranscodeFilter, so the outputs are
+// delivered to the same OnFilteredFrame() callback as the other filters.
+class TranscodeFilterLadder
+{
+public:
+	typedef std::function<void(int32_t, std::shared_ptr<MediaFrame>)> CompleteHandler;
+
+	struct Rung
+	{
+		MediaTrackId filter_id;
+		std::shared_ptr<MediaTrack> output_track;
+	};
+
+	static std::shared_ptr<TranscodeFilterLadder> Create(
+		const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+		const std::vector<Rung> &rungs,
+		CompleteHandler complete_handler);
+
+public:
+	TranscodeFilterLadder();
+	~TranscodeFilterLadder();
+
+	bool Configure(
+		const std::shared_ptr<info::Stream> &input_stream_info, std::shared_ptr<MediaTrack> input_track,
+		const std::vector<Rung> &rungs);
+	bool SendBuffer(std::shared_ptr<MediaFrame> buffer);
+	void Stop();
+
+	bool HasFilter(MediaTrackId filter_id) const;
+	const std::vector<Rung> &GetRungs() const;
+	std::shared_ptr<MediaTrack> &GetInputTrack();
+
+	// Latency of each rung (in the order of GetRungs())
+	std::vector<FilterRescalerLadder::RungStats> GetRungStats();
+
+	void SetCompleteHandler(CompleteHandler complete_handler);
+	void OnComplete(size_t rung_index, std::shared_ptr<MediaFrame> frame);
+
+private:
+	friend struct TranscodeFilterLadderStats;
+
+	TranscodeFilterLadderStats GetStats();
+
+	bool CreateInternal();
+	bool IsNeedUpdate(std::shared_ptr<MediaFrame> buffer);
+
+	int64_t _last_timestamp = -1LL;
+	int64_t _timestamp_jump_threshold = 0LL;
+
+	std::shared_ptr<info::Stream> _input_stream_info;
+	std::shared_ptr<MediaTrack> _input_track;
+	std::vector<Rung> _rungs;
+
+	CompleteHandler _complete_handler;
+
+	std::shared_mutex _mutex;
+	std::shared_ptr<FilterRescalerLadder> _internal;
+
+	// All ladders (used to collect the stats)
+	static std::mutex _ladders_mutex;
+	static std::vector<TranscodeFilterLadder *> _ladders;
+};
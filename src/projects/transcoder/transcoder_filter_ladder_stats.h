@@ -0,0 +1,44 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <vector>
+
+// Stats of a running TranscodeFilterLadder
+//
+// Declared without the FFmpeg headers, so the API server can include it
+struct TranscodeFilterLadderStats
+{
+	struct Rung
+	{
+		MediaTrackId filter_id = 0;
+		MediaTrackId output_track_id = 0;
+		int32_t width = 0;
+		int32_t height = 0;
+
+		// Values of the last report interval
+		uint64_t frame_count = 0;
+		// Time from feeding a frame to the graph until the frame of this rung is output
+		double average_latency_us = 0.0;
+		int64_t max_latency_us = 0;
+	};
+
+	// VHost/App name
+	ov::String app_name;
+	ov::String stream_name;
+	MediaTrackId input_track_id = 0;
+
+	std::vector<Rung> rungs;
+
+	// Stats of all ladders (defined in transcoder_filter_ladder.cpp)
+	static std::vector<TranscodeFilterLadderStats> GetAll();
+};
@@ -0,0 +1,229 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_frame_pool.h"
+
+#include <base/mediarouter/media_type.h>
+
+#include <algorithm>
+
+#include "transcoder_private.h"
+
+extern "C"
+{
+#include <libavcodec/avcodec.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/samplefmt.h>
+}
+
+// Alignment of the line size of the pooled video frames (same as av_frame_get_buffer() for AVX-512)
+#define TRANSCODE_FRAME_POOL_ALIGN 64
+
+TranscodeFramePool::~TranscodeFramePool()
+{
+	std::lock_guard<std::mutex> lock(_pools_mutex);
+
+	for (auto &item : _pools)
+	{
+		// The pool is freed when all the buffers are returned
+		::av_buffer_pool_uninit(&item.second.pool);
+	}
+
+	_pools.clear();
+}
+
+AVBufferRef *TranscodeFramePool::GetBuffer(const PoolKey &key, size_t buffer_size)
+{
+	std::lock_guard<std::mutex> lock(_pools_mutex);
+
+	auto now = ov::Time::GetTimestampInMs();
+
+	auto it = _pools.find(key);
+	if ((it != _pools.end()) && (it->second.buffer_size != buffer_size))
+	{
+		::av_buffer_pool_uninit(&it->second.pool);
+		_pools.erase(it);
+		it = _pools.end();
+	}
+
+	if (it == _pools.end())
+	{
+		if (_pools.size() >= TRANSCODE_FRAME_POOL_MAX_POOLS)
+		{
+			// Release the least recently used pool (e.g. the resolution of the stream has changed)
+			auto lru = std::min_element(_pools.begin(), _pools.end(), [](const auto &a, const auto &b) {
+				return a.second.last_used_time < b.second.last_used_time;
+			});
+
+			::av_buffer_pool_uninit(&lru->second.pool);
+			_pools.erase(lru);
+		}
+
+		Pool pool;
+		pool.pool = ::av_buffer_pool_init(buffer_size, nullptr);
+		pool.buffer_size = buffer_size;
+		if (pool.pool == nullptr)
+		{
+			logte("Could not create a frame buffer pool. size(%zu)", buffer_size);
+			return nullptr;
+		}
+
+		logtd("Frame buffer pool has been created. type(%d) format(%d) size(%dx%d) buffer(%zu bytes) pools(%zu)",
+			  std::get<0>(key), std::get<1>(key), std::get<2>(key), std::get<3>(key), buffer_size, _pools.size() + 1);
+
+		it = _pools.emplace(key, pool).first;
+	}
+
+	it->second.last_used_time = now;
+
+	return ::av_buffer_pool_get(it->second.pool);
+}
+
+AVFrame *TranscodeFramePool::AllocateVideoFrame(int32_t format, int32_t width, int32_t height)
+{
+	auto pix_fmt = static_cast<AVPixelFormat>(format);
+
+	// Fails for the hardware pixel formats
+	int size = ::av_image_get_buffer_size(pix_fmt, width, height, TRANSCODE_FRAME_POOL_ALIGN);
+	if (size <= 0)
+	{
+		return nullptr;
+	}
+
+	auto buffer = GetBuffer(PoolKey(static_cast<int32_t>(cmn::MediaType::Video), format, width, height), size + AV_INPUT_BUFFER_PADDING_SIZE);
+	if (buffer == nullptr)
+	{
+		return nullptr;
+	}
+
+	AVFrame *frame = ::av_frame_alloc();
+	if (frame == nullptr)
+	{
+		::av_buffer_unref(&buffer);
+		return nullptr;
+	}
+
+	frame->format = format;
+	frame->width = width;
+	frame->height = height;
+
+	if (::av_image_fill_arrays(frame->data, frame->linesize, buffer->data, pix_fmt, width, height, TRANSCODE_FRAME_POOL_ALIGN) < 0)
+	{
+		::av_buffer_unref(&buffer);
+		::av_frame_free(&frame);
+		return nullptr;
+	}
+
+	frame->buf[0] = buffer;
+	frame->extended_data = frame->data;
+
+	return frame;
+}
+
+AVFrame *TranscodeFramePool::AllocateAudioFrame(int32_t format, int32_t nb_samples, int32_t channels, uint64_t channel_layout, int32_t sample_rate)
+{
+	auto sample_fmt = static_cast<AVSampleFormat>(format);
+
+	AVFrame *frame = ::av_frame_alloc();
+	if (frame == nullptr)
+	{
+		return nullptr;
+	}
+
+	frame->format = format;
+	frame->nb_samples = nb_samples;
+	frame->channels = channels;
+	frame->channel_layout = channel_layout;
+	frame->sample_rate = sample_rate;
+
+	int planes = ::av_sample_fmt_is_planar(sample_fmt) ? channels : 1;
+	if (planes > AV_NUM_DATA_POINTERS)
+	{
+		// The planes do not fit in AVFrame::data, so the buffers must be allocated by FFmpeg
+		if (::av_frame_get_buffer(frame, 0) < 0)
+		{
+			::av_frame_free(&frame);
+			return nullptr;
+		}
+
+		return frame;
+	}
+
+	int size = ::av_samples_get_buffer_size(nullptr, channels, nb_samples, sample_fmt, 0);
+	if (size <= 0)
+	{
+		::av_frame_free(&frame);
+		return nullptr;
+	}
+
+	auto buffer = GetBuffer(PoolKey(static_cast<int32_t>(cmn::MediaType::Audio), format, nb_samples, channels), size + AV_INPUT_BUFFER_PADDING_SIZE);
+	if (buffer == nullptr)
+	{
+		::av_frame_free(&frame);
+		return nullptr;
+	}
+
+	if (::av_samples_fill_arrays(frame->data, &frame->linesize[0], buffer->data, channels, nb_samples, sample_fmt, 0) < 0)
+	{
+		::av_buffer_unref(&buffer);
+		::av_frame_free(&frame);
+		return nullptr;
+	}
+
+	frame->buf[0] = buffer;
+	frame->extended_data = frame->data;
+
+	return frame;
+}
+
+AVFrame *TranscodeFramePool::CopyFrame(const AVFrame *src)
+{
+	if (src == nullptr)
+	{
+		return nullptr;
+	}
+
+	// The data of the hardware frames is in the device memory
+	if (src->hw_frames_ctx != nullptr)
+	{
+		return ::av_frame_clone(src);
+	}
+
+	AVFrame *dst = nullptr;
+
+	if ((src->width > 0) && (src->height > 0))
+	{
+		dst = AllocateVideoFrame(src->format, src->width, src->height);
+	}
+	else if (src->nb_samples > 0)
+	{
+		dst = AllocateAudioFrame(src->format, src->nb_samples, src->channels, src->channel_layout, src->sample_rate);
+	}
+
+	if (dst == nullptr)
+	{
+		// Could not be pooled, make a writable copy without the pool
+		dst = ::av_frame_clone(src);
+		if (dst != nullptr)
+		{
+			::av_frame_make_writable(dst);
+		}
+
+		return dst;
+	}
+
+	if ((::av_frame_copy(dst, src) < 0) || (::av_frame_copy_props(dst, src) < 0))
+	{
+		logte("Could not copy the frame to the pooled frame. format(%d)", src->format);
+
+		::av_frame_free(&dst);
+		return nullptr;
+	}
+
+	return dst;
+}
@@ -0,0 +1,59 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+extern "C"
+{
+#include <libavutil/buffer.h>
+#include <libavutil/frame.h>
+}
+
+// Maximum number of buffer pools. If exceeded, the least recently used pool is released.
+#define TRANSCODE_FRAME_POOL_MAX_POOLS 64
+
+// Allocates the buffers of raw frames from AVBufferPools, one pool per (format, width, height) for video
+// and per (format, nb_samples, channels) for audio.
+//
+// The buffers are returned to the pool when the last reference of the frame is released,
+// so a writable copy of a frame reuses the memory of the previous copies instead of allocating a new one.
+class TranscodeFramePool : public ov::Singleton<TranscodeFramePool>
+{
+public:
+	~TranscodeFramePool() override;
+
+	// Returns nullptr if the frame could not be allocated. The caller must free the frame with av_frame_free().
+	AVFrame *AllocateVideoFrame(int32_t format, int32_t width, int32_t height);
+	AVFrame *AllocateAudioFrame(int32_t format, int32_t nb_samples, int32_t channels, uint64_t channel_layout, int32_t sample_rate);
+
+	// Allocates a frame of the same format from the pool, and copies the data and properties of src into it.
+	// Hardware frames are not pooled, so the returned frame references the data of src.
+	AVFrame *CopyFrame(const AVFrame *src);
+
+private:
+	// media type, format, width (or nb_samples), height (or channels)
+	using PoolKey = std::tuple<int32_t, int32_t, int32_t, int32_t>;
+
+	struct Pool
+	{
+		AVBufferPool *pool = nullptr;
+		size_t buffer_size = 0;
+		int64_t last_used_time = 0;
+	};
+
+	AVBufferRef *GetBuffer(const PoolKey &key, size_t buffer_size);
+
+	std::mutex _pools_mutex;
+	std::map<PoolKey, Pool> _pools;
+};
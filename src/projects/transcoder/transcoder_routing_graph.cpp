@@ -0,0 +1,89 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_routing_graph.h"
+
+#include "transcoder_private.h"
+
+static std::vector<TranscodeRoutingGraph::Output> ResolveOutputs(const TranscodeRoutingGraph::LinkOutputs &link_outputs)
+{
+	std::vector<TranscodeRoutingGraph::Output> outputs;
+	outputs.reserve(link_outputs.size());
+
+	for (auto &[output_stream, output_track_id] : link_outputs)
+	{
+		outputs.push_back({output_stream, output_track_id, output_stream->GetTrack(output_track_id)});
+	}
+
+	return outputs;
+}
+
+std::shared_ptr<const TranscodeRoutingGraph> TranscodeRoutingGraph::Build(
+	const std::shared_ptr<info::Stream> &input_stream,
+	const std::map<MediaTrackId, LinkOutputs> &input_to_outputs,
+	const std::map<MediaTrackId, MediaTrackId> &input_to_decoder,
+	const std::map<MediaTrackId, std::vector<MediaTrackId>> &decoder_to_filters,
+	const std::map<MediaTrackId, MediaTrackId> &filter_to_encoder,
+	const std::map<MediaTrackId, LinkOutputs> &encoder_to_outputs)
+{
+	auto graph = std::make_shared<TranscodeRoutingGraph>();
+
+	// InputTrack -> OutputTrack (Passthrough) or Decoder
+	std::vector<MediaTrackId> input_track_ids;
+	for (auto &item : input_to_outputs)
+	{
+		input_track_ids.push_back(item.first);
+	}
+	for (auto &item : input_to_decoder)
+	{
+		if (input_to_outputs.find(item.first) == input_to_outputs.end())
+		{
+			input_track_ids.push_back(item.first);
+		}
+	}
+
+	for (auto input_track_id : input_track_ids)
+	{
+		auto &route = graph->_inputs.Add(input_track_id);
+
+		route.input_track = input_stream->GetTrack(input_track_id);
+
+		auto outputs_it = input_to_outputs.find(input_track_id);
+		if (outputs_it != input_to_outputs.end())
+		{
+			route.bypass_outputs = ResolveOutputs(outputs_it->second);
+		}
+
+		auto decoder_it = input_to_decoder.find(input_track_id);
+		if (decoder_it != input_to_decoder.end())
+		{
+			route.has_decoder = true;
+			route.decoder_id = decoder_it->second;
+		}
+	}
+
+	// Decoder -> Filters
+	for (auto &[decoder_id, filter_ids] : decoder_to_filters)
+	{
+		graph->_decoders.Add(decoder_id).filter_ids = filter_ids;
+	}
+
+	// Filter -> Encoder
+	for (auto &[filter_id, encoder_id] : filter_to_encoder)
+	{
+		graph->_filters.Add(filter_id).encoder_id = encoder_id;
+	}
+
+	// Encoder -> OutputTracks
+	for (auto &[encoder_id, outputs] : encoder_to_outputs)
+	{
+		graph->_encoders.Add(encoder_id).outputs = ResolveOutputs(outputs);
+	}
+
+	return graph;
+}
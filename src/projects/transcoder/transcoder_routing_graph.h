@@ -0,0 +1,161 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/info/stream.h"
+#include "base/mediarouter/media_type.h"
+
+// Ids up to this value are resolved by direct indexing, larger ids (e.g. PID of MPEG-TS) by binary search
+#define TRANSCODE_ROUTING_MAX_DIRECT_ID 1024
+
+// Routes of a TranscoderStream compiled from its link maps (InputTrack -> Decoder -> Filter -> Encoder -> OutputTrack).
+//
+// The graph is immutable once built. TranscoderStream replaces it as a whole when the links or the tracks are changed,
+// so the packet and frame paths resolve a route with a few array indexings, without locks.
+class TranscodeRoutingGraph : public std::enable_shared_from_this<TranscodeRoutingGraph>
+{
+public:
+	using LinkOutputs = std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>;
+
+	struct Output
+	{
+		std::shared_ptr<info::Stream> stream;
+		MediaTrackId track_id = 0;
+		// nullptr if the track is not found in the stream
+		std::shared_ptr<MediaTrack> track;
+	};
+
+	struct InputRoute
+	{
+		std::shared_ptr<MediaTrack> input_track;
+
+		// Passthrough: InputTrack -> OutputTrack (N)
+		std::vector<Output> bypass_outputs;
+
+		// Transcoding: InputTrack -> Decoder (1)
+		bool has_decoder = false;
+		MediaTrackId decoder_id = 0;
+	};
+
+	struct DecoderRoute
+	{
+		// Decoder -> Filter (N)
+		std::vector<MediaTrackId> filter_ids;
+	};
+
+	struct FilterRoute
+	{
+		// Filter -> Encoder (1)
+		MediaTrackId encoder_id = 0;
+	};
+
+	struct EncoderRoute
+	{
+		// Encoder -> OutputTrack (N)
+		std::vector<Output> outputs;
+	};
+
+	static std::shared_ptr<const TranscodeRoutingGraph> Build(
+		const std::shared_ptr<info::Stream> &input_stream,
+		const std::map<MediaTrackId, LinkOutputs> &input_to_outputs,
+		const std::map<MediaTrackId, MediaTrackId> &input_to_decoder,
+		const std::map<MediaTrackId, std::vector<MediaTrackId>> &decoder_to_filters,
+		const std::map<MediaTrackId, MediaTrackId> &filter_to_encoder,
+		const std::map<MediaTrackId, LinkOutputs> &encoder_to_outputs);
+
+	// Returns nullptr if there is no route
+	const InputRoute *GetInputRoute(MediaTrackId input_track_id) const
+	{
+		return _inputs.Find(input_track_id);
+	}
+
+	const DecoderRoute *GetDecoderRoute(MediaTrackId decoder_id) const
+	{
+		return _decoders.Find(decoder_id);
+	}
+
+	const FilterRoute *GetFilterRoute(MediaTrackId filter_id) const
+	{
+		return _filters.Find(filter_id);
+	}
+
+	const EncoderRoute *GetEncoderRoute(MediaTrackId encoder_id) const
+	{
+		return _encoders.Find(encoder_id);
+	}
+
+private:
+	// Dense array of routes with the slot of each id
+	template <typename T>
+	class RouteTable
+	{
+	public:
+		T &Add(MediaTrackId id)
+		{
+			auto slot = static_cast<int32_t>(_routes.size());
+
+			if (id <= TRANSCODE_ROUTING_MAX_DIRECT_ID)
+			{
+				if (_direct_slots.size() <= id)
+				{
+					_direct_slots.resize(id + 1, -1);
+				}
+				_direct_slots[id] = slot;
+			}
+			else
+			{
+				auto it = std::lower_bound(_sparse_slots.begin(), _sparse_slots.end(), std::make_pair(id, 0));
+				_sparse_slots.insert(it, std::make_pair(id, slot));
+			}
+
+			return _routes.emplace_back();
+		}
+
+		const T *Find(MediaTrackId id) const
+		{
+			int32_t slot = -1;
+
+			if (id <= TRANSCODE_ROUTING_MAX_DIRECT_ID)
+			{
+				if (id < _direct_slots.size())
+				{
+					slot = _direct_slots[id];
+				}
+			}
+			else
+			{
+				auto it = std::lower_bound(_sparse_slots.begin(), _sparse_slots.end(), std::make_pair(id, 0));
+				if ((it != _sparse_slots.end()) && (it->first == id))
+				{
+					slot = it->second;
+				}
+			}
+
+			return (slot >= 0) ? &_routes[slot] : nullptr;
+		}
+
+	private:
+		std::vector<T> _routes;
+		std::vector<int32_t> _direct_slots;
+		std::vector<std::pair<MediaTrackId, int32_t>> _sparse_slots;
+	};
+
+	RouteTable<InputRoute> _inputs;
+	RouteTable<DecoderRoute> _decoders;
+	RouteTable<FilterRoute> _filters;
+	RouteTable<EncoderRoute> _encoders;
+};
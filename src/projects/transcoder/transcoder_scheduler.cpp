@@ -0,0 +1,653 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_scheduler.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cinttypes>
+#include <fstream>
+
+#include "transcoder_private.h"
+
+// Maximum number of items processed at once before the task yields to other tasks of the stage
+#define TRANSCODE_SCHEDULER_MAX_ITEMS_PER_RUN 8
+// Maximum time for an idle worker to sleep
+#define TRANSCODE_SCHEDULER_IDLE_TIMEOUT_MS 1000
+// Interval to report the stats of the stages
+#define TRANSCODE_SCHEDULER_STATS_INTERVAL_US (10 * 1000 * 1000)
+
+struct TranscodeScheduler::StageContext
+{
+	Stage stage = Stage::Decoder;
+
+	std::vector<std::thread> workers;
+
+	std::mutex ready_tasks_mutex;
+	std::condition_variable ready_tasks_condition;
+	std::deque<std::shared_ptr<Task>> ready_tasks;
+
+	std::atomic<uint32_t> task_count{0};
+	std::atomic<int64_t> queued_count{0};
+	std::atomic<int64_t> peak_queued_count{0};
+	std::atomic<uint64_t> processed_count{0};
+	std::atomic<uint64_t> held_count{0};
+	std::atomic<int64_t> busy_time_us{0};
+
+	// Used to calculate the utilization
+	int64_t last_busy_time_us = 0;
+	std::atomic<uint64_t> utilization_permille{0};
+	std::atomic<int64_t> last_peak_queued_count{0};
+};
+
+thread_local TranscodeScheduler::Task *TranscodeScheduler::_current_task = nullptr;
+
+static int64_t GetSteadyTimeUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Returns the CPUs of each NUMA node (empty if the NUMA topology is not available)
+static std::vector<std::vector<int>> GetNumaNodeCpus()
+{
+	std::vector<std::vector<int>> node_cpus;
+
+	for (int node = 0;; node++)
+	{
+		std::ifstream file(ov::String::FormatString("/sys/devices/system/node/node%d/cpulist", node).CStr());
+		if (file.is_open() == false)
+		{
+			break;
+		}
+
+		// ex) "0-3,8-11"
+		std::string cpu_list;
+		std::getline(file, cpu_list);
+
+		std::vector<int> cpus;
+
+		for (auto &range : ov::String(cpu_list.c_str()).Trim().Split(","))
+		{
+			auto tokens = range.Split("-");
+			if (tokens.empty() || tokens[0].IsEmpty())
+			{
+				continue;
+			}
+
+			auto first = ov::Converter::ToInt32(tokens[0]);
+			auto last = (tokens.size() > 1) ? ov::Converter::ToInt32(tokens[1]) : first;
+
+			for (auto cpu = first; cpu <= last; cpu++)
+			{
+				cpus.push_back(cpu);
+			}
+		}
+
+		if (cpus.empty() == false)
+		{
+			node_cpus.push_back(std::move(cpus));
+		}
+	}
+
+	return node_cpus;
+}
+
+static bool SetThreadAffinity(std::thread &thread, const std::vector<int> &cpus)
+{
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+
+	for (auto cpu : cpus)
+	{
+		if ((cpu >= 0) && (cpu < CPU_SETSIZE))
+		{
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+
+	return (::pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set) == 0);
+}
+
+void TranscodeScheduler::Task::Notify()
+{
+	if (_stopped)
+	{
+		return;
+	}
+
+	auto queued_count = _stage->queued_count.fetch_add(1) + 1;
+
+	auto peak_queued_count = _stage->peak_queued_count.load();
+	while ((queued_count > peak_queued_count) && (_stage->peak_queued_count.compare_exchange_weak(peak_queued_count, queued_count) == false))
+	{
+	}
+
+	if (_pending_count.fetch_add(1) != 0)
+	{
+		// The task is already scheduled or being run by a worker
+		return;
+	}
+
+	TranscodeScheduler::GetInstance()->Schedule(_stage, shared_from_this());
+}
+
+void TranscodeScheduler::Task::Stop()
+{
+	_stopped = true;
+
+	if (_current_task == this)
+	{
+		// Called by the handler of this task - the worker stops the task after the handler returns
+		return;
+	}
+
+	// Wait until the worker finishes running the task
+	std::lock_guard<std::mutex> lock_guard(_run_mutex);
+}
+
+TranscodeScheduler::TranscodeScheduler()
+{
+	for (int index = 0; index < static_cast<int>(Stage::Count); index++)
+	{
+		auto stage = std::make_unique<StageContext>();
+		stage->stage = static_cast<Stage>(index);
+
+		_stages.push_back(std::move(stage));
+	}
+}
+
+TranscodeScheduler::~TranscodeScheduler()
+{
+	Stop();
+}
+
+bool TranscodeScheduler::Start(uint32_t decoder_worker_count, uint32_t filter_worker_count, uint32_t encoder_worker_count, bool numa_affinity)
+{
+	if (_running)
+	{
+		return true;
+	}
+
+	uint32_t worker_counts[] = {decoder_worker_count, filter_worker_count, encoder_worker_count};
+
+	// The stages without a configured count share the CPU cores left by the other stages,
+	// so the workers of all stages do not exceed the CPU cores by default
+	uint32_t cpu_count = std::max(std::thread::hardware_concurrency(), 1U);
+	uint32_t configured_worker_count = 0;
+	uint32_t unconfigured_stage_count = 0;
+
+	for (auto worker_count : worker_counts)
+	{
+		configured_worker_count += worker_count;
+		unconfigured_stage_count += (worker_count == 0) ? 1 : 0;
+	}
+
+	if (unconfigured_stage_count > 0)
+	{
+		auto shared_cpu_count = (cpu_count > configured_worker_count) ? (cpu_count - configured_worker_count) : 0;
+		auto shared_worker_count = std::max(shared_cpu_count / unconfigured_stage_count, 1U);
+
+		for (auto &worker_count : worker_counts)
+		{
+			worker_count = (worker_count > 0) ? worker_count : shared_worker_count;
+		}
+	}
+
+	auto node_cpus = numa_affinity ? GetNumaNodeCpus() : std::vector<std::vector<int>>();
+	// Spread the workers of all stages over the NUMA nodes
+	uint32_t node_index = 0;
+
+	_running = true;
+	_last_stats_time_us = GetSteadyTimeUs();
+
+	for (auto &stage : _stages)
+	{
+		auto stage_name = StringFromStage(stage->stage);
+		auto worker_count = worker_counts[static_cast<int>(stage->stage)];
+
+		for (uint32_t worker_id = 0; worker_id < worker_count; worker_id++)
+		{
+			try
+			{
+				stage->workers.emplace_back(&TranscodeScheduler::WorkerThread, this, stage.get());
+			}
+			catch (const std::system_error &e)
+			{
+				logte("Failed to start %s worker #%u of the transcode scheduler", stage_name, worker_id);
+				Stop();
+
+				return false;
+			}
+
+			auto &thread = stage->workers.back();
+			pthread_setname_np(thread.native_handle(), ov::String::FormatString("TRS-%s-%u", stage_name, worker_id).CStr());
+
+			if (node_cpus.size() > 1)
+			{
+				auto &cpus = node_cpus[node_index++ % node_cpus.size()];
+
+				if (SetThreadAffinity(thread, cpus) == false)
+				{
+					logtw("Could not pin %s worker #%u to the NUMA node", stage_name, worker_id);
+				}
+			}
+		}
+	}
+
+	logti("Transcode scheduler has been started. Workers: decoder(%u), filter(%u), encoder(%u), NUMA nodes: %zu",
+		  worker_counts[0], worker_counts[1], worker_counts[2], std::max(node_cpus.size(), static_cast<size_t>(1)));
+
+	return true;
+}
+
+void TranscodeScheduler::Stop()
+{
+	for (auto &stage : _stages)
+	{
+		std::lock_guard<std::mutex> lock_guard(stage->ready_tasks_mutex);
+		_running = false;
+		stage->ready_tasks_condition.notify_all();
+	}
+
+	for (auto &stage : _stages)
+	{
+		for (auto &worker : stage->workers)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+
+		stage->workers.clear();
+
+		std::lock_guard<std::mutex> lock_guard(stage->ready_tasks_mutex);
+		stage->ready_tasks.clear();
+	}
+}
+
+bool TranscodeScheduler::IsSchedulable(cmn::MediaCodecModuleId module_id)
+{
+	switch (module_id)
+	{
+		// The XMA and NILOGAN sessions are bound to the thread that created them
+		case cmn::MediaCodecModuleId::XMA:
+		case cmn::MediaCodecModuleId::NILOGAN:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
+std::shared_ptr<TranscodeScheduler::Task> TranscodeScheduler::CreateTask(Stage stage, const ov::String &name, Task::Handler handler)
+{
+	if (_running == false)
+	{
+		return nullptr;
+	}
+
+	auto task = std::shared_ptr<Task>(new Task(), [](Task *task) {
+		task->_stage->task_count--;
+		delete task;
+	});
+
+	task->_stage = _stages[static_cast<int>(stage)].get();
+	task->_name = name;
+	task->_handler = std::move(handler);
+
+	task->_stage->task_count++;
+
+	return task;
+}
+
+void TranscodeScheduler::Schedule(StageContext *stage, const std::shared_ptr<Task> &task)
+{
+	std::lock_guard<std::mutex> lock_guard(stage->ready_tasks_mutex);
+
+	stage->ready_tasks.push_back(task);
+	stage->ready_tasks_condition.notify_one();
+}
+
+void TranscodeScheduler::WorkerThread(StageContext *stage)
+{
+	while (true)
+	{
+		std::shared_ptr<Task> task;
+
+		{
+			std::unique_lock<std::mutex> lock(stage->ready_tasks_mutex);
+
+			stage->ready_tasks_condition.wait_for(lock, std::chrono::milliseconds(TRANSCODE_SCHEDULER_IDLE_TIMEOUT_MS), [stage, this]() -> bool {
+				return (stage->ready_tasks.empty() == false) || (_running == false);
+			});
+
+			if (_running == false)
+			{
+				break;
+			}
+
+			if (stage->ready_tasks.empty() == false)
+			{
+				task = std::move(stage->ready_tasks.front());
+				stage->ready_tasks.pop_front();
+			}
+		}
+
+		if (task != nullptr)
+		{
+			RunTask(stage, task);
+		}
+
+		ReportStatsIfNeeded();
+	}
+}
+
+void TranscodeScheduler::RunTask(StageContext *stage, const std::shared_ptr<Task> &task)
+{
+	auto start_time_us = GetSteadyTimeUs();
+	bool need_to_requeue = false;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(task->_run_mutex);
+
+		if (task->_pending_count == 0)
+		{
+			// Scheduled by both Notify() and ResumeTask(), and the items are already processed by the other run
+			return;
+		}
+
+		_current_task = task.get();
+
+		for (int count = 0; count < TRANSCODE_SCHEDULER_MAX_ITEMS_PER_RUN; count++)
+		{
+			if ((task->_stopped == false) && (task->_handler() == false))
+			{
+				logtw("%s task %s can no longer process items", StringFromStage(stage->stage), task->_name.CStr());
+				task->_stopped = true;
+			}
+
+			if (task->_stopped)
+			{
+				// Discard the remaining items
+				stage->queued_count -= task->_pending_count.exchange(0);
+				break;
+			}
+
+			stage->processed_count++;
+			stage->queued_count--;
+
+			if (task->_pending_count.fetch_sub(1) == 1)
+			{
+				// All notified items are processed
+				break;
+			}
+
+			if (task->_held)
+			{
+				// The next stage is full - ResumeTask() schedules the task when it has room
+				break;
+			}
+
+			// Give other tasks of the stage a chance to run
+			need_to_requeue = (count == (TRANSCODE_SCHEDULER_MAX_ITEMS_PER_RUN - 1));
+		}
+
+		_current_task = nullptr;
+	}
+
+	stage->busy_time_us += (GetSteadyTimeUs() - start_time_us);
+
+	if (need_to_requeue)
+	{
+		Schedule(stage, task);
+	}
+}
+
+void TranscodeScheduler::ReportStatsIfNeeded()
+{
+	auto now_us = GetSteadyTimeUs();
+	auto last_stats_time_us = _last_stats_time_us.load();
+	auto elapsed_us = now_us - last_stats_time_us;
+
+	if ((elapsed_us < TRANSCODE_SCHEDULER_STATS_INTERVAL_US) ||
+		(_last_stats_time_us.compare_exchange_strong(last_stats_time_us, now_us) == false))
+	{
+		return;
+	}
+
+	ov::String stats;
+
+	for (auto &stage : _stages)
+	{
+		auto busy_time_us = stage->busy_time_us.load();
+		auto worker_count = std::max(stage->workers.size(), static_cast<size_t>(1));
+		auto utilization = static_cast<double>(busy_time_us - stage->last_busy_time_us) / (elapsed_us * worker_count);
+
+		stage->last_busy_time_us = busy_time_us;
+		stage->utilization_permille = static_cast<uint64_t>(std::clamp(utilization, 0.0, 1.0) * 1000.0);
+		stage->last_peak_queued_count = stage->peak_queued_count.exchange(stage->queued_count.load());
+
+		stats.AppendFormat(" %s(tasks: %u, queued: %" PRId64 ", peak: %" PRId64 ", processed: %" PRIu64 ", held: %" PRIu64 ", utilization: %.1f%%)",
+						   StringFromStage(stage->stage), stage->task_count.load(),
+						   stage->queued_count.load(), stage->last_peak_queued_count.load(), stage->processed_count.load(),
+						   stage->held_count.load(), stage->utilization_permille / 10.0);
+	}
+
+	logtd("Transcode scheduler stats:%s", stats.CStr());
+}
+
+std::vector<TranscodeScheduler::StageStats> TranscodeScheduler::GetStats() const
+{
+	std::vector<StageStats> stats_list;
+
+	for (auto &stage : _stages)
+	{
+		StageStats stats;
+
+		stats.stage = stage->stage;
+		stats.worker_count = stage->workers.size();
+		stats.task_count = stage->task_count;
+		stats.queued_count = stage->queued_count;
+		stats.peak_queued_count = stage->last_peak_queued_count;
+		stats.processed_count = stage->processed_count;
+		stats.held_count = stage->held_count;
+		stats.utilization = stage->utilization_permille / 1000.0;
+
+		stats_list.push_back(stats);
+	}
+
+	return stats_list;
+}
+
+std::shared_ptr<TranscodeScheduler::Task> TranscodeScheduler::HoldCurrentTask()
+{
+	if ((_current_task == nullptr) || _current_task->_held.exchange(true))
+	{
+		return nullptr;
+	}
+
+	_current_task->_stage->held_count++;
+
+	return _current_task->shared_from_this();
+}
+
+void TranscodeScheduler::ResumeTask(const std::shared_ptr<Task> &task)
+{
+	task->_held = false;
+
+	if ((task->_stopped == false) && (task->_pending_count > 0))
+	{
+		Schedule(task->_stage, task);
+	}
+}
+
+const char *TranscodeScheduler::StringFromStage(Stage stage)
+{
+	switch (stage)
+	{
+		case Stage::Decoder:
+			return "dec";
+		case Stage::Filter:
+			return "flt";
+		case Stage::Encoder:
+			return "enc";
+		default:
+			return "unknown";
+	}
+}
+
+void TranscodeBackpressure::Hold(int timeout_ms)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	if (_stopped || (_is_full() == false))
+	{
+		return;
+	}
+
+	if (TranscodeScheduler::IsWorkerThread())
+	{
+		auto task = TranscodeScheduler::HoldCurrentTask();
+
+		// If the task is already held by another consumer, it is resumed by that consumer and held here again if needed
+		if (task != nullptr)
+		{
+			_held_tasks.push_back(std::move(task));
+		}
+
+		return;
+	}
+
+	_waiting_thread_count++;
+
+	_condition.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() -> bool {
+		return _stopped || (_is_full() == false);
+	});
+
+	_waiting_thread_count--;
+}
+
+void TranscodeBackpressure::Release()
+{
+	std::vector<std::shared_ptr<TranscodeScheduler::Task>> tasks;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		if ((_held_tasks.empty() && (_waiting_thread_count == 0)) || _is_full())
+		{
+			return;
+		}
+
+		tasks.swap(_held_tasks);
+		_condition.notify_all();
+	}
+
+	ResumeTasks(std::move(tasks));
+}
+
+void TranscodeBackpressure::Stop()
+{
+	std::vector<std::shared_ptr<TranscodeScheduler::Task>> tasks;
+
+	{
+		std::lock_guard<std::mutex> lock_guard(_mutex);
+
+		_stopped = true;
+
+		tasks.swap(_held_tasks);
+		_condition.notify_all();
+	}
+
+	ResumeTasks(std::move(tasks));
+}
+
+void TranscodeBackpressure::ResumeTasks(std::vector<std::shared_ptr<TranscodeScheduler::Task>> tasks)
+{
+	for (auto &task : tasks)
+	{
+		TranscodeScheduler::GetInstance()->ResumeTask(task);
+	}
+}
+
+TranscodeStageWorker::~TranscodeStageWorker()
+{
+	Stop();
+}
+
+bool TranscodeStageWorker::Start(TranscodeScheduler::Stage stage, const ov::String &thread_name, bool schedulable, InitHandler init_handler, ProcessHandler process_handler)
+{
+	_kill_flag = false;
+	_process_handler = std::move(process_handler);
+
+	if (schedulable)
+	{
+		_task = TranscodeScheduler::GetInstance()->CreateTask(stage, thread_name, [this]() -> bool {
+			return _process_handler(0);
+		});
+
+		// If the scheduler is not running, a dedicated thread is used
+		if (_task != nullptr)
+		{
+			return init_handler();
+		}
+	}
+
+	try
+	{
+		_thread = std::thread(&TranscodeStageWorker::ThreadMain, this, std::move(init_handler));
+		pthread_setname_np(_thread.native_handle(), thread_name.CStr());
+
+		// Initialize and wait for completion
+		if (_init_event.Get() == false)
+		{
+			_kill_flag = true;
+			return false;
+		}
+	}
+	catch (const std::system_error &e)
+	{
+		_kill_flag = true;
+		return false;
+	}
+
+	return true;
+}
+
+void TranscodeStageWorker::Stop()
+{
+	_kill_flag = true;
+
+	if (_task != nullptr)
+	{
+		_task->Stop();
+	}
+
+	if (_thread.joinable())
+	{
+		_thread.join();
+	}
+}
+
+void TranscodeStageWorker::ThreadMain(InitHandler init_handler)
+{
+	if (_init_event.Submit(init_handler()) == false)
+	{
+		return;
+	}
+
+	while (_kill_flag == false)
+	{
+		if (_process_handler(ov::Infinite) == false)
+		{
+			break;
+		}
+	}
+}
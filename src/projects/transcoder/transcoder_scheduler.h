@@ -0,0 +1,231 @@
+//==============================================================================
+//
+//  Transcoder
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2025 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_type.h>
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs the decoders, filters and encoders of all transcoded streams on a fixed number of workers
+//
+// Each stage (decoder, filter, encoder) has its own workers, so a slow stage cannot starve the stages that feed it.
+// Each decoder/filter/encoder is a serial task: its items are processed in order by one worker at a time.
+// A worker processes up to TRANSCODE_SCHEDULER_MAX_ITEMS_PER_RUN items of a task, then requeues the task.
+// A task that fills the input buffer of the next stage is held until that stage catches up (see TranscodeBackpressure).
+class TranscodeScheduler : public ov::Singleton<TranscodeScheduler>
+{
+private:
+	struct StageContext;
+
+public:
+	enum class Stage : uint8_t
+	{
+		Decoder = 0,
+		Filter,
+		Encoder,
+
+		Count
+	};
+
+	class Task : public std::enable_shared_from_this<Task>
+	{
+	public:
+		// Processes one item from the input buffer of the decoder/filter/encoder.
+		// Returns false if the task can no longer process items.
+		using Handler = std::function<bool()>;
+
+		// Called after an item is pushed to the input buffer
+		void Notify();
+
+		// Prevents the task from running again, and waits until the current run is finished
+		void Stop();
+
+		// Number of items notified but not processed yet
+		int64_t GetQueuedCount() const
+		{
+			return _pending_count;
+		}
+
+	private:
+		friend class TranscodeScheduler;
+		friend class TranscodeBackpressure;
+
+		StageContext *_stage = nullptr;
+		ov::String _name;
+		Handler _handler;
+
+		std::atomic<int64_t> _pending_count{0};
+		std::atomic<bool> _stopped{false};
+		// The input buffer of the next stage is full - the worker does not run the task again until it is resumed
+		std::atomic<bool> _held{false};
+
+		// Held by the worker while the task is running
+		std::mutex _run_mutex;
+	};
+
+	struct StageStats
+	{
+		Stage stage = Stage::Decoder;
+
+		uint32_t worker_count = 0;
+		// Number of decoders/filters/encoders running on the workers
+		uint32_t task_count = 0;
+
+		// Number of items waiting in the input buffers of the tasks
+		int64_t queued_count = 0;
+		// Peak of queued_count in the last report interval
+		int64_t peak_queued_count = 0;
+
+		uint64_t processed_count = 0;
+		// Number of times a task was held because the input buffer of the next stage was full
+		uint64_t held_count = 0;
+		// Ratio of busy time of the workers in the last report interval (0.0 ~ 1.0)
+		double utilization = 0.0;
+	};
+
+	TranscodeScheduler();
+	~TranscodeScheduler() override;
+
+	// worker_count: 0 means the stage shares the CPU cores left by the stages with a configured count
+	// numa_affinity: Pin the workers to the CPUs of a NUMA node (round-robin)
+	bool Start(uint32_t decoder_worker_count, uint32_t filter_worker_count, uint32_t encoder_worker_count, bool numa_affinity);
+	void Stop();
+
+	bool IsRunning() const
+	{
+		return _running;
+	}
+
+	// Some hardware codecs must be used by the thread that created them, so they keep a dedicated thread
+	static bool IsSchedulable(cmn::MediaCodecModuleId module_id);
+
+	std::shared_ptr<Task> CreateTask(Stage stage, const ov::String &name, Task::Handler handler);
+
+	std::vector<StageStats> GetStats() const;
+
+	// Whether the current thread is a worker of the scheduler (a worker must not block, since it is shared by all streams)
+	static bool IsWorkerThread()
+	{
+		return (_current_task != nullptr);
+	}
+
+	static const char *StringFromStage(Stage stage);
+
+private:
+	friend class TranscodeBackpressure;
+
+	// Holds the task being run by the current thread.
+	// Returns the task if it was not held yet (nullptr if the thread is not a worker or the task is already held)
+	static std::shared_ptr<Task> HoldCurrentTask();
+	// Schedules a held task again
+	void ResumeTask(const std::shared_ptr<Task> &task);
+
+	void WorkerThread(StageContext *stage);
+	void RunTask(StageContext *stage, const std::shared_ptr<Task> &task);
+	void Schedule(StageContext *stage, const std::shared_ptr<Task> &task);
+
+	void ReportStatsIfNeeded();
+
+	std::vector<std::unique_ptr<StageContext>> _stages;
+	std::atomic<bool> _running{false};
+
+	std::atomic<int64_t> _last_stats_time_us{0};
+
+	// The task being run by the current thread (nullptr if the thread is not a worker)
+	static thread_local Task *_current_task;
+};
+
+// Holds the producers of a decoder/filter/encoder while its input buffer is full, instead of dropping their items
+//
+// A producer on a scheduler worker must not block the worker, so its task is held after the current item
+// and is scheduled again when the consumer has taken items from the input buffer.
+// A producer on a dedicated thread waits until the input buffer has room (up to timeout_ms).
+class TranscodeBackpressure
+{
+public:
+	// Returns true if the input buffer is full
+	using FullChecker = std::function<bool()>;
+
+	explicit TranscodeBackpressure(FullChecker is_full)
+		: _is_full(std::move(is_full))
+	{
+	}
+
+	// Called by the producer after it pushed an item to the input buffer
+	void Hold(int timeout_ms);
+	// Called by the consumer after it took an item from the input buffer
+	void Release();
+	// Releases all producers and does not hold them anymore (called when the consumer is stopped)
+	void Stop();
+
+private:
+	void ResumeTasks(std::vector<std::shared_ptr<TranscodeScheduler::Task>> tasks);
+
+	FullChecker _is_full;
+
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	std::vector<std::shared_ptr<TranscodeScheduler::Task>> _held_tasks;
+	// Number of producers waiting on dedicated threads
+	int _waiting_thread_count = 0;
+	bool _stopped = false;
+};
+
+// Runs a decoder/filter/encoder on TranscodeScheduler, or on a dedicated thread if the scheduler cannot be used
+class TranscodeStageWorker
+{
+public:
+	// Initializes the decoder/filter/encoder before the first item
+	using InitHandler = std::function<bool()>;
+	// Dequeues an item from the input buffer (waits up to timeout_ms) and processes it.
+	// Returns false if the decoder/filter/encoder can no longer process items.
+	using ProcessHandler = std::function<bool(int timeout_ms)>;
+
+	~TranscodeStageWorker();
+
+	// Runs init_handler and returns its result.
+	// thread_name: The name of the dedicated thread (used only if the stage is not scheduled)
+	bool Start(TranscodeScheduler::Stage stage, const ov::String &thread_name, bool schedulable, InitHandler init_handler, ProcessHandler process_handler);
+
+	// The input buffer must be stopped before, to wake up the dedicated thread
+	void Stop();
+
+	// Called after an item is pushed to the input buffer
+	void Notify()
+	{
+		if (_task != nullptr)
+		{
+			_task->Notify();
+		}
+	}
+
+	bool IsScheduled() const
+	{
+		return (_task != nullptr);
+	}
+
+private:
+	void ThreadMain(InitHandler init_handler);
+
+	ProcessHandler _process_handler;
+
+	std::shared_ptr<TranscodeScheduler::Task> _task;
+
+	std::atomic<bool> _kill_flag{false};
+	std::thread _thread;
+	ov::Future _init_event;
+};
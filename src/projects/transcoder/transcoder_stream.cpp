@@ -146,6 +146,8 @@ bool TranscoderStream::Stop()
 	_link_filter_to_encoder.clear();
 	_link_encoder_to_outputs.clear();
 
+	PublishRoutingGraph(nullptr);
+
 	// Delete all last decoded frame information
 	_last_decoded_frame_pts.clear();
 	_last_decoded_frames.clear();
@@ -272,6 +274,9 @@ bool TranscoderStream::UpdateInternal(const std::shared_ptr<info::Stream> &strea
 		StoreTracks(stream);
 	}
 
+	// The tracks of the input/output streams may have been replaced
+	BuildRoutingGraph();
+
 	_is_updating = false;
 
 	return true;
@@ -321,6 +326,9 @@ void TranscoderStream::RemoveFilters()
 	auto filters = _filters;
 	_filters.clear();
 
+	auto filter_ladders = _filter_ladders;
+	_filter_ladders.clear();
+
 	filter_lock.unlock();
 
 	for (auto &[id, object] : filters)
@@ -331,6 +339,15 @@ void TranscoderStream::RemoveFilters()
 			object.reset();
 		}
 	}
+
+	for (auto &[id, object] : filter_ladders)
+	{
+		if (object != nullptr)
+		{
+			object->Stop();
+			object.reset();
+		}
+	}
 }
 
 void TranscoderStream::RemoveEncoders()
@@ -824,11 +841,55 @@ int32_t TranscoderStream::BuildComposite()
 		created_count++;
 	}
 
+	BuildRoutingGraph();
+
 	logtd("%s", GetInfoStringComposite().CStr());
 
 	return created_count;
 }
 
+void TranscoderStream::BuildRoutingGraph()
+{
+	auto graph = TranscodeRoutingGraph::Build(
+		_input_stream,
+		_link_input_to_outputs,
+		_link_input_to_decoder,
+		_link_decoder_to_filters,
+		_link_filter_to_encoder,
+		_link_encoder_to_outputs);
+
+	PublishRoutingGraph(std::move(graph));
+}
+
+void TranscoderStream::PublishRoutingGraph(std::shared_ptr<const TranscodeRoutingGraph> graph)
+{
+	std::shared_ptr<const TranscodeRoutingGraph> replaced_graph;
+
+	{
+		std::lock_guard<std::mutex> lock(_routing_graph_mutex);
+
+		_routing_graph.store(graph.get(), std::memory_order_release);
+
+		replaced_graph = std::move(_current_routing_graph);
+		_current_routing_graph = std::move(graph);
+
+		// The readers only take a reference in the read section, so this does not wait for a blocking path
+		// (and cannot wait for the caller, even if it is in the middle of a packet/frame path)
+		_routing_graph_readers.Synchronize();
+	}
+
+	// The replaced graph is deleted here, or when the last packet/frame path using it releases its reference
+}
+
+std::shared_ptr<const TranscodeRoutingGraph> TranscoderStream::GetRoutingGraph() const
+{
+	ov::ReaderCounter::ReadSection read_section(_routing_graph_readers);
+
+	auto graph = _routing_graph.load(std::memory_order_acquire);
+
+	return (graph != nullptr) ? graph->shared_from_this() : nullptr;
+}
+
 // LOG for DEBUG
 ov::String TranscoderStream::GetInfoStringComposite()
 {
@@ -1160,6 +1221,13 @@ int32_t TranscoderStream::CreateFilters(std::shared_ptr<MediaFrame> buffer)
 
 	// 2. Get Output Track of Encoders
 	auto filter_ids = decoder_to_filters_it->second;
+
+	// Video rungs that can be rescaled in one filter graph, grouped by framerate settings
+	// [(FRAMERATE, SKIP_FRAMES), RUNGS]
+	std::map<std::pair<double, int32_t>, std::vector<TranscodeFilterLadder::Rung>> ladder_rungs;
+	std::shared_ptr<MediaTrack> ladder_input_track;
+	auto existing_ladder = GetFilterLadder(decoder_id);
+
 	for (auto &filter_id : filter_ids)
 	{
 		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
@@ -1192,6 +1260,20 @@ int32_t TranscoderStream::CreateFilters(std::shared_ptr<MediaFrame> buffer)
 			continue;
 		}
 
+		// If there is an existing ladder, reuse it
+		if (existing_ladder != nullptr && existing_ladder->HasFilter(filter_id))
+		{
+			created++;
+			continue;
+		}
+
+		if (existing_ladder == nullptr && FilterRescalerLadder::IsSupported(input_track, output_track))
+		{
+			ladder_input_track = input_track;
+			ladder_rungs[{output_track->GetFrameRateByConfig(), output_track->GetSkipFramesByConfig()}].push_back({filter_id, output_track});
+			continue;
+		}
+
 		if (CreateFilter(filter_id, input_track, output_track) == false)
 		{
 			continue;
@@ -1200,9 +1282,79 @@ int32_t TranscoderStream::CreateFilters(std::shared_ptr<MediaFrame> buffer)
 		created++;
 	}
 
+	// A decoder has at most one ladder. The largest group of rungs is rescaled together,
+	// and the other rungs get their own filters.
+	auto ladder_group = ladder_rungs.end();
+	for (auto it = ladder_rungs.begin(); it != ladder_rungs.end(); ++it)
+	{
+		if ((it->second.size() >= 2) && ((ladder_group == ladder_rungs.end()) || (it->second.size() > ladder_group->second.size())))
+		{
+			ladder_group = it;
+		}
+	}
+
+	for (auto it = ladder_rungs.begin(); it != ladder_rungs.end(); ++it)
+	{
+		if (it == ladder_group)
+		{
+			if (CreateFilterLadder(decoder_id, ladder_input_track, it->second))
+			{
+				created += it->second.size();
+				continue;
+			}
+
+			logtw("%s Failed to create filter ladder. Fall back to a filter per rendition. Decoder(%d)", _log_prefix.CStr(), decoder_id);
+		}
+
+		for (auto &rung : it->second)
+		{
+			if (CreateFilter(rung.filter_id, ladder_input_track, rung.output_track))
+			{
+				created++;
+			}
+		}
+	}
+
 	return created;
 }
 
+bool TranscoderStream::CreateFilterLadder(MediaTrackId decoder_id, std::shared_ptr<MediaTrack> input_track, const std::vector<TranscodeFilterLadder::Rung> &rungs)
+{
+	auto input_stream = GetInputStream();
+	if(input_stream == nullptr)
+	{
+		logte("%s Could not found input stream", _log_prefix.CStr());
+		return false;
+	}
+
+	auto ladder = TranscodeFilterLadder::Create(input_stream, input_track, rungs, bind(&TranscoderStream::OnFilteredFrame, this, std::placeholders::_1, std::placeholders::_2));
+	if (ladder == nullptr)
+	{
+		logte("%s Failed to create filter ladder. Decoder(%d)", _log_prefix.CStr(), decoder_id);
+		return false;
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_filter_map_mutex);
+	_filter_ladders[decoder_id] = ladder;
+
+	logtd("%s Created Filter Ladder. Decoder(%d), Rungs(%zu)", _log_prefix.CStr(), decoder_id, rungs.size());
+
+	return true;
+}
+
+std::shared_ptr<TranscodeFilterLadder> TranscoderStream::GetFilterLadder(MediaTrackId decoder_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
+
+	auto it = _filter_ladders.find(decoder_id);
+	if (it == _filter_ladders.end())
+	{
+		return nullptr;
+	}
+
+	return it->second;
+}
+
 bool TranscoderStream::CreateFilter(MediaTrackId filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track)
 {
 	if(GetFilter(filter_id) != nullptr)
@@ -1370,6 +1522,9 @@ void TranscoderStream::UpdateOutputTrack(std::shared_ptr<MediaFrame> buffer)
 			}
 		}
 	}
+
+	// Routes resolve the output tracks when they are built, so rebuild them with the updated tracks
+	BuildRoutingGraph();
 }
 
 void TranscoderStream::ProcessPacket(const std::shared_ptr<MediaPacket> &packet)
@@ -1388,22 +1543,27 @@ void TranscoderStream::BypassPacket(const std::shared_ptr<MediaPacket> &packet)
 {
 	MediaTrackId input_track_id = packet->GetTrackId();
 
-	auto it = _link_input_to_outputs.find(input_track_id);
-	if (it == _link_input_to_outputs.end())
+	auto graph = GetRoutingGraph();
+	if (graph == nullptr)
+	{
+		return;
+	}
+
+	auto route = graph->GetInputRoute(input_track_id);
+	if ((route == nullptr) || route->bypass_outputs.empty())
 	{
 		return;
 	}
 
-	auto input_track = _input_stream->GetTrack(input_track_id);
+	auto &input_track = route->input_track;
 	if (input_track == nullptr)
 	{
 		logte("%s Could not found input track. InputTrack(%d)", _log_prefix.CStr(), input_track_id);
 		return;
 	}
 
-	for (auto &[output_stream, output_track_id] : it->second)
+	for (auto &[output_stream, output_track_id, output_track] : route->bypass_outputs)
 	{
-		auto output_track = output_stream->GetTrack(output_track_id);
 		if (output_track == nullptr)
 		{
 			logte("%s Could not found output track. OutputTrack(%d)", _log_prefix.CStr(), output_track_id);
@@ -1436,13 +1596,19 @@ void TranscoderStream::DecodePacket(const std::shared_ptr<MediaPacket> &packet)
 {
 	MediaTrackId input_track_id = packet->GetTrackId();
 
-	auto it = _link_input_to_decoder.find(input_track_id);
-	if (it == _link_input_to_decoder.end())
+	auto graph = GetRoutingGraph();
+	if (graph == nullptr)
+	{
+		return;
+	}
+
+	auto route = graph->GetInputRoute(input_track_id);
+	if ((route == nullptr) || (route->has_decoder == false))
 	{
 		return;
 	}
 
-	auto decoder_id = it->second;
+	auto decoder_id = route->decoder_id;
 	auto decoder = GetDecoder(decoder_id);
 	if (decoder == nullptr)
 	{
@@ -1571,7 +1737,8 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, MediaTrackId decod
 
 					for (int64_t filler_pts = start_pts; filler_pts < end_pts; filler_pts += duration_per_frame)
 					{
-						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame(true);
+						// The audio filler is zero-filled, so it needs a writable copy
+						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame(input_track->GetMediaType() == cmn::MediaType::Audio);
 						if (!clone_frame)
 						{
 							continue;
@@ -1645,21 +1812,27 @@ std::shared_ptr<MediaFrame> TranscoderStream::GetLastDecodedFrame(MediaTrackId d
 
 std::shared_ptr<MediaTrack> TranscoderStream::GetInputTrackOfFilter(MediaTrackId decoder_id)
 {
-	auto decoder_to_filter_map_it = _link_decoder_to_filters.find(decoder_id);
-	if (decoder_to_filter_map_it == _link_decoder_to_filters.end())
+	auto graph = GetRoutingGraph();
+	if (graph == nullptr)
 	{
 		return nullptr;
 	}
 
-	auto filter_ids = decoder_to_filter_map_it->second;
-	if (filter_ids.size() == 0)
+	auto route = graph->GetDecoderRoute(decoder_id);
+	if ((route == nullptr) || route->filter_ids.empty())
 	{
 		return nullptr;
 	}
 
-	auto filter = GetFilter(filter_ids[0]);
+	auto filter = GetFilter(route->filter_ids[0]);
 	if (filter == nullptr)
 	{
+		auto ladder = GetFilterLadder(decoder_id);
+		if (ladder != nullptr)
+		{
+			return ladder->GetInputTrack();
+		}
+
 		return nullptr;
 	}
 
@@ -1700,12 +1873,18 @@ TranscodeResult TranscoderStream::PreEncodeFilterFrame(std::shared_ptr<MediaFram
 	auto filter_id = frame->GetTrackId();
 
 	// Get Encoder ID form Filter ID
-	auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
-	if (filter_to_encoder_it == _link_filter_to_encoder.end())
+	auto graph = GetRoutingGraph();
+	if (graph == nullptr)
 	{
 		return TranscodeResult::NoData;
 	}
-	auto encoder_id = filter_to_encoder_it->second;
+
+	auto route = graph->GetFilterRoute(filter_id);
+	if (route == nullptr)
+	{
+		return TranscodeResult::NoData;
+	}
+	auto encoder_id = route->encoder_id;
 
 	// Get EncoderSet
 	auto encoder_set = GetEncoder(encoder_id);
@@ -1770,17 +1949,21 @@ void TranscoderStream::OnEncodedPacket(MediaTrackId encoder_id, std::shared_ptr<
 		return;
 	}
 
-	auto it = _link_encoder_to_outputs.find(encoder_id);
-	if (it == _link_encoder_to_outputs.end())
+	auto graph = GetRoutingGraph();
+	if (graph == nullptr)
 	{
 		return;
 	}
-	auto output_tracks = it->second;
 
+	auto route = graph->GetEncoderRoute(encoder_id);
+	if (route == nullptr)
+	{
+		return;
+	}
 
 	// The encoded packet is used in multiple tracks. 
-	int32_t used_count = output_tracks.size();
-	for (auto &[output_stream, output_track_id] : output_tracks)
+	int32_t used_count = route->outputs.size();
+	for (auto &output : route->outputs)
 	{
 		std::shared_ptr<MediaPacket> packet = nullptr;
 		
@@ -1792,10 +1975,10 @@ void TranscoderStream::OnEncodedPacket(MediaTrackId encoder_id, std::shared_ptr<
 			continue;
 		}
 
-		packet->SetTrackId(output_track_id);
+		packet->SetTrackId(output.track_id);
 
 		// Send the packet to MediaRouter
-		SendFrame(output_stream, std::move(packet));
+		SendFrame(output.stream, std::move(packet));
 
 		used_count--;
 	}
@@ -1812,7 +1995,7 @@ void TranscoderStream::UpdateMsidOfOutputStreams(uint32_t msid)
 	}
 }
 
-void TranscoderStream::SendFrame(std::shared_ptr<info::Stream> &stream, std::shared_ptr<MediaPacket> packet)
+void TranscoderStream::SendFrame(const std::shared_ptr<info::Stream> &stream, std::shared_ptr<MediaPacket> packet)
 {
 	packet->SetMsid(stream->GetMsid());
 
@@ -1827,19 +2010,43 @@ void TranscoderStream::SendFrame(std::shared_ptr<info::Stream> &stream, std::sha
 
 void TranscoderStream::SpreadToFilters(MediaTrackId decoder_id, std::shared_ptr<MediaFrame> frame)
 {
-	auto filters = _link_decoder_to_filters.find(decoder_id);
-	if (filters == _link_decoder_to_filters.end())
+	auto graph = GetRoutingGraph();
+	auto route = (graph != nullptr) ? graph->GetDecoderRoute(decoder_id) : nullptr;
+	if (route == nullptr)
 	{
 		logtw("%s Could not found filter", _log_prefix.CStr());
 
 		return;
 	}
 	
-	auto filter_ids = filters->second;
+	auto &filter_ids = route->filter_ids;
+
+	// The filters only read the decoded data, so they share it by reference instead of copying it per rendition.
+	// Each filter gets its own MediaFrame because FilterFps rewrites the timestamps of the input frame.
+
+	// The rungs of the ladder share a single reference of the frame
+	auto ladder = GetFilterLadder(decoder_id);
+	if (ladder != nullptr)
+	{
+		auto frame_clone = frame->CloneFrame();
+		if (frame_clone == nullptr)
+		{
+			logte("%s Failed to clone frame", _log_prefix.CStr());
+		}
+		else
+		{
+			ladder->SendBuffer(std::move(frame_clone));
+		}
+	}
 
 	for (auto &filter_id : filter_ids)
 	{
-		auto frame_clone = frame->CloneFrame(true);
+		if (ladder != nullptr && ladder->HasFilter(filter_id))
+		{
+			continue;
+		}
+
+		auto frame_clone = frame->CloneFrame();
 		if (frame_clone == nullptr)
 		{
 			logte("%s Failed to clone frame", _log_prefix.CStr());
@@ -22,6 +22,8 @@
 #include "transcoder_decoder.h"
 #include "transcoder_encoder.h"
 #include "transcoder_filter.h"
+#include "transcoder_filter_ladder.h"
+#include "transcoder_routing_graph.h"
 #include "transcoder_stream_internal.h"
 #include "transcoder_events.h"
 
@@ -179,6 +181,18 @@ private:
 	// [ENCODER_ID, OUTPUT_TRACK_ID]
 	std::map<MediaTrackId, std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>> _link_encoder_to_outputs;
 
+	// Routes compiled from the link maps above, used by the packet/frame paths without a lock.
+	//
+	// Each path takes its own reference of the graph (see GetRoutingGraph()), so a replaced graph is deleted
+	// when the last path using it returns, even if it is replaced on the same thread (e.g. ChangeOutputFormat()).
+	std::atomic<const TranscodeRoutingGraph *> _routing_graph{nullptr};
+	// Readers that have loaded _routing_graph but not taken a reference yet
+	ov::ReaderCounter _routing_graph_readers;
+
+	std::mutex _routing_graph_mutex;
+	// Owns the graph of _routing_graph
+	std::shared_ptr<const TranscodeRoutingGraph> _current_routing_graph;
+
 	// Decoder Component
 	// [DECODER_ID, DECODER]
 	std::map<MediaTrackId, std::shared_ptr<TranscodeDecoder>> _decoders;
@@ -194,6 +208,10 @@ private:
 	// [FILTER_ID, FILTER]
 	std::map<MediaTrackId, std::shared_ptr<TranscodeFilter>> _filters;
 
+	// Video filters of a decoder that are rescaled together in one filter graph
+	// [DECODER_ID, FILTER_LADDER]
+	std::map<MediaTrackId, std::shared_ptr<TranscodeFilterLadder>> _filter_ladders;
+
 	// Encoder Component
 	// [ENCODER_ID, [FILTER, ENCODER]]
 	std::map<MediaTrackId, std::pair<std::shared_ptr<TranscodeFilter>, std::shared_ptr<TranscodeEncoder>>> _encoders;
@@ -218,6 +236,11 @@ private:
 					  std::shared_ptr<info::Stream> input_stream, std::shared_ptr<MediaTrack> input_track,
 					  std::shared_ptr<info::Stream> output_stream, std::shared_ptr<MediaTrack> output_track);
 	ov::String GetInfoStringComposite();
+	// Compiles the link maps into _routing_graph
+	void BuildRoutingGraph();
+	void PublishRoutingGraph(std::shared_ptr<const TranscodeRoutingGraph> graph);
+	// Returns a reference of the current routing graph (nullptr if there is no graph)
+	std::shared_ptr<const TranscodeRoutingGraph> GetRoutingGraph() const;
 
 	int32_t CreateDecoders();
 	bool CreateDecoder(MediaTrackId decoder_id, std::shared_ptr<info::Stream> input_stream, std::shared_ptr<MediaTrack> input_track);
@@ -230,6 +253,8 @@ private:
 	bool CreateFilter(MediaTrackId filter_id, std::shared_ptr<MediaTrack> input_track, std::shared_ptr<MediaTrack> output_track);
 	std::shared_ptr<TranscodeFilter> GetFilter(MediaTrackId filter_id);
 	void SetFilter(MediaTrackId filter_id, std::shared_ptr<TranscodeFilter> filter);
+	bool CreateFilterLadder(MediaTrackId decoder_id, std::shared_ptr<MediaTrack> input_track, const std::vector<TranscodeFilterLadder::Rung> &rungs);
+	std::shared_ptr<TranscodeFilterLadder> GetFilterLadder(MediaTrackId decoder_id);
 	void RemoveFilters();
 
 	std::shared_ptr<MediaTrack> GetInputTrackOfFilter(MediaTrackId decoder_id);
@@ -270,7 +295,7 @@ private:
 	void OnEncodedPacket(MediaTrackId encoder_id, std::shared_ptr<MediaPacket> encoded_packet);
 
 	// Send encoded packet to mediarouter via transcoder application
-	void SendFrame(std::shared_ptr<info::Stream> &stream, std::shared_ptr<MediaPacket> packet);
+	void SendFrame(const std::shared_ptr<info::Stream> &stream, std::shared_ptr<MediaPacket> packet);
 
 	ov::String MakeRenditionName(const ov::String &name_template, const std::shared_ptr<info::Playlist> &playlist_info, const std::shared_ptr<MediaTrack> &video_track, const std::shared_ptr<MediaTrack> &audio_track);
 